@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libprimitiv.pdb"
+  "libprimitiv.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/primitiv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
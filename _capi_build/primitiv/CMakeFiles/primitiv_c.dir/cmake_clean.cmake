@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libprimitiv_c.pdb"
+  "libprimitiv_c.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/primitiv_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
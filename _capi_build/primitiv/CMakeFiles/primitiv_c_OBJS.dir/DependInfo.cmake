@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/primitiv/c/device.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/device.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/device.cc.o.d"
+  "/root/repo/primitiv/c/devices/naive/device.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/devices/naive/device.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/devices/naive/device.cc.o.d"
+  "/root/repo/primitiv/c/functions.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/functions.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/functions.cc.o.d"
+  "/root/repo/primitiv/c/graph.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/graph.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/graph.cc.o.d"
+  "/root/repo/primitiv/c/initializer.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/initializer.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/initializer.cc.o.d"
+  "/root/repo/primitiv/c/initializer_impl.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/initializer_impl.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/initializer_impl.cc.o.d"
+  "/root/repo/primitiv/c/internal/internal.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/internal/internal.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/internal/internal.cc.o.d"
+  "/root/repo/primitiv/c/model.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/model.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/model.cc.o.d"
+  "/root/repo/primitiv/c/optimizer.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/optimizer.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/optimizer.cc.o.d"
+  "/root/repo/primitiv/c/optimizer_impl.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/optimizer_impl.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/optimizer_impl.cc.o.d"
+  "/root/repo/primitiv/c/parameter.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/parameter.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/parameter.cc.o.d"
+  "/root/repo/primitiv/c/shape.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/shape.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/shape.cc.o.d"
+  "/root/repo/primitiv/c/status.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/status.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/status.cc.o.d"
+  "/root/repo/primitiv/c/tensor.cc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/tensor.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_c_OBJS.dir/c/tensor.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/primitiv_c_OBJS.dir/c/device.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/device.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/devices/naive/device.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/devices/naive/device.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/functions.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/functions.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/graph.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/graph.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/initializer.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/initializer.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/initializer_impl.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/initializer_impl.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/internal/internal.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/internal/internal.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/model.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/model.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/optimizer.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/optimizer.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/optimizer_impl.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/optimizer_impl.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/parameter.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/parameter.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/shape.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/shape.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/status.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/status.cc.o.d"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/tensor.cc.o"
+  "CMakeFiles/primitiv_c_OBJS.dir/c/tensor.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/primitiv_c_OBJS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
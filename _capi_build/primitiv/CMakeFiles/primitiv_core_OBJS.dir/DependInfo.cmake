@@ -0,0 +1,102 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/primitiv/core/device.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/device.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/device.cc.o.d"
+  "/root/repo/primitiv/core/elementwise_program.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/elementwise_program.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/elementwise_program.cc.o.d"
+  "/root/repo/primitiv/core/graph.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/graph.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/graph.cc.o.d"
+  "/root/repo/primitiv/core/initializer_impl.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/initializer_impl.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/initializer_impl.cc.o.d"
+  "/root/repo/primitiv/core/memory_arena.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/memory_arena.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/memory_arena.cc.o.d"
+  "/root/repo/primitiv/core/memory_pool.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/memory_pool.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/memory_pool.cc.o.d"
+  "/root/repo/primitiv/core/model.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/model.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/model.cc.o.d"
+  "/root/repo/primitiv/core/node_funcs.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/node_funcs.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/node_funcs.cc.o.d"
+  "/root/repo/primitiv/core/operator_impl.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/operator_impl.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/operator_impl.cc.o.d"
+  "/root/repo/primitiv/core/optimizer.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/optimizer.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/optimizer.cc.o.d"
+  "/root/repo/primitiv/core/optimizer_impl.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/optimizer_impl.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/optimizer_impl.cc.o.d"
+  "/root/repo/primitiv/core/parameter.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/parameter.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/parameter.cc.o.d"
+  "/root/repo/primitiv/core/shape.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/shape.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/shape.cc.o.d"
+  "/root/repo/primitiv/core/shape_ops.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/shape_ops.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/shape_ops.cc.o.d"
+  "/root/repo/primitiv/core/tensor.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor.cc.o.d"
+  "/root/repo/primitiv/core/tensor_expression.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor_expression.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor_expression.cc.o.d"
+  "/root/repo/primitiv/core/tensor_funcs.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor_funcs.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/tensor_funcs.cc.o.d"
+  "/root/repo/primitiv/core/thread_pool.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/thread_pool.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/core/thread_pool.cc.o.d"
+  "/root/repo/primitiv/devices/naive/device.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/device.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/device.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/abs.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/abs.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/abs.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/add.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/add.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/add.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/argmax.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmax.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmax.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/argmin.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmin.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmin.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/attention.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/attention.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/attention.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/batch_concat.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_concat.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_concat.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/batch_pick.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_pick.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_pick.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/batch_slice.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_slice.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_slice.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/batch_sum.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_sum.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_sum.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/broadcast.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/broadcast.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/broadcast.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/concat.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/concat.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/concat.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/conv2d.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/conv2d.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/conv2d.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/copy_tensor.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/copy_tensor.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/copy_tensor.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/cos.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/cos.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/cos.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/divide.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/divide.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/divide.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/dump_description.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/dump_description.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/dump_description.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/elementwise.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elementwise.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elementwise.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/elu.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elu.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elu.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/exp.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/exp.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/exp.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/flip.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/flip.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/flip.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/gru_cell.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/gru_cell.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/gru_cell.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/identity.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/identity.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/identity.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/inplace_add.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_add.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_add.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/inplace_multiply_const.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_multiply_const.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_multiply_const.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/inplace_subtract.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_subtract.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_subtract.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/log.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/log.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/log.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/logsumexp.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/logsumexp.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/logsumexp.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/lstm_cell.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/lstm_cell.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/lstm_cell.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/matmul.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/matmul.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/matmul.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/max.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/max_pool2d.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max_pool2d.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max_pool2d.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/min.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/min.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/min.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/multiply.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/multiply.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/multiply.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/negate.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/negate.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/negate.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/new_handle.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/new_handle.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/new_handle.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/optimizer_update.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/optimizer_update.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/optimizer_update.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/permute_dims.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/permute_dims.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/permute_dims.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/pick.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pick.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pick.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/pow.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pow.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pow.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/pown.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pown.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pown.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/prelu.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/prelu.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/prelu.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/random_bernoulli.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_bernoulli.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_bernoulli.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/random_log_normal.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_log_normal.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_log_normal.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/random_normal.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_normal.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_normal.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/random_uniform.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_uniform.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_uniform.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/reset_tensor.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/reset_tensor_by_array.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor_by_array.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor_by_array.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/sigmoid.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sigmoid.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sigmoid.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/simd.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/simd_avx2.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx2.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx2.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/simd_avx512.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx512.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx512.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/simd_neon.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_neon.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_neon.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/sin.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sin.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sin.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/slice.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/slice.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/slice.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/softplus.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/softplus.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/softplus.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/sqrt.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sqrt.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sqrt.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/squared_norm.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/squared_norm.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/squared_norm.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/sru.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sru.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sru.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/subtract.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/subtract.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/subtract.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/sum.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sum.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sum.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/tan.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tan.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tan.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/tanh.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tanh.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tanh.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/tensor_to_array.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_array.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_array.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/tensor_to_vector.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_vector.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_vector.cc.o.d"
+  "/root/repo/primitiv/devices/naive/ops/transpose.cc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/transpose.cc.o" "gcc" "primitiv/CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/transpose.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
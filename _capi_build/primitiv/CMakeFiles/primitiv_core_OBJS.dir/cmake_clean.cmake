@@ -0,0 +1,175 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/primitiv_core_OBJS.dir/core/device.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/device.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/elementwise_program.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/elementwise_program.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/graph.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/graph.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/initializer_impl.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/initializer_impl.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/memory_arena.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/memory_arena.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/memory_pool.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/memory_pool.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/model.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/model.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/node_funcs.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/node_funcs.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/operator_impl.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/operator_impl.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/optimizer.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/optimizer.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/optimizer_impl.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/optimizer_impl.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/parameter.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/parameter.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/shape.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/shape.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/shape_ops.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/shape_ops.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor_expression.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor_expression.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor_funcs.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/tensor_funcs.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/thread_pool.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/core/thread_pool.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/device.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/device.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/abs.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/abs.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/add.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/add.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmax.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmax.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmin.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/argmin.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/attention.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/attention.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_concat.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_concat.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_pick.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_pick.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_slice.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_slice.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_sum.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/batch_sum.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/broadcast.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/broadcast.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/concat.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/concat.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/conv2d.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/conv2d.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/copy_tensor.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/copy_tensor.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/cos.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/cos.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/divide.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/divide.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/dump_description.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/dump_description.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elementwise.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elementwise.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elu.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/elu.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/exp.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/exp.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/flip.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/flip.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/gru_cell.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/gru_cell.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/identity.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/identity.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_add.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_add.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_multiply_const.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_multiply_const.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_subtract.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/inplace_subtract.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/log.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/log.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/logsumexp.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/logsumexp.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/lstm_cell.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/lstm_cell.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/matmul.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/matmul.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max_pool2d.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/max_pool2d.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/min.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/min.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/multiply.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/multiply.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/negate.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/negate.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/new_handle.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/new_handle.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/optimizer_update.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/optimizer_update.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/permute_dims.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/permute_dims.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pick.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pick.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pow.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pow.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pown.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/pown.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/prelu.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/prelu.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_bernoulli.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_bernoulli.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_log_normal.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_log_normal.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_normal.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_normal.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_uniform.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/random_uniform.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor_by_array.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/reset_tensor_by_array.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sigmoid.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sigmoid.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx2.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx2.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx512.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_avx512.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_neon.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/simd_neon.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sin.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sin.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/slice.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/slice.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/softplus.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/softplus.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sqrt.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sqrt.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/squared_norm.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/squared_norm.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sru.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sru.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/subtract.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/subtract.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sum.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/sum.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tan.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tan.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tanh.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tanh.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_array.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_array.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_vector.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/tensor_to_vector.cc.o.d"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/transpose.cc.o"
+  "CMakeFiles/primitiv_core_OBJS.dir/devices/naive/ops/transpose.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/primitiv_core_OBJS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
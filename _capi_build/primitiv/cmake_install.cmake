@@ -0,0 +1,179 @@
+# Install script for directory: /root/repo/primitiv
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv" TYPE FILE FILES
+    "/root/repo/_capi_build/primitiv/config.h"
+    "/root/repo/_capi_build/primitiv/version.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv" TYPE FILE FILES "/root/repo/primitiv/primitiv.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/core" TYPE FILE FILES
+    "/root/repo/primitiv/core/aligned_memory.h"
+    "/root/repo/primitiv/core/arithmetic.h"
+    "/root/repo/primitiv/core/basic_functions.h"
+    "/root/repo/primitiv/core/device.h"
+    "/root/repo/primitiv/core/elementwise_program.h"
+    "/root/repo/primitiv/core/error.h"
+    "/root/repo/primitiv/core/file_format.h"
+    "/root/repo/primitiv/core/functions.h"
+    "/root/repo/primitiv/core/graph.h"
+    "/root/repo/primitiv/core/initializer.h"
+    "/root/repo/primitiv/core/initializer_impl.h"
+    "/root/repo/primitiv/core/memory_arena.h"
+    "/root/repo/primitiv/core/memory_pool.h"
+    "/root/repo/primitiv/core/model.h"
+    "/root/repo/primitiv/core/numeric_utils.h"
+    "/root/repo/primitiv/core/operator.h"
+    "/root/repo/primitiv/core/operator_impl.h"
+    "/root/repo/primitiv/core/optimizer.h"
+    "/root/repo/primitiv/core/optimizer_impl.h"
+    "/root/repo/primitiv/core/parameter.h"
+    "/root/repo/primitiv/core/random.h"
+    "/root/repo/primitiv/core/shape.h"
+    "/root/repo/primitiv/core/shape_ops.h"
+    "/root/repo/primitiv/core/spinlock.h"
+    "/root/repo/primitiv/core/string_utils.h"
+    "/root/repo/primitiv/core/tensor.h"
+    "/root/repo/primitiv/core/tensor_expression.h"
+    "/root/repo/primitiv/core/thread_pool.h"
+    "/root/repo/primitiv/core/type_traits.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/core/mixins" TYPE FILE FILES
+    "/root/repo/primitiv/core/mixins/default_settable.h"
+    "/root/repo/primitiv/core/mixins/identifiable.h"
+    "/root/repo/primitiv/core/mixins/noncopyable.h"
+    "/root/repo/primitiv/core/mixins/nonmovable.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/contrib" TYPE FILE FILES "/root/repo/primitiv/contrib/functions.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/msgpack" TYPE FILE FILES
+    "/root/repo/primitiv/msgpack/objects.h"
+    "/root/repo/primitiv/msgpack/reader.h"
+    "/root/repo/primitiv/msgpack/writer.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/devices/naive" TYPE FILE FILES "/root/repo/primitiv/devices/naive/device.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_capi_build/primitiv/libprimitiv.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/c" TYPE FILE FILES
+    "/root/repo/primitiv/c/api.h"
+    "/root/repo/primitiv/c/define.h"
+    "/root/repo/primitiv/c/device.h"
+    "/root/repo/primitiv/c/functions.h"
+    "/root/repo/primitiv/c/graph.h"
+    "/root/repo/primitiv/c/initializer.h"
+    "/root/repo/primitiv/c/initializer_impl.h"
+    "/root/repo/primitiv/c/model.h"
+    "/root/repo/primitiv/c/optimizer.h"
+    "/root/repo/primitiv/c/optimizer_impl.h"
+    "/root/repo/primitiv/c/parameter.h"
+    "/root/repo/primitiv/c/shape.h"
+    "/root/repo/primitiv/c/status.h"
+    "/root/repo/primitiv/c/tensor.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/primitiv/c/devices/naive" TYPE FILE FILES "/root/repo/primitiv/c/devices/naive/device.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_capi_build/primitiv/libprimitiv_c.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so"
+         OLD_RPATH "/root/repo/_capi_build/primitiv:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libprimitiv_c.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
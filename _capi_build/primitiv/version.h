@@ -0,0 +1,9 @@
+#ifndef PRIMITIV_VERSION_H_
+#define PRIMITIV_VERSION_H_
+
+#define PRIMITIV_VERSION "0.4.0"
+#define PRIMITIV_VERSION_MAJOR 0
+#define PRIMITIV_VERSION_MINOR 4
+#define PRIMITIV_VERSION_PATCH 0
+
+#endif  // PRIMITIV_VERSION_H_
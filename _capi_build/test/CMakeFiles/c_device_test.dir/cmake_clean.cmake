@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_device_test.dir/c/device_test.cc.o"
+  "CMakeFiles/c_device_test.dir/c/device_test.cc.o.d"
+  "c_device_test"
+  "c_device_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_device_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_graph_test.dir/c/graph_test.cc.o"
+  "CMakeFiles/c_graph_test.dir/c/graph_test.cc.o.d"
+  "c_graph_test"
+  "c_graph_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_graph_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_internal_test.dir/c/internal_test.cc.o"
+  "CMakeFiles/c_internal_test.dir/c/internal_test.cc.o.d"
+  "c_internal_test"
+  "c_internal_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_internal_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
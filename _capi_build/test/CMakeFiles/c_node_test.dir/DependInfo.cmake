@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/c/node_test.cc" "test/CMakeFiles/c_node_test.dir/c/node_test.cc.o" "gcc" "test/CMakeFiles/c_node_test.dir/c/node_test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_capi_build/primitiv/CMakeFiles/primitiv_c.dir/DependInfo.cmake"
+  "/root/repo/_capi_build/primitiv/CMakeFiles/primitiv.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_node_test.dir/c/node_test.cc.o"
+  "CMakeFiles/c_node_test.dir/c/node_test.cc.o.d"
+  "c_node_test"
+  "c_node_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_node_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_optimizer_test.dir/c/optimizer_test.cc.o"
+  "CMakeFiles/c_optimizer_test.dir/c/optimizer_test.cc.o.d"
+  "c_optimizer_test"
+  "c_optimizer_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_optimizer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_shape_test.dir/c/shape_test.cc.o"
+  "CMakeFiles/c_shape_test.dir/c/shape_test.cc.o.d"
+  "c_shape_test"
+  "c_shape_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_shape_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_status_test.dir/c/status_test.cc.o"
+  "CMakeFiles/c_status_test.dir/c/status_test.cc.o.d"
+  "c_status_test"
+  "c_status_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_status_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/elementwise_program_test.dir/elementwise_program_test.cc.o"
+  "CMakeFiles/elementwise_program_test.dir/elementwise_program_test.cc.o.d"
+  "elementwise_program_test"
+  "elementwise_program_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/elementwise_program_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/initializer_impl_test.dir/initializer_impl_test.cc.o"
+  "CMakeFiles/initializer_impl_test.dir/initializer_impl_test.cc.o.d"
+  "initializer_impl_test"
+  "initializer_impl_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/initializer_impl_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mixins_test.dir/mixins_test.cc.o"
+  "CMakeFiles/mixins_test.dir/mixins_test.cc.o.d"
+  "mixins_test"
+  "mixins_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixins_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
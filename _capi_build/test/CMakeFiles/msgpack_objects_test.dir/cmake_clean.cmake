@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/msgpack_objects_test.dir/msgpack_objects_test.cc.o"
+  "CMakeFiles/msgpack_objects_test.dir/msgpack_objects_test.cc.o.d"
+  "msgpack_objects_test"
+  "msgpack_objects_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/msgpack_objects_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
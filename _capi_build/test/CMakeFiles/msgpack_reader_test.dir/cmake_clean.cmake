@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/msgpack_reader_test.dir/msgpack_reader_test.cc.o"
+  "CMakeFiles/msgpack_reader_test.dir/msgpack_reader_test.cc.o.d"
+  "msgpack_reader_test"
+  "msgpack_reader_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/msgpack_reader_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
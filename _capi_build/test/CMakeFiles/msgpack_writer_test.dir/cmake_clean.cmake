@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/msgpack_writer_test.dir/msgpack_writer_test.cc.o"
+  "CMakeFiles/msgpack_writer_test.dir/msgpack_writer_test.cc.o.d"
+  "msgpack_writer_test"
+  "msgpack_writer_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/msgpack_writer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/naive_device_test.dir/naive_device_test.cc.o"
+  "CMakeFiles/naive_device_test.dir/naive_device_test.cc.o.d"
+  "naive_device_test"
+  "naive_device_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/naive_device_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
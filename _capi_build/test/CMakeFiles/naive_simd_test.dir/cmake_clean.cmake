@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/naive_simd_test.dir/naive_simd_test.cc.o"
+  "CMakeFiles/naive_simd_test.dir/naive_simd_test.cc.o.d"
+  "naive_simd_test"
+  "naive_simd_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/naive_simd_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numeric_utils_test.dir/numeric_utils_test.cc.o"
+  "CMakeFiles/numeric_utils_test.dir/numeric_utils_test.cc.o.d"
+  "numeric_utils_test"
+  "numeric_utils_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numeric_utils_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/operator_impl_test.dir/operator_impl_test.cc.o"
+  "CMakeFiles/operator_impl_test.dir/operator_impl_test.cc.o.d"
+  "operator_impl_test"
+  "operator_impl_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/operator_impl_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
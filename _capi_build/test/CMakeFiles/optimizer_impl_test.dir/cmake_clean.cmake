@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/optimizer_impl_test.dir/optimizer_impl_test.cc.o"
+  "CMakeFiles/optimizer_impl_test.dir/optimizer_impl_test.cc.o.d"
+  "optimizer_impl_test"
+  "optimizer_impl_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optimizer_impl_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
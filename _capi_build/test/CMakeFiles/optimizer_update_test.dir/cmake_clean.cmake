@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/optimizer_update_test.dir/optimizer_update_test.cc.o"
+  "CMakeFiles/optimizer_update_test.dir/optimizer_update_test.cc.o.d"
+  "optimizer_update_test"
+  "optimizer_update_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optimizer_update_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
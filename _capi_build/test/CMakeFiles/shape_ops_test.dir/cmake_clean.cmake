@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shape_ops_test.dir/shape_ops_test.cc.o"
+  "CMakeFiles/shape_ops_test.dir/shape_ops_test.cc.o.d"
+  "shape_ops_test"
+  "shape_ops_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shape_ops_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
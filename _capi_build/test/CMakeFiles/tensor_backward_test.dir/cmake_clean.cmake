@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor_backward_test.dir/tensor_backward_test.cc.o"
+  "CMakeFiles/tensor_backward_test.dir/tensor_backward_test.cc.o.d"
+  "tensor_backward_test"
+  "tensor_backward_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor_backward_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
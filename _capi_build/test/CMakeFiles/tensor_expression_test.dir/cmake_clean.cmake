@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor_expression_test.dir/tensor_expression_test.cc.o"
+  "CMakeFiles/tensor_expression_test.dir/tensor_expression_test.cc.o.d"
+  "tensor_expression_test"
+  "tensor_expression_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor_expression_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor_forward_test.dir/tensor_forward_test.cc.o"
+  "CMakeFiles/tensor_forward_test.dir/tensor_forward_test.cc.o.d"
+  "tensor_forward_test"
+  "tensor_forward_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor_forward_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
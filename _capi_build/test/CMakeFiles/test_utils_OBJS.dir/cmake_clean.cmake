@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_utils_OBJS.dir/test_utils.cc.o"
+  "CMakeFiles/test_utils_OBJS.dir/test_utils.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utils_OBJS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
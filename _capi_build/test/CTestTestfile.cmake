@@ -0,0 +1,76 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_capi_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(device_test "/root/repo/_capi_build/test/device_test")
+set_tests_properties(device_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;57;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(elementwise_program_test "/root/repo/_capi_build/test/elementwise_program_test")
+set_tests_properties(elementwise_program_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;58;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(graph_test "/root/repo/_capi_build/test/graph_test")
+set_tests_properties(graph_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;59;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(initializer_impl_test "/root/repo/_capi_build/test/initializer_impl_test")
+set_tests_properties(initializer_impl_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;60;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mixins_test "/root/repo/_capi_build/test/mixins_test")
+set_tests_properties(mixins_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;61;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(model_test "/root/repo/_capi_build/test/model_test")
+set_tests_properties(model_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;62;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(msgpack_objects_test "/root/repo/_capi_build/test/msgpack_objects_test")
+set_tests_properties(msgpack_objects_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;63;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(msgpack_reader_test "/root/repo/_capi_build/test/msgpack_reader_test")
+set_tests_properties(msgpack_reader_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;64;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(msgpack_writer_test "/root/repo/_capi_build/test/msgpack_writer_test")
+set_tests_properties(msgpack_writer_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;65;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(naive_device_test "/root/repo/_capi_build/test/naive_device_test")
+set_tests_properties(naive_device_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;66;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(naive_simd_test "/root/repo/_capi_build/test/naive_simd_test")
+set_tests_properties(naive_simd_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;67;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(node_test "/root/repo/_capi_build/test/node_test")
+set_tests_properties(node_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;68;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(numeric_utils_test "/root/repo/_capi_build/test/numeric_utils_test")
+set_tests_properties(numeric_utils_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;69;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(operator_impl_test "/root/repo/_capi_build/test/operator_impl_test")
+set_tests_properties(operator_impl_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;70;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(optimizer_test "/root/repo/_capi_build/test/optimizer_test")
+set_tests_properties(optimizer_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;71;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(optimizer_impl_test "/root/repo/_capi_build/test/optimizer_impl_test")
+set_tests_properties(optimizer_impl_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;72;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(optimizer_update_test "/root/repo/_capi_build/test/optimizer_update_test")
+set_tests_properties(optimizer_update_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;73;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(parameter_test "/root/repo/_capi_build/test/parameter_test")
+set_tests_properties(parameter_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;74;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(random_test "/root/repo/_capi_build/test/random_test")
+set_tests_properties(random_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;75;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(shape_test "/root/repo/_capi_build/test/shape_test")
+set_tests_properties(shape_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;76;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(shape_ops_test "/root/repo/_capi_build/test/shape_ops_test")
+set_tests_properties(shape_ops_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;77;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(spinlock_test "/root/repo/_capi_build/test/spinlock_test")
+set_tests_properties(spinlock_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;78;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(string_utils_test "/root/repo/_capi_build/test/string_utils_test")
+set_tests_properties(string_utils_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;79;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(tensor_test "/root/repo/_capi_build/test/tensor_test")
+set_tests_properties(tensor_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;80;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(tensor_backward_test "/root/repo/_capi_build/test/tensor_backward_test")
+set_tests_properties(tensor_backward_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;81;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(tensor_expression_test "/root/repo/_capi_build/test/tensor_expression_test")
+set_tests_properties(tensor_expression_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;82;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(tensor_forward_test "/root/repo/_capi_build/test/tensor_forward_test")
+set_tests_properties(tensor_forward_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;83;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(thread_pool_test "/root/repo/_capi_build/test/thread_pool_test")
+set_tests_properties(thread_pool_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;50;add_test;/root/repo/test/CMakeLists.txt;84;primitiv_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_device_test "/root/repo/_capi_build/test/c_device_test")
+set_tests_properties(c_device_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;116;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_graph_test "/root/repo/_capi_build/test/c_graph_test")
+set_tests_properties(c_graph_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;117;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_internal_test "/root/repo/_capi_build/test/c_internal_test")
+set_tests_properties(c_internal_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;118;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_node_test "/root/repo/_capi_build/test/c_node_test")
+set_tests_properties(c_node_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;119;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_optimizer_test "/root/repo/_capi_build/test/c_optimizer_test")
+set_tests_properties(c_optimizer_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;120;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_shape_test "/root/repo/_capi_build/test/c_shape_test")
+set_tests_properties(c_shape_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;121;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(c_status_test "/root/repo/_capi_build/test/c_status_test")
+set_tests_properties(c_status_test PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;109;add_test;/root/repo/test/CMakeLists.txt;122;primitiv_c_test;/root/repo/test/CMakeLists.txt;0;")
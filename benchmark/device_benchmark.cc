@@ -0,0 +1,966 @@
+// Measures the execution time of every primitive operation of CPU devices.
+//
+// Usage:
+//   device_benchmark [--filter PATTERN] [--min-time SECONDS] [--threads N]
+//
+// Options:
+//   --filter PATTERN    Runs only operations whose names contain PATTERN.
+//   --min-time SECONDS  Minimum measurement time of each case. (default: 0.2)
+//   --threads N         Number of threads used by each device. (default: 1)
+//
+// Results are written to the standard output as a JSON object.
+
+#include <primitiv/config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <primitiv/core/device.h>
+#include <primitiv/core/elementwise_program.h>
+#include <primitiv/core/error.h>
+#include <primitiv/core/shape.h>
+#include <primitiv/core/tensor.h>
+#include <primitiv/devices/naive/device.h>
+#ifdef PRIMITIV_USE_EIGEN
+#include <primitiv/devices/eigen/device.h>
+#endif  // PRIMITIV_USE_EIGEN
+
+using primitiv::Device;
+using primitiv::ElementwiseProgram;
+using primitiv::Shape;
+using primitiv::Tensor;
+using std::string;
+using std::vector;
+
+namespace {
+
+/**
+ * Command line options.
+ */
+struct Options {
+  string filter;
+  double min_time;
+  std::uint32_t num_threads;
+};
+
+/**
+ * Measurement result of one case.
+ */
+struct Result {
+  string device;
+  string operation;
+  string shape;
+  bool supported;
+  std::uint64_t iterations;
+  double mean_ns;
+  double min_ns;
+};
+
+/**
+ * Runs benchmark cases on one device and collects results.
+ */
+class Suite {
+  Suite(const Suite &) = delete;
+  Suite &operator=(const Suite &) = delete;
+
+public:
+  Suite(
+      const string &device_name, const Options &opts, vector<Result> &results)
+  : device_name_(device_name), opts_(opts), results_(results) {}
+
+  /**
+   * Measures a benchmark case.
+   * @param op Name of the operation.
+   * @param shape Description of input shapes.
+   * @param fn Function to be measured.
+   */
+  void run(
+      const string &op, const string &shape, const std::function<void()> &fn) {
+    if (op.find(opts_.filter) == string::npos) return;
+    using Clock = std::chrono::steady_clock;
+    Result res {device_name_, op, shape, true, 0, 0, 0};
+
+    try {
+      // Warming up: also initializes memory pools of the device.
+      fn();
+    } catch (const primitiv::NotImplementedError &) {
+      res.supported = false;
+      results_.emplace_back(res);
+      return;
+    }
+
+    const auto begin = Clock::now();
+    double total_ns = 0;
+    while (res.iterations < MIN_ITERATIONS || total_ns < opts_.min_time * 1e9) {
+      const auto t0 = Clock::now();
+      fn();
+      const auto t1 = Clock::now();
+      const double ns =
+        std::chrono::duration<double, std::nano>(t1 - t0).count();
+      if (res.iterations == 0 || ns < res.min_ns) res.min_ns = ns;
+      ++res.iterations;
+      total_ns =
+        std::chrono::duration<double, std::nano>(t1 - begin).count();
+    }
+    res.mean_ns = total_ns / res.iterations;
+    results_.emplace_back(res);
+  }
+
+private:
+  static constexpr std::uint64_t MIN_ITERATIONS = 3;
+
+  string device_name_;
+  const Options &opts_;
+  vector<Result> &results_;
+};
+
+constexpr std::uint64_t Suite::MIN_ITERATIONS;
+
+// Shapes of elementwise operations.
+const vector<Shape> ELEMENTWISE_SHAPES {
+  {4096}, {256, 256}, Shape({64, 64}, 32),
+};
+
+// Shapes of operations along a dimension.
+const vector<Shape> MATRIX_SHAPES {
+  {256, 256}, Shape({64, 64}, 32),
+};
+
+// Shapes of minibatch operations.
+const vector<Shape> BATCH_SHAPES {
+  Shape({256}, 64), Shape({64, 64}, 32),
+};
+
+string to_string(const vector<Shape> &shapes) {
+  string ret;
+  for (const Shape &s : shapes) {
+    if (!ret.empty()) ret += ',';
+    ret += s.to_string();
+  }
+  return ret;
+}
+
+// Positive values are used to keep all operations in their domains.
+Tensor make_input(Device &dev, const Shape &shape) {
+  return dev.random_uniform(shape, .5, 1.5);
+}
+
+void run_unary(Device &dev, Suite &suite) {
+#define BENCH_UNARY(name) { \
+  const Tensor x = make_input(dev, shape); \
+  const Tensor y = dev.name##_fw(x); \
+  const Tensor gy = make_input(dev, shape); \
+  Tensor gx = dev.new_tensor_by_constant(shape, 0); \
+  suite.run(#name "_fw", s, [&] { dev.name##_fw(x); }); \
+  suite.run(#name "_bw", s, [&] { dev.name##_bw(x, y, gy, gx); }); \
+}
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    const string s = shape.to_string();
+    {
+      const Tensor x = make_input(dev, shape);
+      suite.run("negate_fw", s, [&] { dev.negate_fw(x); });
+    }
+    BENCH_UNARY(abs);
+    BENCH_UNARY(sqrt);
+    BENCH_UNARY(exp);
+    BENCH_UNARY(log);
+    BENCH_UNARY(tanh);
+    BENCH_UNARY(sigmoid);
+    BENCH_UNARY(softplus);
+    BENCH_UNARY(sin);
+    BENCH_UNARY(cos);
+    BENCH_UNARY(tan);
+  }
+#undef BENCH_UNARY
+}
+
+void run_const(Device &dev, Suite &suite) {
+#define BENCH_CONST(name, k) { \
+  const Tensor x = make_input(dev, shape); \
+  const Tensor y = dev.name##_fw(x, k); \
+  const Tensor gy = make_input(dev, shape); \
+  Tensor gx = dev.new_tensor_by_constant(shape, 0); \
+  suite.run(#name "_fw", s, [&] { dev.name##_fw(x, k); }); \
+  suite.run(#name "_bw", s, [&] { dev.name##_bw(x, y, gy, k, gx); }); \
+}
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    const string s = shape.to_string();
+    BENCH_CONST(add_const, 2.f);
+    BENCH_CONST(subtract_const_r, 2.f);
+    BENCH_CONST(subtract_const_l, 2.f);
+    BENCH_CONST(multiply_const, 2.f);
+    BENCH_CONST(divide_const_r, 2.f);
+    BENCH_CONST(divide_const_l, 2.f);
+    BENCH_CONST(pow_const_r, 2.f);
+    BENCH_CONST(pow_const_l, 2.f);
+    BENCH_CONST(prelu, .1f);
+    BENCH_CONST(elu, 1.f);
+    BENCH_CONST(pown, 3);
+  }
+#undef BENCH_CONST
+}
+
+void run_scalar(Device &dev, Suite &suite) {
+#define BENCH_SCALAR(name) \
+  suite.run(#name "_fw", s, [&] { dev.name##_fw(x, k); });
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    const Tensor x = make_input(dev, shape);
+    const Tensor k = make_input(dev, Shape({}, shape.batch()));
+    const string s = to_string({x.shape(), k.shape()});
+    BENCH_SCALAR(add_scalar);
+    BENCH_SCALAR(subtract_scalar_r);
+    BENCH_SCALAR(subtract_scalar_l);
+    BENCH_SCALAR(multiply_scalar);
+    BENCH_SCALAR(divide_scalar_r);
+    BENCH_SCALAR(divide_scalar_l);
+    BENCH_SCALAR(pow_scalar_r);
+    BENCH_SCALAR(pow_scalar_l);
+  }
+#undef BENCH_SCALAR
+}
+
+void run_binary(Device &dev, Suite &suite) {
+#define BENCH_BINARY(name) { \
+  const Tensor y = dev.name##_fw(a, b); \
+  const Tensor gy = make_input(dev, y.shape()); \
+  Tensor ga = dev.new_tensor_by_constant(a.shape(), 0); \
+  Tensor gb = dev.new_tensor_by_constant(b.shape(), 0); \
+  suite.run(#name "_fw", s, [&] { dev.name##_fw(a, b); }); \
+  suite.run(#name "_bw", s, [&] { dev.name##_bw(a, b, y, gy, ga, gb); }); \
+}
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    // Same shapes, and broadcasting of the second operand over minibatches.
+    vector<Shape> b_shapes {shape};
+    if (shape.has_batch()) b_shapes.emplace_back(shape.resize_batch(1));
+    for (const Shape &b_shape : b_shapes) {
+      const Tensor a = make_input(dev, shape);
+      const Tensor b = make_input(dev, b_shape);
+      const string s = to_string({shape, b_shape});
+      BENCH_BINARY(add);
+      BENCH_BINARY(subtract);
+      BENCH_BINARY(multiply);
+      BENCH_BINARY(divide);
+      BENCH_BINARY(pow);
+    }
+  }
+
+  const vector<vector<Shape>> matmul_shapes {
+    {{64, 64}, {64, 64}},
+    {{256, 256}, {256, 256}},
+    {{256, 256}, {256}},
+    {Shape({64, 64}, 32), Shape({64, 64}, 32)},
+    {Shape({256, 256}), Shape({256}, 64)},
+    // Many small products, e.g., attention over each sample.
+    {Shape({16, 64}, 256), Shape({64, 16}, 256)},
+    {Shape({16, 64}, 256), Shape({64, 16})},
+  };
+  for (const vector<Shape> &shapes : matmul_shapes) {
+    const Tensor a = make_input(dev, shapes[0]);
+    const Tensor b = make_input(dev, shapes[1]);
+    const string s = to_string(shapes);
+    BENCH_BINARY(matmul);
+  }
+#undef BENCH_BINARY
+}
+
+void run_manipulation(Device &dev, Suite &suite) {
+  for (const Shape &shape : MATRIX_SHAPES) {
+    const string s = shape.to_string();
+    const Tensor x = make_input(dev, shape);
+    Tensor gx = dev.new_tensor_by_constant(shape, 0);
+
+    {
+      const vector<std::uint32_t> ids {7};
+      const Tensor gy = make_input(dev, dev.pick_fw(x, ids, 1).shape());
+      suite.run("pick_fw", s, [&] { dev.pick_fw(x, ids, 1); });
+      suite.run("pick_bw", s, [&] { dev.pick_bw(gy, ids, 1, gx); });
+    }
+    {
+      const std::uint32_t upper = shape[1] / 2;
+      const Tensor gy = make_input(dev, dev.slice_fw(x, 1, 0, upper).shape());
+      suite.run("slice_fw", s, [&] { dev.slice_fw(x, 1, 0, upper); });
+      suite.run("slice_bw", s, [&] { dev.slice_bw(gy, 1, 0, gx); });
+    }
+    {
+      const vector<const Tensor *> xs {&x, &x, &x, &x};
+      suite.run("concat_fw", s, [&] { dev.concat_fw(xs, 1); });
+    }
+    {
+      const Tensor y = dev.transpose_fw(x);
+      const Tensor gy = make_input(dev, y.shape());
+      suite.run("transpose_fw", s, [&] { dev.transpose_fw(x); });
+      suite.run("transpose_bw", s, [&] { dev.transpose_bw(x, y, gy, gx); });
+    }
+    {
+      const vector<std::uint32_t> perm {1, 0};
+      const Tensor y = dev.permute_dims_fw(x, perm);
+      const Tensor gy = make_input(dev, y.shape());
+      suite.run("permute_dims_fw", s, [&] { dev.permute_dims_fw(x, perm); });
+      suite.run("permute_dims_bw", s, [&] {
+          dev.permute_dims_bw(x, y, gy, perm, gx);
+      });
+    }
+    {
+      const Tensor gy = make_input(dev, shape);
+      suite.run("flip_fw", s, [&] { dev.flip_fw(x, 0); });
+      suite.run("flip_bw", s, [&] { dev.flip_bw(gy, 0, gx); });
+    }
+  }
+}
+
+void run_dimension(Device &dev, Suite &suite) {
+  for (const Shape &shape : MATRIX_SHAPES) {
+    for (const std::uint32_t dim : {0u, 1u}) {
+      const string s = shape.to_string() + "/" + std::to_string(dim);
+      const Tensor x = make_input(dev, shape);
+      Tensor gx = dev.new_tensor_by_constant(shape, 0);
+      {
+        const Tensor y = dev.max_fw(x, dim);
+        const Tensor gy = make_input(dev, y.shape());
+        suite.run("max_fw", s, [&] { dev.max_fw(x, dim); });
+        suite.run("max_bw", s, [&] { dev.max_bw(x, y, gy, dim, gx); });
+      }
+      {
+        const Tensor y = dev.min_fw(x, dim);
+        const Tensor gy = make_input(dev, y.shape());
+        suite.run("min_fw", s, [&] { dev.min_fw(x, dim); });
+        suite.run("min_bw", s, [&] { dev.min_bw(x, y, gy, dim, gx); });
+      }
+      suite.run("sum_fw", s, [&] { dev.sum_fw(x, dim); });
+      suite.run("logsumexp_fw", s, [&] { dev.logsumexp_fw(x, dim); });
+      {
+        const Tensor y = dev.sum_fw(x, dim);
+        const std::uint32_t size = shape[dim];
+        suite.run("broadcast_fw", s, [&] { dev.broadcast_fw(y, dim, size); });
+      }
+    }
+  }
+}
+
+void run_batch(Device &dev, Suite &suite) {
+  for (const Shape &shape : BATCH_SHAPES) {
+    const string s = shape.to_string();
+    const Tensor x = make_input(dev, shape);
+    Tensor gx = dev.new_tensor_by_constant(shape, 0);
+    {
+      const vector<std::uint32_t> ids {0, 3, 7, 15};
+      const Tensor gy = make_input(dev, dev.batch_pick_fw(x, ids).shape());
+      suite.run("batch_pick_fw", s, [&] { dev.batch_pick_fw(x, ids); });
+      suite.run("batch_pick_bw", s, [&] { dev.batch_pick_bw(gy, ids, gx); });
+    }
+    {
+      const std::uint32_t upper = shape.batch() / 2;
+      const Tensor gy = make_input(
+          dev, dev.batch_slice_fw(x, 0, upper).shape());
+      suite.run("batch_slice_fw", s, [&] { dev.batch_slice_fw(x, 0, upper); });
+      suite.run("batch_slice_bw", s, [&] { dev.batch_slice_bw(gy, 0, gx); });
+    }
+    {
+      const vector<const Tensor *> xs {&x, &x, &x, &x};
+      suite.run("batch_concat_fw", s, [&] { dev.batch_concat_fw(xs); });
+    }
+    suite.run("batch_sum_fw", s, [&] { dev.batch_sum_fw(x); });
+  }
+}
+
+void run_convolution(Device &dev, Suite &suite) {
+  struct ConvCase { Shape x; Shape w; std::uint32_t padding; };
+  const vector<ConvCase> conv_cases {
+    {{28, 28, 1}, {5, 5, 1, 8}, 0},
+    {{32, 32, 16}, {3, 3, 16, 16}, 1},
+    {Shape({32, 32, 3}, 16), {3, 3, 3, 16}, 1},
+  };
+  for (const ConvCase &c : conv_cases) {
+    const string s =
+      to_string({c.x, c.w}) + "/pad=" + std::to_string(c.padding);
+    const std::uint32_t p = c.padding;
+    const Tensor x = make_input(dev, c.x);
+    const Tensor w = make_input(dev, c.w);
+    const Tensor y = dev.conv2d_fw(x, w, p, p, 1, 1, 1, 1);
+    const Tensor gy = make_input(dev, y.shape());
+    Tensor gx = dev.new_tensor_by_constant(c.x, 0);
+    Tensor gw = dev.new_tensor_by_constant(c.w, 0);
+    suite.run("conv2d_fw", s, [&] { dev.conv2d_fw(x, w, p, p, 1, 1, 1, 1); });
+    suite.run("conv2d_bw", s, [&] {
+        dev.conv2d_bw(x, w, y, gy, p, p, 1, 1, 1, 1, gx, gw);
+    });
+  }
+
+  const vector<Shape> pool_shapes {
+    {28, 28, 8}, {32, 32, 16}, Shape({32, 32, 16}, 16),
+  };
+  for (const Shape &shape : pool_shapes) {
+    const string s = shape.to_string() + "/window=2";
+    const Tensor x = make_input(dev, shape);
+    const Tensor y = dev.max_pool2d_fw(x, 2, 2, 0, 0, 2, 2);
+    const Tensor gy = make_input(dev, y.shape());
+    Tensor gx = dev.new_tensor_by_constant(shape, 0);
+    suite.run("max_pool2d_fw", s, [&] {
+        dev.max_pool2d_fw(x, 2, 2, 0, 0, 2, 2);
+    });
+    suite.run("max_pool2d_bw", s, [&] {
+        dev.max_pool2d_bw(x, y, gy, 2, 2, 0, 0, 2, 2, gx);
+    });
+  }
+}
+
+void run_attention(Device &dev, Suite &suite) {
+  // Decoding steps with one query and encoding with many queries.
+  struct AttentionCase { Shape q; Shape k; };
+  const vector<AttentionCase> attention_cases {
+    {Shape({256, 1}, 32), Shape({256, 64}, 32)},
+    {Shape({64, 128}, 16), Shape({64, 128}, 16)},
+  };
+  for (const AttentionCase &c : attention_cases) {
+    const string s = to_string({c.q, c.k});
+    const Tensor q = make_input(dev, c.q);
+    const Tensor k = make_input(dev, c.k);
+    Tensor y, lse;
+    dev.attention_fw(q, k, k, nullptr, .1, y, lse);
+    const Tensor gy = make_input(dev, y.shape());
+    const Tensor glse = dev.new_tensor_by_constant(lse.shape(), 0);
+    Tensor gq = dev.new_tensor_by_constant(c.q, 0);
+    Tensor gk = dev.new_tensor_by_constant(c.k, 0);
+    Tensor gv = dev.new_tensor_by_constant(c.k, 0);
+    suite.run("attention_fw", s, [&] {
+        Tensor y, lse;
+        dev.attention_fw(q, k, k, nullptr, .1, y, lse);
+    });
+    suite.run("attention_bw", s, [&] {
+        dev.attention_bw(
+            q, k, k, nullptr, y, lse, gy, glse, .1, gq, gk, gv, nullptr);
+    });
+  }
+}
+
+void run_lstm(Device &dev, Suite &suite) {
+  // One step of LSTM: u = W . x, followed by the cell. The same step is also
+  // calculated by separate operations for comparison.
+  struct LstmCase { std::uint32_t n; std::uint32_t d; std::uint32_t bs; };
+  const vector<LstmCase> lstm_cases {{256, 256, 1}, {256, 256, 32}};
+  for (const LstmCase &c : lstm_cases) {
+    const std::uint32_t n = c.n;
+    const Shape sw({4 * n, c.d});
+    const Shape sx({c.d}, c.bs);
+    const Shape su({4 * n}, c.bs);
+    const Shape sc({n}, c.bs);
+    const string s = to_string({sw, sx});
+    const Tensor w = make_input(dev, sw);
+    const Tensor x = make_input(dev, sx);
+    const Tensor b = make_input(dev, {4 * n});
+    const Tensor c0 = make_input(dev, sc);
+    const Tensor gh = make_input(dev, sc);
+    const Tensor gc1 = make_input(dev, sc);
+    Tensor gw = dev.new_tensor_by_constant(sw, 0);
+    Tensor gx = dev.new_tensor_by_constant(sx, 0);
+    Tensor gb = dev.new_tensor_by_constant({4 * n}, 0);
+    Tensor gc0 = dev.new_tensor_by_constant(sc, 0);
+
+    const Tensor u = dev.matmul_fw(w, x);
+    Tensor h, c1;
+    dev.lstm_cell_fw(u, b, c0, h, c1);
+    Tensor gu = dev.new_tensor_by_constant(su, 0);
+    suite.run("lstm_cell_fw", s, [&] {
+        Tensor h2, c2;
+        dev.lstm_cell_fw(dev.matmul_fw(w, x), b, c0, h2, c2);
+    });
+    suite.run("lstm_cell_bw", s, [&] {
+        gu.reset(0);
+        dev.lstm_cell_bw(u, b, c0, c1, gh, gc1, gu, gb, gc0);
+        dev.matmul_bw(w, x, u, gu, gw, gx);
+    });
+
+    // Intermediate values of the unfused computation.
+    const Tensor a = dev.add_fw(u, b);
+    const Tensor ai = dev.slice_fw(a, 0, 0, n);
+    const Tensor af = dev.slice_fw(a, 0, n, 2 * n);
+    const Tensor ao = dev.slice_fw(a, 0, 2 * n, 3 * n);
+    const Tensor aj = dev.slice_fw(a, 0, 3 * n, 4 * n);
+    const Tensor i = dev.sigmoid_fw(ai);
+    const Tensor f = dev.sigmoid_fw(af);
+    const Tensor o = dev.sigmoid_fw(ao);
+    const Tensor j = dev.tanh_fw(aj);
+    const Tensor ij = dev.multiply_fw(i, j);
+    const Tensor fc = dev.multiply_fw(f, c0);
+    const Tensor u_c1 = dev.add_fw(ij, fc);
+    const Tensor tc = dev.tanh_fw(u_c1);
+    const Tensor u_h = dev.multiply_fw(o, tc);
+    Tensor ga = dev.new_tensor_by_constant(su, 0);
+    Tensor gi = dev.new_tensor_by_constant(sc, 0);
+    Tensor gf = dev.new_tensor_by_constant(sc, 0);
+    Tensor go = dev.new_tensor_by_constant(sc, 0);
+    Tensor gj = dev.new_tensor_by_constant(sc, 0);
+    Tensor gai = dev.new_tensor_by_constant(sc, 0);
+    Tensor gaf = dev.new_tensor_by_constant(sc, 0);
+    Tensor gao = dev.new_tensor_by_constant(sc, 0);
+    Tensor gaj = dev.new_tensor_by_constant(sc, 0);
+    Tensor gij = dev.new_tensor_by_constant(sc, 0);
+    Tensor gfc = dev.new_tensor_by_constant(sc, 0);
+    Tensor gtc = dev.new_tensor_by_constant(sc, 0);
+    Tensor gcc = dev.new_tensor_by_constant(sc, 0);
+    suite.run("lstm_cell_unfused_fw", s, [&] {
+        const Tensor a = dev.add_fw(dev.matmul_fw(w, x), b);
+        const Tensor i = dev.sigmoid_fw(dev.slice_fw(a, 0, 0, n));
+        const Tensor f = dev.sigmoid_fw(dev.slice_fw(a, 0, n, 2 * n));
+        const Tensor o = dev.sigmoid_fw(dev.slice_fw(a, 0, 2 * n, 3 * n));
+        const Tensor j = dev.tanh_fw(dev.slice_fw(a, 0, 3 * n, 4 * n));
+        const Tensor c1 = dev.add_fw(
+            dev.multiply_fw(i, j), dev.multiply_fw(f, c0));
+        dev.multiply_fw(o, dev.tanh_fw(c1));
+    });
+    suite.run("lstm_cell_unfused_bw", s, [&] {
+        for (Tensor *t : {
+            &gu, &ga, &gi, &gf, &go, &gj, &gai, &gaf, &gao, &gaj,
+            &gij, &gfc, &gtc}) {
+          t->reset(0);
+        }
+        gcc.reset_by_vector(gc1.to_vector());
+        dev.multiply_bw(o, tc, u_h, gh, go, gtc);
+        dev.tanh_bw(u_c1, tc, gtc, gcc);
+        dev.add_bw(ij, fc, u_c1, gcc, gij, gfc);
+        dev.multiply_bw(i, j, ij, gij, gi, gj);
+        dev.multiply_bw(f, c0, fc, gfc, gf, gc0);
+        dev.sigmoid_bw(ai, i, gi, gai);
+        dev.sigmoid_bw(af, f, gf, gaf);
+        dev.sigmoid_bw(ao, o, go, gao);
+        dev.tanh_bw(aj, j, gj, gaj);
+        dev.slice_bw(gai, 0, 0, ga);
+        dev.slice_bw(gaf, 0, n, ga);
+        dev.slice_bw(gao, 0, 2 * n, ga);
+        dev.slice_bw(gaj, 0, 3 * n, ga);
+        dev.add_bw(u, b, a, ga, gu, gb);
+        dev.matmul_bw(w, x, u, gu, gw, gx);
+    });
+  }
+}
+
+void run_gru(Device &dev, Suite &suite) {
+  // One step of GRU: ux = W . x and uh = U . h, followed by the cell. The
+  // same step is also calculated by separate operations for comparison.
+  struct GruCase { std::uint32_t n; std::uint32_t d; std::uint32_t bs; };
+  const vector<GruCase> gru_cases {{256, 256, 1}, {256, 256, 32}};
+  for (const GruCase &c : gru_cases) {
+    const std::uint32_t n = c.n;
+    const Shape sw({3 * n, c.d});
+    const Shape sv({3 * n, n});
+    const Shape sx({c.d}, c.bs);
+    const Shape su({3 * n}, c.bs);
+    const Shape sh({n}, c.bs);
+    const string s = to_string({sw, sv, sx});
+    const Tensor w = make_input(dev, sw);
+    const Tensor v = make_input(dev, sv);
+    const Tensor x = make_input(dev, sx);
+    const Tensor h = make_input(dev, sh);
+    const Tensor gy = make_input(dev, sh);
+    Tensor gw = dev.new_tensor_by_constant(sw, 0);
+    Tensor gv = dev.new_tensor_by_constant(sv, 0);
+    Tensor gx = dev.new_tensor_by_constant(sx, 0);
+    Tensor gh = dev.new_tensor_by_constant(sh, 0);
+
+    const Tensor ux = dev.matmul_fw(w, x);
+    const Tensor uh = dev.matmul_fw(v, h);
+    Tensor gux = dev.new_tensor_by_constant(su, 0);
+    Tensor guh = dev.new_tensor_by_constant(su, 0);
+    suite.run("gru_cell_fw", s, [&] {
+        Tensor y;
+        dev.gru_cell_fw(dev.matmul_fw(w, x), dev.matmul_fw(v, h), h, y);
+    });
+    suite.run("gru_cell_bw", s, [&] {
+        gux.reset(0);
+        guh.reset(0);
+        dev.gru_cell_bw(ux, uh, h, gy, gux, guh, gh);
+        dev.matmul_bw(w, x, ux, gux, gw, gx);
+        dev.matmul_bw(v, h, uh, guh, gv, gh);
+    });
+
+    // Intermediate values of the unfused computation, which calculates
+    // y = j + z * (h - j).
+    const Tensor a = dev.add_fw(ux, uh);
+    const Tensor ar = dev.slice_fw(a, 0, 0, n);
+    const Tensor az = dev.slice_fw(a, 0, n, 2 * n);
+    const Tensor r = dev.sigmoid_fw(ar);
+    const Tensor z = dev.sigmoid_fw(az);
+    const Tensor uxj = dev.slice_fw(ux, 0, 2 * n, 3 * n);
+    const Tensor uhj = dev.slice_fw(uh, 0, 2 * n, 3 * n);
+    const Tensor ruhj = dev.multiply_fw(r, uhj);
+    const Tensor aj = dev.add_fw(uxj, ruhj);
+    const Tensor j = dev.tanh_fw(aj);
+    const Tensor hj = dev.subtract_fw(h, j);
+    const Tensor zhj = dev.multiply_fw(z, hj);
+    const Tensor y = dev.add_fw(j, zhj);
+    Tensor ga = dev.new_tensor_by_constant(su, 0);
+    Tensor gar = dev.new_tensor_by_constant(sh, 0);
+    Tensor gaz = dev.new_tensor_by_constant(sh, 0);
+    Tensor gr = dev.new_tensor_by_constant(sh, 0);
+    Tensor gz = dev.new_tensor_by_constant(sh, 0);
+    Tensor guxj = dev.new_tensor_by_constant(sh, 0);
+    Tensor guhj = dev.new_tensor_by_constant(sh, 0);
+    Tensor gruhj = dev.new_tensor_by_constant(sh, 0);
+    Tensor gaj = dev.new_tensor_by_constant(sh, 0);
+    Tensor gj = dev.new_tensor_by_constant(sh, 0);
+    Tensor ghj = dev.new_tensor_by_constant(sh, 0);
+    Tensor gzhj = dev.new_tensor_by_constant(sh, 0);
+    suite.run("gru_cell_unfused_fw", s, [&] {
+        const Tensor ux = dev.matmul_fw(w, x);
+        const Tensor uh = dev.matmul_fw(v, h);
+        const Tensor a = dev.add_fw(ux, uh);
+        const Tensor r = dev.sigmoid_fw(dev.slice_fw(a, 0, 0, n));
+        const Tensor z = dev.sigmoid_fw(dev.slice_fw(a, 0, n, 2 * n));
+        const Tensor j = dev.tanh_fw(dev.add_fw(
+              dev.slice_fw(ux, 0, 2 * n, 3 * n),
+              dev.multiply_fw(r, dev.slice_fw(uh, 0, 2 * n, 3 * n))));
+        dev.add_fw(j, dev.multiply_fw(z, dev.subtract_fw(h, j)));
+    });
+    suite.run("gru_cell_unfused_bw", s, [&] {
+        for (Tensor *t : {
+            &gux, &guh, &ga, &gar, &gaz, &gr, &gz, &guxj, &guhj, &gruhj,
+            &gaj, &gj, &ghj, &gzhj}) {
+          t->reset(0);
+        }
+        dev.add_bw(j, zhj, y, gy, gj, gzhj);
+        dev.multiply_bw(z, hj, zhj, gzhj, gz, ghj);
+        dev.subtract_bw(h, j, hj, ghj, gh, gj);
+        dev.tanh_bw(aj, j, gj, gaj);
+        dev.add_bw(uxj, ruhj, aj, gaj, guxj, gruhj);
+        dev.multiply_bw(r, uhj, ruhj, gruhj, gr, guhj);
+        dev.sigmoid_bw(ar, r, gr, gar);
+        dev.sigmoid_bw(az, z, gz, gaz);
+        dev.slice_bw(gar, 0, 0, ga);
+        dev.slice_bw(gaz, 0, n, ga);
+        dev.add_bw(ux, uh, a, ga, gux, guh);
+        dev.slice_bw(guxj, 0, 2 * n, gux);
+        dev.slice_bw(guhj, 0, 2 * n, guh);
+        dev.matmul_bw(w, x, ux, gux, gw, gx);
+        dev.matmul_bw(v, h, uh, guh, gv, gh);
+    });
+  }
+}
+
+void run_sru(Device &dev, Suite &suite) {
+  // The whole sequence of SRU: u = W . x, followed by the recurrence. The
+  // unfused computation calculates the recurrence step by step with
+  // c[t] = u[t] + f[t] * (c[t-1] - u[t]) and h = x + r * (tanh(c) - x).
+  struct SruCase { std::uint32_t n; std::uint32_t t; std::uint32_t bs; };
+  const vector<SruCase> sru_cases {{256, 32, 1}, {256, 32, 16}};
+  for (const SruCase &c : sru_cases) {
+    const std::uint32_t n = c.n;
+    const std::uint32_t len = c.t;
+    const Shape sw({3 * n, n});
+    const Shape sx({n, len}, c.bs);
+    const Shape su({3 * n, len}, c.bs);
+    const Shape sg({2 * n, len}, c.bs);
+    const Shape sc({n}, c.bs);
+    const string s = to_string({sw, sx});
+    const Tensor w = make_input(dev, sw);
+    const Tensor x = make_input(dev, sx);
+    const Tensor b = make_input(dev, {2 * n});
+    const Tensor gh = make_input(dev, sx);
+    const Tensor gc = make_input(dev, sx);
+    const Tensor c0 = dev.new_tensor_by_constant(sc, 0);
+    Tensor gw = dev.new_tensor_by_constant(sw, 0);
+    Tensor gx = dev.new_tensor_by_constant(sx, 0);
+    Tensor gb = dev.new_tensor_by_constant({2 * n}, 0);
+
+    const Tensor u = dev.matmul_fw(w, x);
+    Tensor h, cs;
+    dev.sru_fw(x, u, b, h, cs);
+    Tensor gu = dev.new_tensor_by_constant(su, 0);
+    suite.run("sru_fw", s, [&] {
+        Tensor h2, c2;
+        dev.sru_fw(x, dev.matmul_fw(w, x), b, h2, c2);
+    });
+    suite.run("sru_bw", s, [&] {
+        gu.reset(0);
+        dev.sru_bw(x, u, b, cs, gh, gc, gx, gu, gb);
+        dev.matmul_bw(w, x, u, gu, gw, gx);
+    });
+
+    // Intermediate values of the unfused computation.
+    const Tensor ug = dev.slice_fw(u, 0, 0, n);
+    const Tensor ufr = dev.slice_fw(u, 0, n, 3 * n);
+    const Tensor bb = dev.broadcast_fw(b, 1, len);
+    const Tensor a = dev.add_fw(ufr, bb);
+    const Tensor fr = dev.sigmoid_fw(a);
+    const Tensor f = dev.slice_fw(fr, 0, 0, n);
+    const Tensor r = dev.slice_fw(fr, 0, n, 2 * n);
+    vector<Tensor> ft, ut, dt, fdt, ct;
+    for (std::uint32_t i = 0; i < len; ++i) {
+      ft.emplace_back(dev.slice_fw(f, 1, i, i + 1));
+      ut.emplace_back(dev.slice_fw(ug, 1, i, i + 1));
+      dt.emplace_back(dev.subtract_fw(i == 0 ? c0 : ct[i - 1], ut[i]));
+      fdt.emplace_back(dev.multiply_fw(ft[i], dt[i]));
+      ct.emplace_back(dev.add_fw(ut[i], fdt[i]));
+    }
+    vector<const Tensor *> pct;
+    for (const Tensor &t : ct) pct.emplace_back(&t);
+    const Tensor cc = dev.concat_fw(pct, 1);
+    const Tensor tc = dev.tanh_fw(cc);
+    const Tensor e = dev.subtract_fw(tc, x);
+    const Tensor re = dev.multiply_fw(r, e);
+    const Tensor hh = dev.add_fw(x, re);
+    Tensor gre = dev.new_tensor_by_constant(sx, 0);
+    Tensor gr = dev.new_tensor_by_constant(sx, 0);
+    Tensor ge = dev.new_tensor_by_constant(sx, 0);
+    Tensor gtc = dev.new_tensor_by_constant(sx, 0);
+    Tensor gcc = dev.new_tensor_by_constant(sx, 0);
+    Tensor gf = dev.new_tensor_by_constant(sx, 0);
+    Tensor gug = dev.new_tensor_by_constant(sx, 0);
+    Tensor gfr = dev.new_tensor_by_constant(sg, 0);
+    Tensor ga = dev.new_tensor_by_constant(sg, 0);
+    Tensor gufr = dev.new_tensor_by_constant(sg, 0);
+    Tensor gbb = dev.new_tensor_by_constant({2 * n, len}, 0);
+    suite.run("sru_unfused_fw", s, [&] {
+        const Tensor u = dev.matmul_fw(w, x);
+        const Tensor ug = dev.slice_fw(u, 0, 0, n);
+        const Tensor fr = dev.sigmoid_fw(dev.add_fw(
+              dev.slice_fw(u, 0, n, 3 * n), dev.broadcast_fw(b, 1, len)));
+        const Tensor f = dev.slice_fw(fr, 0, 0, n);
+        vector<Tensor> ct;
+        for (std::uint32_t i = 0; i < len; ++i) {
+          const Tensor ut = dev.slice_fw(ug, 1, i, i + 1);
+          ct.emplace_back(dev.add_fw(ut, dev.multiply_fw(
+                  dev.slice_fw(f, 1, i, i + 1),
+                  dev.subtract_fw(i == 0 ? c0 : ct[i - 1], ut))));
+        }
+        vector<const Tensor *> pct;
+        for (const Tensor &t : ct) pct.emplace_back(&t);
+        const Tensor tc = dev.tanh_fw(dev.concat_fw(pct, 1));
+        dev.add_fw(x, dev.multiply_fw(
+              dev.slice_fw(fr, 0, n, 2 * n), dev.subtract_fw(tc, x)));
+    });
+    suite.run("sru_unfused_bw", s, [&] {
+        for (Tensor *t : {
+            &gu, &gre, &gr, &ge, &gtc, &gf, &gug, &gfr, &ga, &gufr, &gbb}) {
+          t->reset(0);
+        }
+        dev.copy_tensor(gc, gcc);
+        dev.add_bw(x, re, hh, gh, gx, gre);
+        dev.multiply_bw(r, e, re, gre, gr, ge);
+        dev.subtract_bw(tc, x, e, ge, gtc, gx);
+        dev.tanh_bw(cc, tc, gtc, gcc);
+        // Gradients of c[t] are propagated to c[t-1] in the reverse order.
+        Tensor gct = dev.slice_fw(gcc, 1, len - 1, len);
+        for (std::uint32_t i = len; i-- > 0; ) {
+          Tensor gut = dev.new_tensor_by_constant(sc, 0);
+          Tensor gfdt = dev.new_tensor_by_constant(sc, 0);
+          Tensor gft = dev.new_tensor_by_constant(sc, 0);
+          Tensor gdt = dev.new_tensor_by_constant(sc, 0);
+          Tensor gprev = i == 0
+            ? dev.new_tensor_by_constant(sc, 0)
+            : dev.slice_fw(gcc, 1, i - 1, i);
+          dev.add_bw(ut[i], fdt[i], ct[i], gct, gut, gfdt);
+          dev.multiply_bw(ft[i], dt[i], fdt[i], gfdt, gft, gdt);
+          dev.subtract_bw(
+              i == 0 ? c0 : ct[i - 1], ut[i], dt[i], gdt, gprev, gut);
+          dev.slice_bw(gft, 1, i, gf);
+          dev.slice_bw(gut, 1, i, gug);
+          gct = gprev;
+        }
+        dev.slice_bw(gf, 0, 0, gfr);
+        dev.slice_bw(gr, 0, n, gfr);
+        dev.sigmoid_bw(a, fr, gfr, ga);
+        dev.add_bw(ufr, bb, a, ga, gufr, gbb);
+        dev.inplace_add(dev.sum_fw(gbb, 1), gb);
+        dev.slice_bw(gug, 0, 0, gu);
+        dev.slice_bw(gufr, 0, n, gu);
+        dev.matmul_bw(w, x, u, gu, gw, gx);
+    });
+  }
+}
+
+void run_elementwise_program(Device &dev, Suite &suite) {
+  // y = tanh(a * b + c)
+  using Opcode = ElementwiseProgram::Opcode;
+  ElementwiseProgram program(3);
+  const std::uint32_t ab = program.add_instruction(Opcode::MULTIPLY, 0, 1);
+  const std::uint32_t abc = program.add_instruction(Opcode::ADD, ab, 2);
+  program.add_instruction(Opcode::TANH, abc);
+
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    const string s = shape.to_string();
+    const Tensor a = make_input(dev, shape);
+    const Tensor b = make_input(dev, shape);
+    const Tensor c = make_input(dev, shape);
+    const vector<const Tensor *> xs {&a, &b, &c};
+    Tensor ga = dev.new_tensor_by_constant(shape, 0);
+    Tensor gb = dev.new_tensor_by_constant(shape, 0);
+    Tensor gc = dev.new_tensor_by_constant(shape, 0);
+    const vector<Tensor *> gxs {&ga, &gb, &gc};
+    const Tensor gy = make_input(dev, shape);
+    Tensor y;
+    if (dev.supports_elementwise_fusion()) y = dev.elementwise_fw(program, xs);
+    suite.run("elementwise_fw", s, [&] { dev.elementwise_fw(program, xs); });
+    suite.run("elementwise_bw", s, [&] {
+        dev.elementwise_bw(program, xs, y, gy, gxs);
+    });
+
+    // The same computation by separate operations for comparison.
+    const Tensor u_ab = dev.multiply_fw(a, b);
+    const Tensor u_abc = dev.add_fw(u_ab, c);
+    const Tensor u_y = dev.tanh_fw(u_abc);
+    Tensor g_ab = dev.new_tensor_by_constant(shape, 0);
+    Tensor g_abc = dev.new_tensor_by_constant(shape, 0);
+    suite.run("elementwise_unfused_fw", s, [&] {
+        dev.tanh_fw(dev.add_fw(dev.multiply_fw(a, b), c));
+    });
+    suite.run("elementwise_unfused_bw", s, [&] {
+        g_abc.reset(0);
+        g_ab.reset(0);
+        dev.tanh_bw(u_abc, u_y, gy, g_abc);
+        dev.add_bw(u_ab, c, u_abc, g_abc, g_ab, gc);
+        dev.multiply_bw(a, b, u_ab, g_ab, ga, gb);
+    });
+  }
+}
+
+void run_inplace(Device &dev, Suite &suite) {
+  for (const Shape &shape : ELEMENTWISE_SHAPES) {
+    const string s = shape.to_string();
+    const Tensor x = make_input(dev, shape);
+    Tensor y = make_input(dev, shape);
+    suite.run("inplace_multiply_const", s, [&] {
+        dev.inplace_multiply_const(1.f, y);
+    });
+    suite.run("inplace_add", s, [&] { dev.inplace_add(x, y); });
+    suite.run("inplace_subtract", s, [&] { dev.inplace_subtract(x, y); });
+  }
+}
+
+void run_optimizer_update(Device &dev, Suite &suite) {
+  // One large parameter, and many small parameters updated in one call.
+  const vector<vector<Shape>> param_shapes {
+    {{256, 256}}, vector<Shape>(64, {64}),
+  };
+  for (const vector<Shape> &shapes : param_shapes) {
+    const string s =
+      std::to_string(shapes.size()) + "*" + shapes[0].to_string();
+    vector<Tensor> gs, xs, m1s, m2s;
+    for (const Shape &shape : shapes) {
+      gs.emplace_back(make_input(dev, shape));
+      xs.emplace_back(make_input(dev, shape));
+      m1s.emplace_back(make_input(dev, shape));
+      m2s.emplace_back(make_input(dev, shape));
+    }
+    vector<const Tensor *> pgs;
+    vector<Tensor *> pxs, pm1s, pm2s;
+    for (std::uint32_t i = 0; i < shapes.size(); ++i) {
+      pgs.emplace_back(&gs[i]);
+      pxs.emplace_back(&xs[i]);
+      pm1s.emplace_back(&m1s[i]);
+      pm2s.emplace_back(&m2s[i]);
+    }
+    suite.run("squared_norm", s, [&] { dev.squared_norm(pgs); });
+    suite.run("sgd_update", s, [&] { dev.sgd_update(pgs, 1e-3, pxs); });
+    suite.run("momentum_sgd_update", s, [&] {
+        dev.momentum_sgd_update(pgs, 1e-3, .9, pxs, pm1s);
+    });
+    suite.run("adagrad_update", s, [&] {
+        dev.adagrad_update(pgs, 1e-3, 1e-8, pxs, pm1s);
+    });
+    suite.run("rmsprop_update", s, [&] {
+        dev.rmsprop_update(pgs, 1e-3, .9, 1e-8, pxs, pm1s);
+    });
+    suite.run("adadelta_update", s, [&] {
+        dev.adadelta_update(pgs, 1, .95, 1e-6, pxs, pm1s, pm2s);
+    });
+    suite.run("adam_update", s, [&] {
+        dev.adam_update(pgs, 1e-3, .9, .999, 1e-8, 1, pxs, pm1s, pm2s);
+    });
+  }
+}
+
+void run_device(
+    Device &dev, const string &device_name,
+    const Options &opts, vector<Result> &results) {
+  Suite suite(device_name, opts, results);
+  run_unary(dev, suite);
+  run_const(dev, suite);
+  run_scalar(dev, suite);
+  run_binary(dev, suite);
+  run_manipulation(dev, suite);
+  run_dimension(dev, suite);
+  run_batch(dev, suite);
+  run_convolution(dev, suite);
+  run_attention(dev, suite);
+  run_lstm(dev, suite);
+  run_gru(dev, suite);
+  run_sru(dev, suite);
+  run_elementwise_program(dev, suite);
+  run_inplace(dev, suite);
+  run_optimizer_update(dev, suite);
+}
+
+void print_json(
+    const Options &opts, const vector<Result> &results, std::ostream &os) {
+  os << "{\n";
+  os << "  \"min_time\": " << opts.min_time << ",\n";
+  os << "  \"threads\": " << opts.num_threads << ",\n";
+  os << std::fixed << std::setprecision(1);
+  os << "  \"results\": [";
+  for (std::uint32_t i = 0; i < results.size(); ++i) {
+    const Result &r = results[i];
+    os << (i == 0 ? "\n" : ",\n");
+    os << "    {\"device\": \"" << r.device
+       << "\", \"operation\": \"" << r.operation
+       << "\", \"shape\": \"" << r.shape
+       << "\", \"supported\": " << (r.supported ? "true" : "false")
+       << ", \"iterations\": " << r.iterations
+       << ", \"mean_ns\": " << r.mean_ns
+       << ", \"min_ns\": " << r.min_ns << "}";
+  }
+  os << "\n  ]\n";
+  os << "}\n";
+}
+
+[[noreturn]] void usage(const char *prog) {
+  std::cerr << "Usage: " << prog
+            << " [--filter PATTERN] [--min-time SECONDS] [--threads N]"
+            << std::endl;
+  std::exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options opts {"", .2, 1};
+  for (int i = 1; i < argc; ++i) {
+    if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+      opts.filter = argv[++i];
+    } else if (!std::strcmp(argv[i], "--min-time") && i + 1 < argc) {
+      opts.min_time = std::atof(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) {
+      opts.num_threads = std::atoi(argv[++i]);
+    } else {
+      usage(argv[0]);
+    }
+  }
+
+  vector<Result> results;
+  try {
+    {
+      primitiv::devices::Naive dev(0, true, opts.num_threads);
+      run_device(dev, "Naive", opts, results);
+    }
+#ifdef PRIMITIV_USE_EIGEN
+    {
+      primitiv::devices::Eigen dev(0, true, opts.num_threads);
+      run_device(dev, "Eigen", opts, results);
+    }
+#endif  // PRIMITIV_USE_EIGEN
+  } catch (const std::exception &ex) {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
+
+  print_json(opts, results, std::cout);
+  return 0;
+}
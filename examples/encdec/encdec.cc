@@ -60,7 +60,7 @@ class EncoderDecoder : public Model {
   float dropout_rate_;
   Parameter psrc_lookup_, ptrg_lookup_, pwhy_, pby_;
   ::LSTM<Var> src_lstm_, trg_lstm_;
-  Var trg_lookup_, why_, by_;
+  Var why_, by_;
 
 public:
   EncoderDecoder() : dropout_rate_(DROPOUT_RATE) {
@@ -89,16 +89,14 @@ public:
   // Encodes source sentences and prepare internal states.
   void encode(const vector<vector<unsigned>> &src_batch, bool train) {
     // Reversed encoding.
-    Var src_lookup = F::parameter<Var>(psrc_lookup_);
     src_lstm_.restart();
     for (auto it = src_batch.rbegin(); it != src_batch.rend(); ++it) {
-      Var x = F::pick(src_lookup, *it, 1);
+      Var x = F::lookup<Var>(psrc_lookup_, *it, 1);
       x = F::dropout(x, dropout_rate_, train);
       src_lstm_.forward(x);
     }
 
     // Initializes decoder states.
-    trg_lookup_ = F::parameter<Var>(ptrg_lookup_);
     why_ = F::parameter<Var>(pwhy_);
     by_ = F::parameter<Var>(pby_);
     trg_lstm_.restart(src_lstm_.get_c(), src_lstm_.get_h());
@@ -106,7 +104,7 @@ public:
 
   // One step decoding.
   Var decode_step(const vector<unsigned> &trg_words, bool train) {
-    Var x = F::pick(trg_lookup_, trg_words, 1);
+    Var x = F::lookup<Var>(ptrg_lookup_, trg_words, 1);
     x = F::dropout(x, dropout_rate_, train);
     Var h = trg_lstm_.forward(x);
     h = F::dropout(h, dropout_rate_, train);
@@ -64,7 +64,7 @@ class AttentionalEncoderDecoder : public Model {
   float dropout_rate_;
   Parameter psrc_lookup_, ptrg_lookup_, pwhj_, pbj_, pwjy_, pby_;
   ::LSTM<Var> src_fw_lstm_, src_bw_lstm_, trg_lstm_;
-  Var trg_lookup_, whj_, bj_, wjy_, by_, concat_fb_, t_concat_fb_, feed_;
+  Var whj_, bj_, wjy_, by_, concat_fb_, feed_;
 
 public:
   AttentionalEncoderDecoder() : dropout_rate_(DROPOUT_RATE) {
@@ -98,11 +98,11 @@ public:
   // Encodes source sentences and prepares internal states.
   void encode(const vector<vector<unsigned>> &src_batch, bool train) {
     // Embedding lookup.
-    const Var src_lookup = F::parameter<Var>(psrc_lookup_);
     vector<Var> e_list;
     for (const auto &x : src_batch) {
       e_list.emplace_back(
-          F::dropout(F::pick(src_lookup, x, 1), dropout_rate_, train));
+          F::dropout(
+            F::lookup<Var>(psrc_lookup_, x, 1), dropout_rate_, train));
     }
 
     // Forward encoding.
@@ -128,11 +128,9 @@ public:
       fb_list.emplace_back(f_list[i] + b_list[i]);
     }
     concat_fb_ = F::concat(fb_list, 1);
-    t_concat_fb_ = F::transpose(concat_fb_);
 
     // Initializes decoder states.
     const unsigned embed_size = psrc_lookup_.shape()[0];
-    trg_lookup_ = F::parameter<Var>(ptrg_lookup_);
     whj_ = F::parameter<Var>(pwhj_);
     bj_ = F::parameter<Var>(pbj_);
     wjy_ = F::parameter<Var>(pwjy_);
@@ -145,12 +143,11 @@ public:
 
   // One step decoding.
   Var decode_step(const vector<unsigned> &trg_words, bool train) {
-    Var e = F::pick(trg_lookup_, trg_words, 1);
+    Var e = F::lookup<Var>(ptrg_lookup_, trg_words, 1);
     e = F::dropout(e, dropout_rate_, train);
     Var h = trg_lstm_.forward(F::concat({e, feed_}, 0));
     h = F::dropout(h, dropout_rate_, train);
-    const Var atten_probs = F::softmax(F::matmul(t_concat_fb_, h), 0);
-    const Var c = F::matmul(concat_fb_, atten_probs);
+    const Var c = F::attention(h, concat_fb_, concat_fb_, 1);
     feed_ = F::tanh(F::matmul(whj_, F::concat({h, c}, 0)) + bj_);
     return F::matmul(wjy_, feed_) + by_;
   }
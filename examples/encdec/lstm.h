@@ -45,14 +45,10 @@ public:
   // One step forwarding.
   Var forward(const Var &x) {
     namespace F = primitiv::functions;
-    const auto u = F::matmul(w_, F::concat({x, h_}, 0)) + b_;
-    const std::vector<Var> v = F::split(u, 0, 4);
-    const auto i = F::sigmoid(v[0]);
-    const auto f = F::sigmoid(v[1]);
-    const auto o = F::sigmoid(v[2]);
-    const auto j = F::tanh(v[3]);
-    c_ = i * j + f * c_;
-    h_ = o * F::tanh(c_);
+    const auto u = F::matmul(w_, F::concat({x, h_}, 0));
+    const std::vector<Var> hc = F::lstm_cell(u, b_, c_);
+    h_ = hc[0];
+    c_ = hc[1];
     return h_;
   }
 
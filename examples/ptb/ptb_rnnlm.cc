@@ -60,13 +60,12 @@ public:
   // };
   vector<Node> forward(const vector<vector<unsigned>> &inputs) {
     const unsigned batch_size = inputs[0].size();
-    Node wlookup = F::parameter<Node>(pwlookup_);
     Node wxs = F::parameter<Node>(pwxs_);
     Node wsy = F::parameter<Node>(pwsy_);
     Node s = F::zeros<Node>(Shape({NUM_HIDDEN_UNITS}, batch_size));
     vector<Node> outputs;
     for (unsigned i = 0; i < inputs.size() - 1; ++i) {
-      Node w = F::pick(wlookup, inputs[i], 1);
+      Node w = F::lookup<Node>(pwlookup_, inputs[i], 1);
       Node x = w + s;
       Node s = F::sigmoid(F::matmul(wxs, x));
       outputs.emplace_back(F::matmul(wsy, s));
@@ -98,14 +98,10 @@ public:
 
   // Forward one step.
   Var forward(const Var &x) {
-    const Var u = F::matmul(w_, F::concat({x, h_}, 0)) + b_;
-    const std::vector<Var> v = F::split(u, 0, 4);
-    const Var i = F::sigmoid(v[0]);
-    const Var f = F::sigmoid(v[1]);
-    const Var o = F::sigmoid(v[2]);
-    const Var j = F::tanh(v[3]);
-    c_ = i * j + f * c_;
-    h_ = o * F::tanh(c_);
+    const Var u = F::matmul(w_, F::concat({x, h_}, 0));
+    const std::vector<Var> hc = F::lstm_cell(u, b_, c_);
+    h_ = hc[0];
+    c_ = hc[1];
     return h_;
   }
 };
@@ -137,14 +133,13 @@ public:
   //   {sent1_wordM, sent2_wordM, ..., sentN_wordM},  // last output (<eos>)
   // };
   vector<Var> forward(const vector<vector<unsigned>> &inputs, bool train) {
-    Var lookup = F::parameter<Var>(plookup_);
     rnn1_.init();
     rnn2_.init();
     hy_.init();
 
     vector<Var> outputs;
     for (unsigned i = 0; i < inputs.size() - 1; ++i) {
-      Var x = F::pick(lookup, inputs[i], 1);
+      Var x = F::lookup<Var>(plookup_, inputs[i], 1);
       x = F::dropout(x, DROPOUT_RATE, train);
       Var h1 = rnn1_.forward(x);
       h1 = F::dropout(h1, DROPOUT_RATE, train);
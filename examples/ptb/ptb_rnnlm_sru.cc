@@ -75,14 +75,12 @@ public:
 //   h[t] = r[t] * tanh(c[t]) + (1 - r[t]) * x[t]
 template <typename Var>
 class SRU : public Model {
-  unsigned out_size_;
   Parameter pw_, pbf_, pbr_;
   Var w_, bf_, br_;
 
 public:
   SRU(unsigned in_size, unsigned out_size)
-    : out_size_(out_size)
-    , pw_({3 * out_size, in_size}, Uniform(-0.1, 0.1))
+    : pw_({3 * out_size, in_size}, Uniform(-0.1, 0.1))
     , pbf_({out_size}, Constant(0))
     , pbr_({out_size}, Constant(0)) {
       add("pw", pw_);
@@ -99,21 +97,11 @@ public:
 
   // Forward.
   std::vector<Var> forward(const std::vector<Var> &xs) {
+    // The whole recurrence is calculated by one operator.
     const Var x = F::concat(xs, 1);
     const Var u = F::matmul(w_, x);
-    const std::vector<Var> v = F::split(u, 0, 3);
-    const Var f = F::sigmoid(v[1] + F::broadcast(bf_, 1, xs.size()));
-    const Var r = F::sigmoid(v[2] + F::broadcast(br_, 1, xs.size()));
-    Var c = F::zeros<Var>({out_size_});
-    std::vector<Var> hs;
-    const std::vector<Var> js = F::split(v[0], 1, xs.size());
-    const std::vector<Var> fs = F::split(f, 1, xs.size());
-    const std::vector<Var> rs = F::split(r, 1, xs.size());
-    for (unsigned i = 0; i < xs.size(); ++i) {
-      c = fs[i] * c + (1 - fs[i]) * js[i];
-      hs.emplace_back(rs[i] * F::tanh(c) + (1 - rs[i]) * xs[i]);
-    }
-    return hs;
+    const std::vector<Var> hc = F::sru(x, u, F::concat({bf_, br_}, 0));
+    return F::split(hc[0], 1, xs.size());
   }
 };
 
@@ -144,7 +132,6 @@ public:
   //   {sent1_wordM, sent2_wordM, ..., sentN_wordM},  // last output (<eos>)
   // };
   vector<Var> forward(const vector<vector<unsigned>> &inputs, bool train) {
-    Var lookup = F::parameter<Var>(plookup_);
     rnn1_.init();
     rnn2_.init();
     hy_.init();
@@ -152,7 +139,8 @@ public:
     vector<Var> xs;
     for (unsigned i = 0; i < inputs.size() - 1; ++i) {
       xs.emplace_back(
-          F::dropout(F::pick(lookup, inputs[i], 1), DROPOUT_RATE, train));
+          F::dropout(
+            F::lookup<Var>(plookup_, inputs[i], 1), DROPOUT_RATE, train));
     }
     vector<Var> hs1 = rnn1_.forward(xs);
     for (unsigned i = 0; i < inputs.size() - 1; ++i) {
@@ -128,6 +128,16 @@ PRIMITIV_C_STATUS primitivApplyTensorInput(
   return PRIMITIV_C_OK;
 } PRIMITIV_C_HANDLE_EXCEPTIONS
 
+PRIMITIV_C_STATUS primitivApplyNodeInputTensor(
+    const primitivTensor_t *x, primitivGraph_t *g,
+    primitivNode_t **newobj) try {
+  PRIMITIV_C_CHECK_NOT_NULL(x);
+  PRIMITIV_C_CHECK_NOT_NULL(newobj);
+  *newobj = to_c_ptr_from_value(
+      primitiv::functions::input_node(*to_cpp_ptr(x), to_cpp_ptr(g)));
+  return PRIMITIV_C_OK;
+} PRIMITIV_C_HANDLE_EXCEPTIONS
+
 PRIMITIV_C_STATUS primitivApplyNodeParameter(
     primitivParameter_t *param, primitivGraph_t *g,
     primitivNode_t **newobj) try {
@@ -556,6 +566,7 @@ PRIMITIV_C_STATUS primitivApplyTensorSoftmaxCrossEntropyWithArray(
 } PRIMITIV_C_HANDLE_EXCEPTIONS
 
 PRIMITIV_C_IMPL_UNARY_FUNC(StopGradient, stop_gradient);
+PRIMITIV_C_IMPL_UNARY_FUNC(Checkpoint, checkpoint);
 
 PRIMITIV_C_STATUS primitivApplyNodeConv2d(
     const primitivNode_t *x, const primitivNode_t *w,
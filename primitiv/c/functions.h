@@ -54,6 +54,9 @@ PRIMITIV_C_API PRIMITIV_C_STATUS primitivApplyTensorInput(
     const primitivShape_t *shape, const float *data, size_t n,
     primitivDevice_t *dev, primitivTensor_t **newobj);
 
+PRIMITIV_C_API PRIMITIV_C_STATUS primitivApplyNodeInputTensor(
+    const primitivTensor_t *x, primitivGraph_t *g, primitivNode_t **newobj);
+
 PRIMITIV_C_API PRIMITIV_C_STATUS primitivApplyNodeParameter(
     primitivParameter_t *param, primitivGraph_t *g, primitivNode_t **newobj);
 PRIMITIV_C_API PRIMITIV_C_STATUS primitivApplyTensorParameter(
@@ -193,6 +196,7 @@ primitivApplyTensorSoftmaxCrossEntropyWithArray(
     primitivTensor_t **y);
 
 PRIMITIV_C_DECL_UNARY_FUNC(StopGradient);
+PRIMITIV_C_DECL_UNARY_FUNC(Checkpoint);
 
 PRIMITIV_C_API PRIMITIV_C_STATUS primitivApplyNodeConv2d(
     const primitivNode_t *x, const primitivNode_t *w,
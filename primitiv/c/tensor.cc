@@ -1,7 +1,9 @@
 #include <primitiv/config.h>
 
+#include <functional>
 #include <vector>
 
+#include <primitiv/core/device.h>
 #include <primitiv/core/tensor.h>
 #include <primitiv/c/internal/internal.h>
 #include <primitiv/c/tensor.h>
@@ -25,6 +27,20 @@ PRIMITIV_C_STATUS primitivCloneTensor(
   return PRIMITIV_C_OK;
 } PRIMITIV_C_HANDLE_EXCEPTIONS
 
+PRIMITIV_C_STATUS primitivCreateTensorByExternalMemory(
+    const primitivShape_t *shape, float *data, void (*deleter)(float *),
+    primitivDevice_t *device, primitivTensor_t **newobj) try {
+  PRIMITIV_C_CHECK_NOT_NULL(shape);
+  PRIMITIV_C_CHECK_NOT_NULL(data);
+  PRIMITIV_C_CHECK_NOT_NULL(newobj);
+  std::function<void(float *)> fn;
+  if (deleter) fn = deleter;
+  *newobj = to_c_ptr_from_value(
+      primitiv::Device::get_reference_or_default(to_cpp_ptr(device))
+      .new_tensor_by_external_memory(*to_cpp_ptr(shape), data, fn));
+  return PRIMITIV_C_OK;
+} PRIMITIV_C_HANDLE_EXCEPTIONS
+
 PRIMITIV_C_STATUS primitivDeleteTensor(primitivTensor_t *tensor) try {
   PRIMITIV_C_CHECK_NOT_NULL(tensor);
   delete to_cpp_ptr(tensor);
@@ -67,8 +83,17 @@ PRIMITIV_C_STATUS primitivEvaluateTensorAsArray(
     const primitivTensor_t *tensor, float *retval, size_t *size) try {
   PRIMITIV_C_CHECK_NOT_NULL(tensor);
   PRIMITIV_C_CHECK_NOT_NULL(size);
-  primitiv::c::internal::copy_vector_to_array(
-      to_cpp_ptr(tensor)->to_vector(), retval, size);
+  const Tensor &x = *to_cpp_ptr(tensor);
+  const std::size_t required = x.shape().size();
+  if (retval) {
+    if (*size < required) {
+      PRIMITIV_THROW_ERROR("Size is not enough to copy a vector.");
+    }
+    // Values are written directly without an intermediate vector.
+    x.to_array(retval);
+  } else {
+    *size = required;
+  }
   return PRIMITIV_C_OK;
 } PRIMITIV_C_HANDLE_EXCEPTIONS
 
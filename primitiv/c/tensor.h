@@ -27,6 +27,24 @@ PRIMITIV_C_API PRIMITIV_C_STATUS primitivCreateTensor(
 PRIMITIV_C_API PRIMITIV_C_STATUS primitivCloneTensor(
     const primitivTensor_t *src, primitivTensor_t **newobj);
 
+/**
+ * Creates a new Tensor object on a host memory provided by the user.
+ * @param shape Pointer of the shape of the new Tensor.
+ * @param data Pointer of a host memory with `shape.size()` values.
+ * @param deleter Function to release `data` with the last copy of the tensor,
+ *                or `NULL` to borrow the memory. If `NULL`, the user should
+ *                keep `data` alive while the tensor is used.
+ * @param device Pointer of a handler of the device, or `NULL` to use the
+ *               default device.
+ * @param newobj Pointer to receive a handler.
+ * @return Status code.
+ * @remarks Values in `data` are not copied. The device should support
+ *          external memories.
+ */
+PRIMITIV_C_API PRIMITIV_C_STATUS primitivCreateTensorByExternalMemory(
+    const primitivShape_t *shape, float *data, void (*deleter)(float *),
+    primitivDevice_t *device, primitivTensor_t **newobj);
+
 /**
  * Deletes the Tensor object.
  * @param tensor Pointer of a handler.
@@ -0,0 +1,51 @@
+#ifndef PRIMITIV_CORE_ALIGNED_MEMORY_H_
+#define PRIMITIV_CORE_ALIGNED_MEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace primitiv {
+namespace aligned_memory {
+
+/**
+ * Default alignment (in bytes) of memory blocks used by CPU devices.
+ * 64 bytes covers one cache line and the widest SIMD register (AVX-512).
+ */
+constexpr std::size_t DEFAULT_ALIGNMENT = 64;
+
+/**
+ * Allocates an aligned memory block on the host.
+ * @param size Size of the memory block in bytes.
+ * @param alignment Alignment of the resulting pointer. This value should be
+ *                  a power of 2 and not less than `sizeof(void *)`.
+ * @return Pointer to the allocated memory, or nullptr if the allocation
+ *         failed.
+ * @remarks The returned pointer should be released by `aligned_memory::free`.
+ */
+inline void *allocate(
+    std::size_t size, std::size_t alignment = DEFAULT_ALIGNMENT) {
+  // The original pointer is stored just before the aligned block so that
+  // `free()` can recover it without any side table.
+  void *base = std::malloc(size + alignment + sizeof(void *));
+  if (!base) return nullptr;
+  const std::uintptr_t raw =
+    reinterpret_cast<std::uintptr_t>(base) + sizeof(void *);
+  const std::uintptr_t aligned = (raw + alignment - 1) & ~(alignment - 1);
+  void *ptr = reinterpret_cast<void *>(aligned);
+  reinterpret_cast<void **>(ptr)[-1] = base;
+  return ptr;
+}
+
+/**
+ * Releases the memory block allocated by `aligned_memory::allocate`.
+ * @param ptr Pointer to the memory block. nullptr is ignored.
+ */
+inline void free(void *ptr) {
+  if (ptr) std::free(reinterpret_cast<void **>(ptr)[-1]);
+}
+
+}  // namespace aligned_memory
+}  // namespace primitiv
+
+#endif  // PRIMITIV_CORE_ALIGNED_MEMORY_H_
@@ -272,6 +272,39 @@ inline type_traits::Identity<Var> input(
   return input<Var>(shape, data, nullptr);
 }
 
+/**
+ * Creates a new Node from an existing Tensor.
+ * @param x A tensor which holds values of the new Node.
+ * @param g Graph to manage the instance of the Node, or `nullptr` to use the
+ *          default graph.
+ * @return A new Node.
+ * @remarks The Node shares the internal memory of `x` without copying values,
+ *          e.g., a tensor made by `Device::new_tensor_by_external_memory()`
+ *          can be used in the graph directly.
+ */
+Node input_node(const Tensor &x, Graph *g);
+
+/**
+ * Creates a new variable from an existing Tensor.
+ * @param x A tensor which holds values of the new variable.
+ * @return A new variable.
+ * @remarks The resulting variable shares the internal memory of `x`.
+ *          This function uses the default graph when specifying Node as the
+ *          template variable.
+ */
+template<typename Var>
+type_traits::Identity<Var> input(const Tensor &x);
+
+/// @cond
+
+template<>
+inline Tensor input<Tensor>(const Tensor &x) { return x; }
+
+template<>
+inline Node input<Node>(const Tensor &x) { return input_node(x, nullptr); }
+
+/// @endcond
+
 /**
  * Creates a new Tensor from a specific Parameter.
  * @param param Parameter to be associated with the Tensor.
@@ -312,6 +345,64 @@ inline Node parameter<Node>(Parameter &param) {
 
 /// @endcond
 
+/**
+ * Picks rows of a Parameter as a new Tensor.
+ * @param param Parameter to be looked up.
+ * @param ids List of row IDs along the dimension `dim`.
+ * @param dim Dimension along which rows are selected.
+ * @return A new Tensor.
+ */
+Tensor lookup_tensor(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim);
+
+/**
+ * Picks rows of a Parameter as a new Node.
+ * @param param Parameter to be looked up.
+ * @param ids List of row IDs along the dimension `dim`.
+ * @param dim Dimension along which rows are selected.
+ * @param g Graph to manage the instance of the Node, or `nullptr` to use the
+ *          default graph.
+ * @return A new Node.
+ */
+Node lookup_node(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim,
+    Graph *g);
+
+/**
+ * Picks rows of a Parameter, e.g., embeddings of words.
+ * This function calculates the same value as
+ * `pick(parameter<Var>(param), ids, dim)`, but the gradient is stored into the
+ * Parameter as sparse rows. Optimizers then update only rows in `ids`.
+ * @param param Parameter to be looked up.
+ * @param ids List of row IDs along the dimension `dim`.
+ * @param dim Dimension along which rows are selected.
+ * @return A new variable.
+ * @remarks This function uses the default graph when specifying Node as the
+ *          template variable.
+ * @remarks Optimizers with statistics (e.g., Adam) also update statistics of
+ *          only rows in `ids`, i.e., statistics of other rows are not decayed
+ *          in that step.
+ */
+template<typename Var>
+type_traits::Identity<Var> lookup(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim);
+
+/// @cond
+
+template<>
+inline Tensor lookup<Tensor>(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim) {
+  return lookup_tensor(param, ids, dim);
+}
+
+template<>
+inline Node lookup<Node>(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim) {
+  return lookup_node(param, ids, dim, nullptr);
+}
+
+/// @endcond
+
 /**
  * Copies a variable onto a specific device.
  * @param x A variable to be copied.
@@ -427,6 +518,9 @@ type_traits::Identity<Var> pick(
  * @param lower Lower bound \f$ L \f$ of ``dim``.
  * @param upper Upper bound \f$ U \f$ of ``dim``.
  * @return A new variable.
+ * @remarks The result shares the memory of ``x`` only if the device supports
+ *          tensor views and ``x`` has neither a minibatch nor dimensions
+ *          higher than ``dim``. Otherwise values are copied.
  */
 template<typename Var>
 type_traits::Identity<Var> slice(
@@ -443,6 +537,9 @@ type_traits::Identity<Var> slice(
  *         where ``L(i) := i * x.shape()[dim] / n``
  *         and ``U(i) := (i + 1) * x.shape()[dim] / n``.
  * @throw primitiv::Error ``n`` can not divide ``s.shape()[dim]`` without residue.
+ * @remarks Each partition is copied under the same conditions as ``slice()``,
+ *          e.g., splitting the gates of a minibatched LSTM preactivation
+ *          along dim 0 copies values.
  */
 template<typename Var>
 std::vector<type_traits::Identity<Var>> split(
@@ -988,6 +1085,18 @@ type_traits::Identity<Var> softmax_cross_entropy(
 template<typename Var>
 type_traits::Identity<Var> stop_gradient(const Var &x);
 
+/**
+ * Marks a boundary of segments for the gradient checkpointing.
+ * This function does not modify any values and gradients, but the computation
+ * graph retains only the values of checkpoints: other intermediate values are
+ * released during the forward calculation and recalculated segment by segment
+ * in the backward calculation.
+ * @param x A variable representing original values.
+ * @return A new variable.
+ */
+template<typename Var>
+type_traits::Identity<Var> checkpoint(const Var &x);
+
 /**
  * Applies a 2D convolution between two variables.
  * @param x A variable with Shape \f$ [d_0, d_1, c_1] \f$.
@@ -1033,6 +1142,128 @@ type_traits::Identity<Var> max_pool2d(
     std::uint32_t padding0, std::uint32_t padding1,
     std::uint32_t stride0, std::uint32_t stride1);
 
+/**
+ * Calculates one step of the LSTM cell.
+ * @param u A variable with Shape \f$ [4n] \f$ representing preactivations
+ *          of the input, forget and output gates and the cell input, in this
+ *          order (e.g., `matmul(w, concat({x, h}, 0))`).
+ * @param b A variable with Shape \f$ [4n] \f$ representing biases of `u`.
+ * @param c A variable with Shape \f$ [n] \f$ representing the previous cell
+ *          state.
+ * @return A list of two variables with Shape \f$ [n] \f$: the new hidden
+ *         state \f$ h \f$ and the new cell state \f$ c' \f$.
+ * @remarks This function calculates:
+ * @f[
+ *  \begin{array}{rcl}
+ *    a & := & u + b, \\
+ *    i, f, o & := & \mathrm{sigmoid}(a_{0:n}), \mathrm{sigmoid}(a_{n:2n}),
+ *      \mathrm{sigmoid}(a_{2n:3n}), \\
+ *    j & := & \tanh(a_{3n:4n}), \\
+ *    c' & := & i \odot j + f \odot c, \\
+ *    h & := & o \odot \tanh(c'),
+ *  \end{array}
+ * @f]
+ *          with one pass over the memory for both forward and backward
+ *          calculations.
+ */
+template<typename Var>
+std::vector<type_traits::Identity<Var>> lstm_cell(
+    const Var &u, const Var &b, const Var &c);
+
+/**
+ * Calculates one step of the GRU cell.
+ * @param ux A variable with Shape \f$ [3n] \f$ representing preactivations
+ *           of the reset and update gates and the candidate calculated from
+ *           the input, in this order (e.g., `matmul(wx, x) + bx`).
+ * @param uh A variable with Shape \f$ [3n] \f$ representing preactivations
+ *           calculated from the previous state (e.g., `matmul(wh, h) + bh`).
+ * @param h A variable with Shape \f$ [n] \f$ representing the previous
+ *          hidden state.
+ * @return A new variable with Shape \f$ [n] \f$ representing the new hidden
+ *         state.
+ * @remarks This function calculates:
+ * @f[
+ *  \begin{array}{rcl}
+ *    r & := & \mathrm{sigmoid}(u^x_{0:n} + u^h_{0:n}), \\
+ *    z & := & \mathrm{sigmoid}(u^x_{n:2n} + u^h_{n:2n}), \\
+ *    j & := & \tanh(u^x_{2n:3n} + r \odot u^h_{2n:3n}), \\
+ *    h' & := & (1 - z) \odot j + z \odot h,
+ *  \end{array}
+ * @f]
+ *          with one pass over the memory for both forward and backward
+ *          calculations.
+ */
+template<typename Var>
+type_traits::Identity<Var> gru_cell(const Var &ux, const Var &uh, const Var &h);
+
+/**
+ * Calculates the whole sequence of the simple recurrent unit (SRU).
+ * @param x A variable with Shape \f$ [n, T] \f$ representing the input
+ *          sequence, one step per column.
+ * @param u A variable with Shape \f$ [3n, T] \f$ representing the
+ *          candidates and preactivations of the forget and reset gates, in
+ *          this order (e.g., `matmul(w, x)`).
+ * @param b A variable with Shape \f$ [2n] \f$ representing biases of the
+ *          forget and reset gates.
+ * @return A list of two variables with Shape \f$ [n, T] \f$: the hidden
+ *         states \f$ h \f$ and the cell states \f$ c \f$.
+ * @remarks This function calculates for each step \f$ t \f$:
+ * @f[
+ *  \begin{array}{rcl}
+ *    f_t & := & \mathrm{sigmoid}(u_{n:2n, t} + b_{0:n}), \\
+ *    r_t & := & \mathrm{sigmoid}(u_{2n:3n, t} + b_{n:2n}), \\
+ *    c_t & := & f_t \odot c_{t-1} + (1 - f_t) \odot u_{0:n, t}, \\
+ *    h_t & := & r_t \odot \tanh(c_t) + (1 - r_t) \odot x_t,
+ *  \end{array}
+ * @f]
+ *          where \f$ c_{-1} = 0 \f$. The recurrence is calculated by one
+ *          operator instead of a graph with \f$ O(T) \f$ nodes.
+ */
+template<typename Var>
+std::vector<type_traits::Identity<Var>> sru(
+    const Var &x, const Var &u, const Var &b);
+
+/**
+ * Calculates the scaled dot-product attention.
+ * @param q A variable with Shape \f$ [d, m] \f$ representing queries, one
+ *          query per column.
+ * @param k A variable with Shape \f$ [d, n] \f$ representing keys, one key
+ *          per column.
+ * @param v A variable with Shape \f$ [e, n] \f$ representing values, one
+ *          value per column.
+ * @param scale Scaling factor of dot products (e.g., \f$ 1/\sqrt{d} \f$).
+ * @return A new variable with Shape \f$ [e, m] \f$ representing attended
+ *         values.
+ * @remarks This function calculates
+ *          \f$ v \cdot \mathrm{softmax}(\alpha k^\top q) \f$, where the
+ *          softmax is applied along the first dimension. The probability
+ *          matrix is not stored for the backward calculation.
+ */
+template<typename Var>
+type_traits::Identity<Var> attention(
+    const Var &q, const Var &k, const Var &v, float scale);
+
+/**
+ * Calculates the masked scaled dot-product attention.
+ * @param q A variable with Shape \f$ [d, m] \f$ representing queries, one
+ *          query per column.
+ * @param k A variable with Shape \f$ [d, n] \f$ representing keys, one key
+ *          per column.
+ * @param v A variable with Shape \f$ [e, n] \f$ representing values, one
+ *          value per column.
+ * @param mask A variable with Shape \f$ [n, m] \f$ added to attention
+ *             scores. Keys can be excluded by large negative values.
+ * @param scale Scaling factor of dot products (e.g., \f$ 1/\sqrt{d} \f$).
+ * @return A new variable with Shape \f$ [e, m] \f$ representing attended
+ *         values.
+ * @remarks This function calculates
+ *          \f$ v \cdot \mathrm{softmax}(\alpha k^\top q + mask) \f$,
+ *          where the softmax is applied along the first dimension.
+ */
+template<typename Var>
+type_traits::Identity<Var> attention(
+    const Var &q, const Var &k, const Var &v, const Var &mask, float scale);
+
 namespace batch {
 
 /**
@@ -1052,6 +1283,8 @@ type_traits::Identity<Var> pick(
  * @param lower Lower bound \f$ L \f$ of the batch.
  * @param upper Upper bound \f$ U \f$ of the batch.
  * @return A new variable.
+ * @remarks The result shares the memory of ``x`` if the device supports
+ *          tensor views.
  */
 template<typename Var>
 type_traits::Identity<Var> slice(
@@ -1,8 +1,15 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+#include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
 #include <primitiv/core/device.h>
 #include <primitiv/core/error.h>
 #include <primitiv/core/shape_ops.h>
+#include <primitiv/core/tensor_expression.h>
 
 using std::vector;
 
@@ -17,25 +24,125 @@ using std::vector;
 
 namespace primitiv {
 
+namespace {
+
+// Total size of memory obtained by the current thread.
+thread_local std::uint64_t thread_allocated_bytes = 0;
+
+// Checks arguments of optimizer updates.
+void check_update_args(
+    const Device &dev, const vector<const Tensor *> &gs,
+    std::initializer_list<const vector<Tensor *> *> states) {
+  for (const vector<Tensor *> *ts : states) {
+    if (ts->size() != gs.size()) {
+      PRIMITIV_THROW_ERROR(
+          "Number of tensors mismatched. gs.size(): " << gs.size()
+          << " != " << ts->size());
+    }
+  }
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    if (&gs[i]->device() != &dev) {
+      PRIMITIV_THROW_ERROR(
+          "Device mismatched. &gs[" << i << "]->device(): "
+          << &gs[i]->device() << " != this: " << &dev);
+    }
+    const Shape sg = gs[i]->shape();
+    for (const vector<Tensor *> *ts : states) {
+      const Tensor &t = *(*ts)[i];
+      if (&t.device() != &dev) {
+        PRIMITIV_THROW_ERROR(
+            "Device mismatched. &t.device(): " << &t.device()
+            << " != this: " << &dev);
+      }
+      if (t.shape() != sg) {
+        PRIMITIV_THROW_ERROR(
+            "Shape mismatched at the optimizer update"
+            << ". gs[" << i << "].shape: " << sg.to_string()
+            << " != " << t.shape().to_string());
+      }
+    }
+  }
+}
+
+}  // namespace
+
+std::uint64_t Device::get_thread_allocated_bytes() {
+  return thread_allocated_bytes;
+}
+
+void Device::reserve_memory_arena(std::size_t size) {
+  if (!supports_memory_arena()) {
+    PRIMITIV_THROW_ERROR(
+        "Device " << this << " does not support memory arenas.");
+  }
+  if (arena_ && arena_->size() >= size && !arena_->in_use()) return;
+  placements_.clear();
+  arena_.reset();
+  if (size == 0) return;
+  const std::uint32_t num_elements = (size + sizeof(float) - 1) / sizeof(float);
+  arena_.reset(new MemoryArena(
+        new_handle(Shape({num_elements})), sizeof(float) * num_elements));
+}
+
+void Device::release_memory_arena() {
+  placements_.clear();
+  arena_.reset();
+}
+
+bool Device::place_next_tensor(std::size_t offset, std::uint32_t size) {
+  if (!arena_) {
+    PRIMITIV_THROW_ERROR("Device " << this << " has no memory arena.");
+  }
+  std::shared_ptr<void> handle = arena_->acquire(offset, sizeof(float) * size);
+  if (!handle) return false;
+  placements_.emplace_back(size, std::move(handle));
+  return true;
+}
+
+std::shared_ptr<void> Device::obtain_handle(const Shape &shape) {
+  thread_allocated_bytes += sizeof(float) * shape.size();
+  if (!placements_.empty()) {
+    const std::uint32_t size = shape.size();
+    for (auto it = placements_.begin(); it != placements_.end(); ++it) {
+      if (it->first == size) {
+        std::shared_ptr<void> handle = std::move(it->second);
+        placements_.erase(it);
+        return handle;
+      }
+    }
+  }
+  return new_handle(shape);
+}
+
 Tensor Device::new_raw_tensor(const Shape &shape) {
-  return Tensor(shape, *this, new_handle(shape));
+  return Tensor(shape, *this, obtain_handle(shape));
+}
+
+Tensor Device::new_tensor_view(
+    const Tensor &x, const Shape &shape, std::uint32_t offset) {
+  // The aliasing constructor shares the ownership with `x`, and the memory is
+  // treated as shared by the copy-on-write mechanism of Tensor.
+  return Tensor(
+      shape, *this,
+      std::shared_ptr<void>(
+        x.handle_, static_cast<float *>(x.handle_.get()) + offset));
 }
 
 Tensor Device::new_tensor_by_constant(const Shape &shape, float k) {
-  Tensor ret(shape, *this, new_handle(shape));
+  Tensor ret(shape, *this, obtain_handle(shape));
   reset_tensor(k, ret);
   return ret;
 }
 
 Tensor Device::new_tensor_by_array(const Shape &shape, const float values[]) {
-  Tensor ret(shape, *this, new_handle(shape));
+  Tensor ret(shape, *this, obtain_handle(shape));
   reset_tensor_by_array(values, ret);
   return ret;
 }
 
 Tensor Device::new_tensor_by_vector(
     const Shape &shape, const vector<float> &values) {
-  Tensor ret(shape, *this, new_handle(shape));
+  Tensor ret(shape, *this, obtain_handle(shape));
   reset_tensor_by_vector(values, ret);
   return ret;
 }
@@ -45,6 +152,17 @@ vector<float> Device::tensor_to_vector(const Tensor &x) {
   return tensor_to_vector_impl(x);
 }
 
+void Device::tensor_to_array(const Tensor &x, float values[]) {
+  CHECK_DEVICE(x);
+  if (!values) PRIMITIV_THROW_ERROR("Attempted to copy values to nullptr.");
+  tensor_to_array_impl(x, values);
+}
+
+void Device::tensor_to_array_impl(const Tensor &x, float values[]) {
+  const vector<float> ret = tensor_to_vector_impl(x);
+  std::copy(ret.begin(), ret.end(), values);
+}
+
 vector<std::uint32_t> Device::argmax(const Tensor &x, std::uint32_t dim) {
   CHECK_DEVICE(x);
   return argmax_impl(x, dim);
@@ -78,6 +196,21 @@ void Device::reset_tensor_by_vector(const vector<float> &values, Tensor &x) {
   reset_tensor_by_array_impl(values.data(), x);
 }
 
+Tensor Device::new_tensor_by_external_memory(
+    const Shape &shape, float *data,
+    const std::function<void(float *)> &deleter) {
+  if (!supports_external_memory()) {
+    PRIMITIV_THROW_ERROR(
+        "Device " << this << " does not support external memories.");
+  }
+  if (!data) PRIMITIV_THROW_ERROR("Attempted to use nullptr as a memory.");
+  if (deleter) {
+    return Tensor(shape, *this, std::shared_ptr<void>(data, deleter));
+  }
+  // Borrowed memories are never released by the tensor.
+  return Tensor(shape, *this, std::shared_ptr<void>(data, [](float *) {}));
+}
+
 Tensor Device::copy_tensor(const Tensor &x) {
   // NOTE(odashi):
   // This function should return always different memory with x.
@@ -87,6 +220,17 @@ Tensor Device::copy_tensor(const Tensor &x) {
   return y;
 }
 
+void Device::copy_tensor(const Tensor &x, Tensor &y) {
+  if (!x.valid()) PRIMITIV_THROW_ERROR("Attempted to copy an invalid tensor.");
+  if (&x == &y) return;
+  if (!y.valid() || y.device_ != this || y.shape_ != x.shape() ||
+      y.handle_.use_count() > 1) {
+    y = copy_tensor(x);
+    return;
+  }
+  copy_tensor_impl(x, y);
+}
+
 Tensor Device::identity(std::uint32_t size) {
   if (size == 0) {
     PRIMITIV_THROW_ERROR("Invalid size of the identity matrix: " << size);
@@ -151,7 +295,15 @@ Tensor Device::slice_fw(
     const Tensor &x, std::uint32_t dim,
     std::uint32_t lower, std::uint32_t upper) {
   CHECK_DEVICE(x);
-  Tensor y = new_raw_tensor(shape_ops::slice(x.shape(), dim, lower, upper));
+  const Shape sx = x.shape();
+  const Shape sy = shape_ops::slice(sx, dim, lower, upper);
+  // The resulting region is contiguous only if there are no higher dimensions
+  // and no minibatch. Other slices are copied because kernels do not support
+  // strided memories.
+  if (supports_tensor_views() && sx.lower_volume(dim) * sx[dim] == sx.size()) {
+    return new_tensor_view(x, sy, lower * sx.lower_volume(dim));
+  }
+  Tensor y = new_raw_tensor(sy);
   slice_fw_impl(x, dim, lower, y);
   return y;
 }
@@ -513,6 +665,446 @@ void Device::max_pool2d_bw(
       x, y, gy, window0, window1, padding0, padding1, stride0, stride1, gx);
 }
 
+void Device::lstm_cell_fw(
+    const Tensor &u, const Tensor &b, const Tensor &c,
+    Tensor &h, Tensor &c_new) {
+  CHECK_DEVICE(u);
+  CHECK_DEVICE(b);
+  CHECK_DEVICE(c);
+  const Shape sy = shape_ops::lstm_cell(u.shape(), b.shape(), c.shape());
+  h = new_raw_tensor(sy);
+  c_new = new_raw_tensor(sy);
+  lstm_cell_fw_impl(u, b, c, h, c_new);
+}
+
+void Device::lstm_cell_bw(
+    const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+    const Tensor &gh, const Tensor &gc_new,
+    Tensor &gu, Tensor &gb, Tensor &gc) {
+  CHECK_DEVICE(u);
+  CHECK_DEVICE(b);
+  CHECK_DEVICE(c);
+  CHECK_DEVICE(c_new);
+  CHECK_DEVICE(gh);
+  CHECK_DEVICE(gc_new);
+  CHECK_DEVICE(gu);
+  CHECK_DEVICE(gb);
+  CHECK_DEVICE(gc);
+  const Shape sy = shape_ops::lstm_cell(u.shape(), b.shape(), c.shape());
+  if (c_new.shape() != sy || gh.shape() != sy || gc_new.shape() != sy ||
+      gu.shape() != u.shape() || gb.shape() != b.shape() ||
+      gc.shape() != c.shape()) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched at lstm_cell_bw"
+        << ". u.shape: " << u.shape().to_string()
+        << ", b.shape: " << b.shape().to_string()
+        << ", c.shape: " << c.shape().to_string()
+        << ", c_new.shape: " << c_new.shape().to_string()
+        << ", gh.shape: " << gh.shape().to_string()
+        << ", gc_new.shape: " << gc_new.shape().to_string()
+        << ", gu.shape: " << gu.shape().to_string()
+        << ", gb.shape: " << gb.shape().to_string()
+        << ", gc.shape: " << gc.shape().to_string());
+  }
+  lstm_cell_bw_impl(u, b, c, c_new, gh, gc_new, gu, gb, gc);
+}
+
+void Device::gru_cell_fw(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y) {
+  CHECK_DEVICE(ux);
+  CHECK_DEVICE(uh);
+  CHECK_DEVICE(h);
+  y = new_raw_tensor(shape_ops::gru_cell(ux.shape(), uh.shape(), h.shape()));
+  gru_cell_fw_impl(ux, uh, h, y);
+}
+
+void Device::gru_cell_bw(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+    Tensor &gux, Tensor &guh, Tensor &gh) {
+  CHECK_DEVICE(ux);
+  CHECK_DEVICE(uh);
+  CHECK_DEVICE(h);
+  CHECK_DEVICE(gy);
+  CHECK_DEVICE(gux);
+  CHECK_DEVICE(guh);
+  CHECK_DEVICE(gh);
+  const Shape sy = shape_ops::gru_cell(ux.shape(), uh.shape(), h.shape());
+  if (gy.shape() != sy || gux.shape() != ux.shape() ||
+      guh.shape() != uh.shape() || gh.shape() != h.shape()) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched at gru_cell_bw"
+        << ". ux.shape: " << ux.shape().to_string()
+        << ", uh.shape: " << uh.shape().to_string()
+        << ", h.shape: " << h.shape().to_string()
+        << ", gy.shape: " << gy.shape().to_string()
+        << ", gux.shape: " << gux.shape().to_string()
+        << ", guh.shape: " << guh.shape().to_string()
+        << ", gh.shape: " << gh.shape().to_string());
+  }
+  gru_cell_bw_impl(ux, uh, h, gy, gux, guh, gh);
+}
+
+void Device::sru_fw(
+    const Tensor &x, const Tensor &u, const Tensor &b,
+    Tensor &h, Tensor &c) {
+  CHECK_DEVICE(x);
+  CHECK_DEVICE(u);
+  CHECK_DEVICE(b);
+  const Shape sy = shape_ops::sru(x.shape(), u.shape(), b.shape());
+  h = new_raw_tensor(sy);
+  c = new_raw_tensor(sy);
+  sru_fw_impl(x, u, b, h, c);
+}
+
+void Device::sru_bw(
+    const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+    const Tensor &gh, const Tensor &gc,
+    Tensor &gx, Tensor &gu, Tensor &gb) {
+  CHECK_DEVICE(x);
+  CHECK_DEVICE(u);
+  CHECK_DEVICE(b);
+  CHECK_DEVICE(c);
+  CHECK_DEVICE(gh);
+  CHECK_DEVICE(gc);
+  CHECK_DEVICE(gx);
+  CHECK_DEVICE(gu);
+  CHECK_DEVICE(gb);
+  const Shape sy = shape_ops::sru(x.shape(), u.shape(), b.shape());
+  if (c.shape() != sy || gh.shape() != sy || gc.shape() != sy ||
+      gx.shape() != x.shape() || gu.shape() != u.shape() ||
+      gb.shape() != b.shape()) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched at sru_bw"
+        << ". x.shape: " << x.shape().to_string()
+        << ", u.shape: " << u.shape().to_string()
+        << ", b.shape: " << b.shape().to_string()
+        << ", c.shape: " << c.shape().to_string()
+        << ", gh.shape: " << gh.shape().to_string()
+        << ", gc.shape: " << gc.shape().to_string()
+        << ", gx.shape: " << gx.shape().to_string()
+        << ", gu.shape: " << gu.shape().to_string()
+        << ", gb.shape: " << gb.shape().to_string());
+  }
+  sru_bw_impl(x, u, b, c, gh, gc, gx, gu, gb);
+}
+
+void Device::attention_fw(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    float scale, Tensor &y, Tensor &lse) {
+  CHECK_DEVICE(q);
+  CHECK_DEVICE(k);
+  CHECK_DEVICE(v);
+  if (mask) CHECK_DEVICE(*mask);
+  const Shape sy = mask
+    ? shape_ops::attention(q.shape(), k.shape(), v.shape(), mask->shape())
+    : shape_ops::attention(q.shape(), k.shape(), v.shape());
+  y = new_raw_tensor(sy);
+  lse = new_raw_tensor(Shape({1, sy[1]}, sy.batch()));
+  attention_fw_impl(q, k, v, mask, scale, y, lse);
+}
+
+void Device::attention_bw(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    const Tensor &y, const Tensor &lse,
+    const Tensor &gy, const Tensor &glse, float scale,
+    Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask) {
+  CHECK_DEVICE(q);
+  CHECK_DEVICE(k);
+  CHECK_DEVICE(v);
+  if (mask) CHECK_DEVICE(*mask);
+  CHECK_DEVICE(y);
+  CHECK_DEVICE(lse);
+  CHECK_DEVICE(gy);
+  CHECK_DEVICE(glse);
+  CHECK_DEVICE(gq);
+  CHECK_DEVICE(gk);
+  CHECK_DEVICE(gv);
+  if (gmask) CHECK_DEVICE(*gmask);
+  const Shape sy = mask
+    ? shape_ops::attention(q.shape(), k.shape(), v.shape(), mask->shape())
+    : shape_ops::attention(q.shape(), k.shape(), v.shape());
+  const Shape slse({1, sy[1]}, sy.batch());
+  if (y.shape() != sy || lse.shape() != slse ||
+      gy.shape() != sy || glse.shape() != slse ||
+      gq.shape() != q.shape() || gk.shape() != k.shape() ||
+      gv.shape() != v.shape() || !mask != !gmask ||
+      (gmask && gmask->shape() != mask->shape())) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched at attention_bw"
+        << ". q.shape: " << q.shape().to_string()
+        << ", k.shape: " << k.shape().to_string()
+        << ", v.shape: " << v.shape().to_string()
+        << ", mask.shape: " << (mask ? mask->shape().to_string() : "none")
+        << ", y.shape: " << y.shape().to_string()
+        << ", lse.shape: " << lse.shape().to_string()
+        << ", gy.shape: " << gy.shape().to_string()
+        << ", glse.shape: " << glse.shape().to_string()
+        << ", gq.shape: " << gq.shape().to_string()
+        << ", gk.shape: " << gk.shape().to_string()
+        << ", gv.shape: " << gv.shape().to_string()
+        << ", gmask.shape: " << (gmask ? gmask->shape().to_string() : "none"));
+  }
+  attention_bw_impl(
+      q, k, v, mask, y, lse, gy, glse, scale, gq, gk, gv, gmask);
+}
+
+Tensor Device::elementwise_fw(
+    const ElementwiseProgram &program, const vector<const Tensor *> &xs) {
+  if (xs.size() != program.num_inputs()) {
+    PRIMITIV_THROW_ERROR(
+        "Number of inputs mismatched. xs.size(): " << xs.size()
+        << " != program.num_inputs(): " << program.num_inputs());
+  }
+  CHECK_DEVICE(*xs[0]);
+  Shape sy = xs[0]->shape();
+  for (std::uint32_t i = 1; i < xs.size(); ++i) {
+    CHECK_DEVICE(*xs[i]);
+    sy = shape_ops::elementwise(sy, xs[i]->shape());
+  }
+  Tensor y = new_raw_tensor(sy);
+  elementwise_fw_impl(program, xs, y);
+  return y;
+}
+
+void Device::elementwise_bw(
+    const ElementwiseProgram &program,
+    const vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+    const vector<Tensor *> &gxs) {
+  if (xs.size() != program.num_inputs() || gxs.size() != xs.size()) {
+    PRIMITIV_THROW_ERROR(
+        "Number of inputs mismatched. xs.size(): " << xs.size()
+        << ", gxs.size(): " << gxs.size()
+        << ", program.num_inputs(): " << program.num_inputs());
+  }
+  CHECK_DEVICE(y);
+  CHECK_DEVICE(gy);
+  if (gy.shape() != y.shape()) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched at elementwise_bw"
+        << ". y.shape: " << y.shape().to_string()
+        << ", gy.shape: " << gy.shape().to_string());
+  }
+  for (std::uint32_t i = 0; i < xs.size(); ++i) {
+    CHECK_DEVICE(*xs[i]);
+    CHECK_DEVICE(*gxs[i]);
+    const Shape &sx = xs[i]->shape();
+    if (gxs[i]->shape() != sx ||
+        !sx.has_same_dims(y.shape()) || !sx.has_compatible_batch(y.shape()) ||
+        sx.batch() > y.shape().batch()) {
+      PRIMITIV_THROW_ERROR(
+          "Shape mismatched at elementwise_bw"
+          << ". xs[" << i << "].shape: " << sx.to_string()
+          << ", gxs[" << i << "].shape: " << gxs[i]->shape().to_string()
+          << ", y.shape: " << y.shape().to_string());
+    }
+  }
+  elementwise_bw_impl(program, xs, y, gy, gxs);
+}
+
+// Default implementations of recurrent cells are composed of Tensor functions
+// and elementwise expressions.
+
+void Device::lstm_cell_fw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c,
+    Tensor &h, Tensor &c_new) {
+  namespace E = expressions;
+  const std::uint32_t n = c.shape()[0];
+  const Tensor a = u + b;
+  const E::Expression i = E::sigmoid(functions::slice(a, 0, 0, n));
+  const E::Expression f = E::sigmoid(functions::slice(a, 0, n, 2 * n));
+  const E::Expression o = E::sigmoid(functions::slice(a, 0, 2 * n, 3 * n));
+  const E::Expression j = E::tanh(functions::slice(a, 0, 3 * n, 4 * n));
+  c_new = i * j + f * E::lazy(c);
+  h = o * E::tanh(c_new);
+}
+
+void Device::lstm_cell_bw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+    const Tensor &gh, const Tensor &gc_new,
+    Tensor &gu, Tensor &gb, Tensor &gc) {
+  namespace E = expressions;
+  const std::uint32_t n = c.shape()[0];
+  const Tensor a = u + b;
+  const E::Expression i = E::sigmoid(functions::slice(a, 0, 0, n));
+  const E::Expression f = E::sigmoid(functions::slice(a, 0, n, 2 * n));
+  const E::Expression o = E::sigmoid(functions::slice(a, 0, 2 * n, 3 * n));
+  const E::Expression j = E::tanh(functions::slice(a, 0, 3 * n, 4 * n));
+  const E::Expression t = E::tanh(c_new);
+  const E::Expression gy = E::lazy(gh);
+  const E::Expression gcy = E::lazy(gc_new) + gy * o * (1 - t * t);
+  const Tensor gi = gcy * j * i * (1 - i);
+  const Tensor gf = gcy * E::lazy(c) * f * (1 - f);
+  const Tensor go = gy * t * o * (1 - o);
+  const Tensor gj = gcy * i * (1 - j * j);
+  const Tensor ga = functions::concat(
+      vector<const Tensor *> {&gi, &gf, &go, &gj}, 0);
+  gu += ga;
+  gb += ga;
+  gc += gcy * f;
+}
+
+void Device::gru_cell_fw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y) {
+  namespace E = expressions;
+  using functions::slice;
+  const std::uint32_t n = h.shape()[0];
+  const Tensor a = slice(ux, 0, 0, 2 * n) + slice(uh, 0, 0, 2 * n);
+  const E::Expression r = E::sigmoid(slice(a, 0, 0, n));
+  const E::Expression z = E::sigmoid(slice(a, 0, n, 2 * n));
+  const E::Expression j = E::tanh(
+      E::lazy(slice(ux, 0, 2 * n, 3 * n))
+      + r * E::lazy(slice(uh, 0, 2 * n, 3 * n)));
+  y = (1 - z) * j + z * E::lazy(h);
+}
+
+void Device::gru_cell_bw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+    Tensor &gux, Tensor &guh, Tensor &gh) {
+  namespace E = expressions;
+  using functions::slice;
+  const std::uint32_t n = h.shape()[0];
+  const Tensor a = slice(ux, 0, 0, 2 * n) + slice(uh, 0, 0, 2 * n);
+  const Tensor r = E::sigmoid(slice(a, 0, 0, n));
+  const E::Expression z = E::sigmoid(slice(a, 0, n, 2 * n));
+  const Tensor uhj = slice(uh, 0, 2 * n, 3 * n);
+  const E::Expression j = E::tanh(
+      E::lazy(slice(ux, 0, 2 * n, 3 * n)) + E::lazy(r) * E::lazy(uhj));
+  const E::Expression g = E::lazy(gy);
+  const Tensor gj = g * (1 - z) * (1 - j * j);
+  const Tensor gz = g * (E::lazy(h) - j) * z * (1 - z);
+  const E::Expression er = E::lazy(r);
+  const Tensor gr = E::lazy(gj) * E::lazy(uhj) * er * (1 - er);
+  const Tensor gj_r = gj * r;
+  gux += functions::concat(vector<const Tensor *> {&gr, &gz, &gj}, 0);
+  guh += functions::concat(vector<const Tensor *> {&gr, &gz, &gj_r}, 0);
+  gh += g * z;
+}
+
+void Device::sru_fw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b,
+    Tensor &h, Tensor &c) {
+  namespace E = expressions;
+  using functions::broadcast;
+  using functions::slice;
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const Tensor j = slice(u, 0, 0, n);
+  const Tensor f = E::sigmoid(
+      E::lazy(slice(u, 0, n, 2 * n))
+      + E::lazy(broadcast(slice(b, 0, 0, n), 1, len)));
+  const E::Expression r = E::sigmoid(
+      E::lazy(slice(u, 0, 2 * n, 3 * n))
+      + E::lazy(broadcast(slice(b, 0, n, 2 * n), 1, len)));
+
+  // The initial state has the resulting batch size so that every cell state
+  // also has it.
+  vector<Tensor> cs;
+  cs.reserve(len);
+  Tensor ct = new_tensor_by_constant(Shape({n}, c.shape().batch()), 0);
+  for (std::uint32_t t = 0; t < len; ++t) {
+    const E::Expression ft = E::lazy(slice(f, 1, t, t + 1));
+    ct = ft * E::lazy(ct) + (1 - ft) * E::lazy(slice(j, 1, t, t + 1));
+    cs.emplace_back(ct);
+  }
+  c = functions::concat(cs, 1);
+  h = r * E::tanh(c) + (1 - r) * E::lazy(x);
+}
+
+void Device::sru_bw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+    const Tensor &gh, const Tensor &gc,
+    Tensor &gx, Tensor &gu, Tensor &gb) {
+  namespace E = expressions;
+  using functions::broadcast;
+  using functions::slice;
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const Tensor j = slice(u, 0, 0, n);
+  const Tensor f = E::sigmoid(
+      E::lazy(slice(u, 0, n, 2 * n))
+      + E::lazy(broadcast(slice(b, 0, 0, n), 1, len)));
+  const E::Expression r = E::sigmoid(
+      E::lazy(slice(u, 0, 2 * n, 3 * n))
+      + E::lazy(broadcast(slice(b, 0, n, 2 * n), 1, len)));
+  const E::Expression t = E::tanh(c);
+  const E::Expression g = E::lazy(gh);
+
+  // Gradients of cell states are accumulated from the last step.
+  const Tensor gc_direct = E::lazy(gc) + g * r * (1 - t * t);
+  vector<Tensor> gcs(len);
+  for (std::uint32_t i = len; i > 0; --i) {
+    gcs[i - 1] = slice(gc_direct, 1, i - 1, i);
+    if (i < len) {
+      gcs[i - 1] += gcs[i] * slice(f, 1, i, i + 1);
+    }
+  }
+  const E::Expression gcy = E::lazy(functions::concat(gcs, 1));
+  const Tensor c_prev = len > 1
+    ? functions::concat(
+        vector<Tensor> {
+          new_tensor_by_constant(Shape({n}, c.shape().batch()), 0),
+          slice(c, 1, 0, len - 1),
+        }, 1)
+    : new_tensor_by_constant(Shape({n}, c.shape().batch()), 0);
+
+  const E::Expression ef = E::lazy(f);
+  const Tensor gj = gcy * (1 - ef);
+  const Tensor gf = gcy * (E::lazy(c_prev) - E::lazy(j)) * ef * (1 - ef);
+  const Tensor gr = g * (t - E::lazy(x)) * r * (1 - r);
+  gx += g * (1 - r);
+  gu += functions::concat(vector<const Tensor *> {&gj, &gf, &gr}, 0);
+  gb += functions::sum(
+      functions::concat(vector<const Tensor *> {&gf, &gr}, 0), 1);
+}
+
+// The default attention materializes the whole score matrix and is
+// calculated by Tensor functions.
+
+void Device::attention_fw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    float scale, Tensor &y, Tensor &lse) {
+  using functions::broadcast;
+  using functions::matmul;
+  using functions::transpose;
+  Tensor s = matmul(transpose(k), q) * scale;
+  if (mask) s = s + *mask;
+  lse = functions::logsumexp(s, 0);
+  y = matmul(v, functions::exp(s - broadcast(lse, 0, k.shape()[1])));
+}
+
+void Device::attention_bw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    const Tensor &y, const Tensor &lse,
+    const Tensor &gy, const Tensor &glse, float scale,
+    Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask) {
+  using functions::broadcast;
+  using functions::matmul;
+  using functions::transpose;
+  const std::uint32_t n = k.shape()[1];
+  Tensor s = matmul(transpose(k), q) * scale;
+  if (mask) s = s + *mask;
+  const Tensor p = functions::exp(s - broadcast(lse, 0, n));
+
+  // Gradient of scores: p * (v^T . gy - sum(gy * y) + glse)
+  const Tensor d = functions::sum(gy * y, 0) - glse;
+  const Tensor gs = p * (matmul(transpose(v), gy) - broadcast(d, 0, n));
+  gq += matmul(k, gs) * scale;
+  gk += matmul(q, transpose(gs)) * scale;
+  gv += matmul(gy, transpose(p));
+  if (gmask) *gmask += gs;
+}
+
+void Device::elementwise_fw_impl(
+    const ElementwiseProgram &, const vector<const Tensor *> &, Tensor &) {
+  PRIMITIV_THROW_NOT_IMPLEMENTED;
+}
+
+void Device::elementwise_bw_impl(
+    const ElementwiseProgram &, const vector<const Tensor *> &,
+    const Tensor &, const Tensor &, const vector<Tensor *> &) {
+  PRIMITIV_THROW_NOT_IMPLEMENTED;
+}
+
 #undef DEV_FW_X
 #undef DEV_BW_X
 #undef DEV_FW_X_CONST
@@ -621,7 +1213,12 @@ Tensor Device::batch_pick_fw(
 Tensor Device::batch_slice_fw(
     const Tensor &x, std::uint32_t lower, std::uint32_t upper) {
   CHECK_DEVICE(x);
-  Tensor y = new_raw_tensor(shape_ops::batch_slice(x.shape(), lower, upper));
+  const Shape sy = shape_ops::batch_slice(x.shape(), lower, upper);
+  // Minibatches are always stored contiguously.
+  if (supports_tensor_views()) {
+    return new_tensor_view(x, sy, lower * sy.volume());
+  }
+  Tensor y = new_raw_tensor(sy);
   batch_slice_fw_impl(x, lower, y);
   return y;
 }
@@ -676,6 +1273,147 @@ void Device::batch_slice_bw(
   batch_slice_bw_impl(gy, offset, gx);
 }
 
+float Device::squared_norm(const vector<const Tensor *> &xs) {
+  for (const Tensor *x : xs) {
+    CHECK_DEVICE(*x);
+  }
+  return squared_norm_impl(xs);
+}
+
+void Device::sgd_update(
+    const vector<const Tensor *> &gs, float eta, const vector<Tensor *> &xs) {
+  check_update_args(*this, gs, {&xs});
+  sgd_update_impl(gs, eta, xs);
+}
+
+void Device::momentum_sgd_update(
+    const vector<const Tensor *> &gs, float eta, float momentum,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  check_update_args(*this, gs, {&xs, &ms});
+  momentum_sgd_update_impl(gs, eta, momentum, xs, ms);
+}
+
+void Device::adagrad_update(
+    const vector<const Tensor *> &gs, float eta, float eps,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  check_update_args(*this, gs, {&xs, &ms});
+  adagrad_update_impl(gs, eta, eps, xs, ms);
+}
+
+void Device::rmsprop_update(
+    const vector<const Tensor *> &gs, float eta, float alpha, float eps,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  check_update_args(*this, gs, {&xs, &ms});
+  rmsprop_update_impl(gs, eta, alpha, eps, xs, ms);
+}
+
+void Device::adadelta_update(
+    const vector<const Tensor *> &gs, float scale, float rho, float eps,
+    const vector<Tensor *> &xs,
+    const vector<Tensor *> &m1s, const vector<Tensor *> &m2s) {
+  check_update_args(*this, gs, {&xs, &m1s, &m2s});
+  adadelta_update_impl(gs, scale, rho, eps, xs, m1s, m2s);
+}
+
+void Device::adam_update(
+    const vector<const Tensor *> &gs,
+    float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+    const vector<Tensor *> &xs,
+    const vector<Tensor *> &m1s, const vector<Tensor *> &m2s) {
+  check_update_args(*this, gs, {&xs, &m1s, &m2s});
+  adam_update_impl(gs, alpha, beta1, beta2, eps, epoch, xs, m1s, m2s);
+}
+
+float Device::squared_norm_impl(const vector<const Tensor *> &xs) {
+  // Partial sums are accumulated on the device to avoid synchronization.
+  Tensor total = new_tensor_by_constant({}, 0);
+  for (const Tensor *x : xs) {
+    total += functions::batch::sum(
+        functions::sum(functions::flatten(*x * *x), 0));
+  }
+  return total.to_float();
+}
+
+// Default implementations of optimizer updates are composed of in-place
+// Tensor operations, which are available on every device.
+
+void Device::sgd_update_impl(
+    const vector<const Tensor *> &gs, float eta, const vector<Tensor *> &xs) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    *xs[i] -= eta * *gs[i];
+  }
+}
+
+void Device::momentum_sgd_update_impl(
+    const vector<const Tensor *> &gs, float eta, float momentum,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    Tensor &m = *ms[i];
+    m *= momentum;
+    m -= eta * *gs[i];
+    *xs[i] += m;
+  }
+}
+
+void Device::adagrad_update_impl(
+    const vector<const Tensor *> &gs, float eta, float eps,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const Tensor &g = *gs[i];
+    Tensor &m = *ms[i];
+    m += g * g;
+    *xs[i] -= eta * g / (functions::sqrt(m) + eps);
+  }
+}
+
+void Device::rmsprop_update_impl(
+    const vector<const Tensor *> &gs, float eta, float alpha, float eps,
+    const vector<Tensor *> &xs, const vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const Tensor &g = *gs[i];
+    Tensor &m = *ms[i];
+    m *= alpha;
+    m += (1 - alpha) * g * g;
+    *xs[i] -= eta * g / (functions::sqrt(m) + eps);
+  }
+}
+
+void Device::adadelta_update_impl(
+    const vector<const Tensor *> &gs, float scale, float rho, float eps,
+    const vector<Tensor *> &xs,
+    const vector<Tensor *> &m1s, const vector<Tensor *> &m2s) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const Tensor &g = *gs[i];
+    Tensor &m1 = *m1s[i];
+    Tensor &m2 = *m2s[i];
+    m2 *= rho;
+    m2 += (1 - rho) * g * g;
+    const Tensor dx = functions::sqrt((m1 + eps) / (m2 + eps)) * g;
+    m1 *= rho;
+    m1 += (1 - rho) * dx * dx;
+    *xs[i] -= scale * dx;
+  }
+}
+
+void Device::adam_update_impl(
+    const vector<const Tensor *> &gs,
+    float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+    const vector<Tensor *> &xs,
+    const vector<Tensor *> &m1s, const vector<Tensor *> &m2s) {
+  const float bias1 = 1 - std::pow(beta1, epoch);
+  const float bias2 = 1 - std::pow(beta2, epoch);
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const Tensor &g = *gs[i];
+    Tensor &m1 = *m1s[i];
+    Tensor &m2 = *m2s[i];
+    m1 *= beta1;
+    m1 += (1 - beta1) * g;
+    m2 *= beta2;
+    m2 += (1 - beta2) * g * g;
+    *xs[i] -= alpha * (m1 / bias1) / (functions::sqrt(m2 / bias2) + eps);
+  }
+}
+
 void Device::inplace_multiply_const(float k, Tensor &x) {
   CHECK_DEVICE(x);
   inplace_multiply_const_impl(k, x);
@@ -684,7 +1422,7 @@ void Device::inplace_multiply_const(float k, Tensor &x) {
 void Device::inplace_add(const Tensor &x, Tensor &y) {
   CHECK_DEVICE(x);
   CHECK_DEVICE(y);
-  const Shape &sx = x.shape();
+  const Shape sx = x.shape();
   const Shape &sy = y.shape();
   if (!sx.has_same_dims(sy) || !sx.has_compatible_batch(sy)) {
     PRIMITIV_THROW_ERROR(
@@ -697,7 +1435,7 @@ void Device::inplace_add(const Tensor &x, Tensor &y) {
 void Device::inplace_subtract(const Tensor &x, Tensor &y) {
   CHECK_DEVICE(x);
   CHECK_DEVICE(y);
-  const Shape &sx = x.shape();
+  const Shape sx = x.shape();
   const Shape &sy = y.shape();
   if (!sx.has_same_dims(sy) || !sx.has_compatible_batch(sy)) {
     PRIMITIV_THROW_ERROR(
@@ -707,4 +1445,25 @@ void Device::inplace_subtract(const Tensor &x, Tensor &y) {
   inplace_subtract_impl(x, y);
 }
 
+void Device::pick_assign(
+    const Tensor &x, const std::vector<std::uint32_t> &ids, std::uint32_t dim,
+    Tensor &y) {
+  CHECK_DEVICE(x);
+  CHECK_DEVICE(y);
+  const Shape sx = shape_ops::pick(y.shape(), ids, dim);
+  if (x.shape() != sx) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched. x.shape(): " << x.shape().to_string()
+        << " != expected shape: " << sx.to_string());
+  }
+  pick_assign_impl(x, ids, dim, y);
+}
+
+void Device::pick_assign_impl(
+    const Tensor &x, const std::vector<std::uint32_t> &ids, std::uint32_t dim,
+    Tensor &y) {
+  // Adding differences overwrites slices because IDs are distinct.
+  pick_bw_impl(x - pick_fw(y, ids, dim), ids, dim, y);
+}
+
 }  // namespace primitiv
@@ -1,9 +1,15 @@
 #ifndef PRIMITIV_CORE_DEVICE_H_
 #define PRIMITIV_CORE_DEVICE_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <primitiv/core/elementwise_program.h>
+#include <primitiv/core/memory_arena.h>
 #include <primitiv/core/mixins/default_settable.h>
 #include <primitiv/core/mixins/nonmovable.h>
 #include <primitiv/core/shape.h>
@@ -57,7 +63,115 @@ public:
    */
   virtual DeviceType type() const = 0;
 
+  /**
+   * Checks whether the device can place tensors on a memory arena or not.
+   * @return true if the device supports memory arenas, false otherwise.
+   * @remarks Memory arenas are used by the static memory planner of the
+   *          Graph class.
+   */
+  virtual bool supports_memory_arena() const { return false; }
+
+  /**
+   * Checks whether operations of the device can be called from multiple
+   * threads at the same time or not.
+   * @return true if the device supports concurrent calls, false otherwise.
+   * @remarks Random number generators are always excluded, and callers should
+   *          serialize their uses.
+   */
+  virtual bool supports_concurrent_execution() const { return false; }
+
+  /**
+   * Checks whether the device can evaluate elementwise programs or not.
+   * @return true if the device supports `elementwise_fw()` and
+   *         `elementwise_bw()`, false otherwise.
+   * @remarks Elementwise programs are used by the operator fusion of the
+   *          Graph class.
+   */
+  virtual bool supports_elementwise_fusion() const { return false; }
+
+  /**
+   * Checks whether tensors of the device can share a part of the memory of
+   * other tensors or not.
+   * @return true if the device supports tensor views, false otherwise.
+   * @remarks If supported, `batch_slice_fw()` always returns a view of the
+   *          argument without copying values. `slice_fw()` returns a view
+   *          only if the resulting region is contiguous, i.e., the argument
+   *          has neither a minibatch nor dimensions higher than `dim`. Other
+   *          slices and `transpose_fw()` always copy values, because
+   *          kernels do not support strided memories.
+   *          Views are treated in the same way as other shared memories, and
+   *          are duplicated before their values are updated.
+   */
+  virtual bool supports_tensor_views() const { return false; }
+
+  /**
+   * Checks whether the device can use host memories provided by users as
+   * internal memories of tensors or not.
+   * @return true if the device supports `new_tensor_by_external_memory()`,
+   *         false otherwise.
+   */
+  virtual bool supports_external_memory() const { return false; }
+
+  /**
+   * Returns the total size of memory obtained for new tensors by the calling
+   * thread.
+   * @return Size in bytes, accumulated over all devices.
+   * @remarks This value is used by the profiler of the Graph class.
+   */
+  static std::uint64_t get_thread_allocated_bytes();
+
+  /**
+   * Prepares the memory arena.
+   * @param size Required size of the arena in bytes.
+   * @throw primitiv::Error The device does not support memory arenas.
+   * @remarks The current arena is reused if it is large enough and no tensor
+   *          is placed on it. Otherwise a new arena is allocated, and the old
+   *          one is released after all tensors on it are deleted.
+   */
+  void reserve_memory_arena(std::size_t size);
+
+  /**
+   * Returns the size of the current memory arena.
+   * @return Size of the arena in bytes, or 0 if the device has no arena.
+   */
+  std::size_t memory_arena_size() const {
+    return arena_ ? arena_->size() : 0;
+  }
+
+  /**
+   * Releases the memory arena.
+   * @remarks Tensors already placed on the arena remain valid.
+   */
+  void release_memory_arena();
+
+  /**
+   * Requests to place the next new tensor with the given number of elements
+   * on the memory arena.
+   * @param offset Offset in the arena in bytes.
+   * @param size Number of elements of the tensor.
+   * @return true if the region is reserved, false if the region is still
+   *         used by other tensors.
+   * @throw primitiv::Error The device has no memory arena, or the region
+   *                        exceeds the arena.
+   * @remarks Reserved regions are used in the order of the requests by new
+   *          tensors with the same number of elements, and are discarded by
+   *          `discard_placements()`.
+   */
+  bool place_next_tensor(std::size_t offset, std::uint32_t size);
+
+  /**
+   * Discards all placements which have not been used yet.
+   */
+  void discard_placements() { placements_.clear(); }
+
 private:
+  /**
+   * Obtains a new memory for the tensor, using the placements if available.
+   * @param shape Shape of the tensor.
+   * @return Handle of the new memory.
+   */
+  std::shared_ptr<void> obtain_handle(const Shape &shape);
+
   /**
    * Provides a new Tensor object on the device.
    * @param shape Shape of the tensor.
@@ -65,6 +179,19 @@ private:
    */
   Tensor new_raw_tensor(const Shape &shape);
 
+  /**
+   * Provides a new Tensor object which shares a contiguous region of the
+   * memory of another tensor.
+   * @param x A tensor which owns the memory.
+   * @param shape Shape of the view.
+   * @param offset Offset of the view in number of elements.
+   * @return A new Tensor object.
+   * @remarks This function should be called only if `supports_tensor_views()`
+   *          returns true.
+   */
+  Tensor new_tensor_view(
+      const Tensor &x, const Shape &shape, std::uint32_t offset);
+
 public:
   /**
    * Provides a new Tensor object with same-value elements.
@@ -91,6 +218,26 @@ public:
   Tensor new_tensor_by_vector(
       const Shape &shape, const std::vector<float> &values);
 
+  /**
+   * Provides a new Tensor object which uses a host memory provided by the
+   * user without copying values.
+   * @param shape Shape of the tensor.
+   * @param data Pointer to the memory, which should hold at least
+   *             `shape.size()` values.
+   * @param deleter Function to release `data`, which is called after the
+   *                tensor and all its copies are deleted. If this argument is
+   *                empty, the memory is only borrowed and the user should
+   *                keep it alive while the tensor is used.
+   * @return A new Tensor object.
+   * @throw primitiv::Error The device does not support external memories, or
+   *                        `data` is `nullptr`.
+   * @remarks In-place operations on the resulting tensor directly update the
+   *          values in `data` unless the memory is shared with other tensors.
+   */
+  Tensor new_tensor_by_external_memory(
+      const Shape &shape, float *data,
+      const std::function<void(float *)> &deleter = nullptr);
+
   /**
    * Copies the tensor to this device with allocating a new memory.
    * @param x A tensor to be copied.
@@ -101,6 +248,16 @@ public:
    */
   Tensor copy_tensor(const Tensor &x);
 
+  /**
+   * Copies the values of a tensor into another tensor of this device.
+   * @param x A tensor to be copied.
+   * @param y A tensor to store the copied values.
+   * @remarks The memory of `y` is reused if `y` has the same shape as `x`,
+   *          belongs to this device and does not share the memory with other
+   *          objects. Otherwise, `y` is replaced by a new tensor.
+   */
+  void copy_tensor(const Tensor &x, Tensor &y);
+
   // Provides an identity matrix.
   Tensor identity(std::uint32_t size);
 
@@ -261,6 +418,279 @@ public:
       std::uint32_t stride0, std::uint32_t stride1,
       Tensor &gx);
 
+  /**
+   * Calculates one step of the LSTM cell.
+   * @param u Preactivations of input, forget and output gates and the cell
+   *          input, concatenated along the first dimension (Shape [4n]).
+   * @param b Biases of `u` (Shape [4n]).
+   * @param c Previous cell state (Shape [n]).
+   * @param h Variable to store the new hidden state.
+   * @param c_new Variable to store the new cell state.
+   * @remarks This function calculates:
+   *          `i, f, o = sigmoid(u + b)[0:n, n:2n, 2n:3n]`,
+   *          `j = tanh(u + b)[3n:4n]`,
+   *          `c_new = i * j + f * c`, and `h = o * tanh(c_new)`.
+   *          Batch broadcasting is applied to all arguments.
+   */
+  void lstm_cell_fw(
+      const Tensor &u, const Tensor &b, const Tensor &c,
+      Tensor &h, Tensor &c_new);
+
+  /**
+   * Calculates gradients of the LSTM cell.
+   * @param u Preactivations used by `lstm_cell_fw()`.
+   * @param b Biases used by `lstm_cell_fw()`.
+   * @param c Previous cell state used by `lstm_cell_fw()`.
+   * @param c_new New cell state calculated by `lstm_cell_fw()`.
+   * @param gh Gradient of the new hidden state.
+   * @param gc_new Gradient of the new cell state.
+   * @param gu Gradient of `u` to be updated.
+   * @param gb Gradient of `b` to be updated.
+   * @param gc Gradient of `c` to be updated.
+   */
+  void lstm_cell_bw(
+      const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+      const Tensor &gh, const Tensor &gc_new,
+      Tensor &gu, Tensor &gb, Tensor &gc);
+
+  /**
+   * Calculates one step of the GRU cell.
+   * @param ux Preactivations of reset and update gates and the candidate from
+   *           the input, concatenated along the first dimension (Shape [3n]).
+   * @param uh Preactivations of reset and update gates and the candidate from
+   *           the previous state (Shape [3n]).
+   * @param h Previous hidden state (Shape [n]).
+   * @param y Variable to store the new hidden state.
+   * @remarks This function calculates:
+   *          `r, z = sigmoid(ux + uh)[0:n, n:2n]`,
+   *          `j = tanh(ux[2n:3n] + r * uh[2n:3n])`, and
+   *          `y = (1 - z) * j + z * h`.
+   *          Batch broadcasting is applied to all arguments.
+   */
+  void gru_cell_fw(
+      const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y);
+
+  /**
+   * Calculates gradients of the GRU cell.
+   * @param ux Preactivations used by `gru_cell_fw()`.
+   * @param uh Preactivations used by `gru_cell_fw()`.
+   * @param h Previous hidden state used by `gru_cell_fw()`.
+   * @param gy Gradient of the new hidden state.
+   * @param gux Gradient of `ux` to be updated.
+   * @param guh Gradient of `uh` to be updated.
+   * @param gh Gradient of `h` to be updated.
+   */
+  void gru_cell_bw(
+      const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+      Tensor &gux, Tensor &guh, Tensor &gh);
+
+  /**
+   * Calculates the whole sequence of the SRU.
+   * @param x Input sequence, one step per column (Shape [n, T]).
+   * @param u Candidates and preactivations of forget and reset gates,
+   *          concatenated along the first dimension (Shape [3n, T]).
+   * @param b Biases of forget and reset gates (Shape [2n]).
+   * @param h Variable to store hidden states.
+   * @param c Variable to store cell states.
+   * @remarks This function calculates for each step `t`:
+   *          `f, r = sigmoid(u[n:3n, t] + b)[0:n, n:2n]`,
+   *          `c[t] = f * c[t-1] + (1 - f) * u[0:n, t]`, and
+   *          `h[t] = r * tanh(c[t]) + (1 - r) * x[t]`,
+   *          where `c[-1]` is zero.
+   *          Batch broadcasting is applied to all arguments.
+   */
+  void sru_fw(
+      const Tensor &x, const Tensor &u, const Tensor &b,
+      Tensor &h, Tensor &c);
+
+  /**
+   * Calculates gradients of the SRU.
+   * @param x Input sequence used by `sru_fw()`.
+   * @param u Transformed inputs used by `sru_fw()`.
+   * @param b Biases used by `sru_fw()`.
+   * @param c Cell states calculated by `sru_fw()`.
+   * @param gh Gradient of hidden states.
+   * @param gc Gradient of cell states.
+   * @param gx Gradient of `x` to be updated.
+   * @param gu Gradient of `u` to be updated.
+   * @param gb Gradient of `b` to be updated.
+   */
+  void sru_bw(
+      const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+      const Tensor &gh, const Tensor &gc,
+      Tensor &gx, Tensor &gu, Tensor &gb);
+
+  /**
+   * Calculates the scaled dot-product attention.
+   * @param q Queries, one query per column (Shape [d, m]).
+   * @param k Keys, one key per column (Shape [d, n]).
+   * @param v Values, one value per column (Shape [e, n]).
+   * @param mask Values added to attention scores (Shape [n, m]), or
+   *             `nullptr` if the attention is not masked.
+   * @param scale Scaling factor of dot products.
+   * @param y Variable to store attended values.
+   * @param lse Variable to store log-sum-exp of scores of each query
+   *            (Shape [1, m]).
+   * @remarks This function calculates:
+   *          `s = scale * transpose(k) . q + mask`,
+   *          `lse = logsumexp(s, 0)`, and `y = v . exp(s - lse)`.
+   *          Only `lse` is stored instead of attention probabilities, and
+   *          probabilities are recalculated by `attention_bw()`.
+   *          Batch broadcasting is applied to all arguments.
+   */
+  void attention_fw(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      float scale, Tensor &y, Tensor &lse);
+
+  /**
+   * Calculates gradients of the scaled dot-product attention.
+   * @param q Queries used by `attention_fw()`.
+   * @param k Keys used by `attention_fw()`.
+   * @param v Values used by `attention_fw()`.
+   * @param mask Mask used by `attention_fw()`, or `nullptr`.
+   * @param y Attended values calculated by `attention_fw()`.
+   * @param lse Log-sum-exp values calculated by `attention_fw()`.
+   * @param gy Gradient of `y`.
+   * @param glse Gradient of `lse`.
+   * @param scale Scaling factor used by `attention_fw()`.
+   * @param gq Gradient of `q` to be updated.
+   * @param gk Gradient of `k` to be updated.
+   * @param gv Gradient of `v` to be updated.
+   * @param gmask Gradient of `mask` to be updated, or `nullptr`.
+   */
+  void attention_bw(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      const Tensor &y, const Tensor &lse,
+      const Tensor &gy, const Tensor &glse, float scale,
+      Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask);
+
+  /**
+   * Evaluates an elementwise program.
+   * @param program Program to evaluate.
+   * @param xs Inputs of the program. Batch broadcasting is applied.
+   * @return Output of the program.
+   * @throw primitiv::Error The device does not support elementwise programs.
+   */
+  Tensor elementwise_fw(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs);
+
+  /**
+   * Calculates gradients of an elementwise program.
+   * @param program Program used by `elementwise_fw()`.
+   * @param xs Inputs of the program.
+   * @param y Output of the program.
+   * @param gy Gradient of the output.
+   * @param gxs Gradients of inputs to be updated.
+   * @throw primitiv::Error The device does not support elementwise programs.
+   */
+  void elementwise_bw(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+      const std::vector<Tensor *> &gxs);
+
+  /**
+   * Calculates the sum of squared elements over all given tensors.
+   * @param xs List of tensors.
+   * @return Squared L2 norm of the concatenation of all tensors.
+   * @remarks This function synchronizes the device only once regardless of
+   *          the number of tensors.
+   */
+  float squared_norm(const std::vector<const Tensor *> &xs);
+
+  /**
+   * Updates parameters by the SGD rule: `x -= eta * g`.
+   * @param gs Gradients of parameters.
+   * @param eta Learning rate.
+   * @param xs Values of parameters to be updated.
+   * @remarks All update functions process any number of parameters at once,
+   *          and each element of `xs` and statistics should have the same
+   *          shape as the corresponding gradient.
+   */
+  void sgd_update(
+      const std::vector<const Tensor *> &gs, float eta,
+      const std::vector<Tensor *> &xs);
+
+  /**
+   * Updates parameters by the MomentumSGD rule:
+   * `m = momentum * m - eta * g; x += m`.
+   * @param gs Gradients of parameters.
+   * @param eta Learning rate.
+   * @param momentum Decay factor of the momentum.
+   * @param xs Values of parameters to be updated.
+   * @param ms Momentums to be updated.
+   */
+  void momentum_sgd_update(
+      const std::vector<const Tensor *> &gs, float eta, float momentum,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  /**
+   * Updates parameters by the AdaGrad rule:
+   * `m += g * g; x -= eta * g / (sqrt(m) + eps)`.
+   * @param gs Gradients of parameters.
+   * @param eta Learning rate.
+   * @param eps Bias of the denominator.
+   * @param xs Values of parameters to be updated.
+   * @param ms Accumulated squares of gradients to be updated.
+   */
+  void adagrad_update(
+      const std::vector<const Tensor *> &gs, float eta, float eps,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  /**
+   * Updates parameters by the RMSProp rule:
+   * `m = alpha * m + (1 - alpha) * g * g; x -= eta * g / (sqrt(m) + eps)`.
+   * @param gs Gradients of parameters.
+   * @param eta Learning rate.
+   * @param alpha Decay factor of the moment.
+   * @param eps Bias of the denominator.
+   * @param xs Values of parameters to be updated.
+   * @param ms Moments of squared gradients to be updated.
+   */
+  void rmsprop_update(
+      const std::vector<const Tensor *> &gs, float eta, float alpha, float eps,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  /**
+   * Updates parameters by the AdaDelta rule:
+   * `m2 = rho * m2 + (1 - rho) * g * g;
+   *  dx = sqrt((m1 + eps) / (m2 + eps)) * g;
+   *  m1 = rho * m1 + (1 - rho) * dx * dx; x -= scale * dx`.
+   * @param gs Gradients of parameters.
+   * @param scale Scaling factor of updates.
+   * @param rho Decay factor of moments.
+   * @param eps Bias of the fraction.
+   * @param xs Values of parameters to be updated.
+   * @param m1s Moments of squared updates to be updated.
+   * @param m2s Moments of squared gradients to be updated.
+   */
+  void adadelta_update(
+      const std::vector<const Tensor *> &gs, float scale, float rho, float eps,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s);
+
+  /**
+   * Updates parameters by the Adam rule:
+   * `m1 = beta1 * m1 + (1 - beta1) * g;
+   *  m2 = beta2 * m2 + (1 - beta2) * g * g;
+   *  x -= alpha * (m1 / (1 - beta1^epoch))
+   *       / (sqrt(m2 / (1 - beta2^epoch)) + eps)`.
+   * @param gs Gradients of parameters.
+   * @param alpha Learning rate.
+   * @param beta1 Decay factor of the first moment.
+   * @param beta2 Decay factor of the second moment.
+   * @param eps Bias of the denominator.
+   * @param epoch Number of updates including this update.
+   * @param xs Values of parameters to be updated.
+   * @param m1s First moments to be updated.
+   * @param m2s Second moments to be updated.
+   */
+  void adam_update(
+      const std::vector<const Tensor *> &gs,
+      float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s);
+
   /**
    * Directly multiplies all elements by a constant.
    * @param k A constant to multiply.
@@ -290,6 +720,21 @@ public:
    */
   void inplace_subtract(const Tensor &x, Tensor &y);
 
+  /**
+   * Directly overwrites slices of the second tensor by the first tensor.
+   * This is the inverse of `pick_fw()`: each minibatch of `x` is written to
+   * the slice of `y` selected by the corresponding ID along `dim`.
+   * @param x A tensor with new values.
+   * @param ids List of slice IDs.
+   * @param dim Dimension of slices.
+   * @param y A tensor to be updated.
+   * @remarks Shapes of tensors are checked in the same way as `pick_bw()`.
+   *          IDs should select distinct slices of each minibatch of `y`.
+   */
+  void pick_assign(
+      const Tensor &x, const std::vector<std::uint32_t> &ids,
+      std::uint32_t dim, Tensor &y);
+
 private:
   /**
    * Retrieves internal values of the tensor as a vector.
@@ -300,6 +745,15 @@ private:
    */
   std::vector<float> tensor_to_vector(const Tensor &x);
 
+  /**
+   * Retrieves internal values of the tensor into an array.
+   * @param x A tensor.
+   * @param values Pointer to the array which has at least `x.shape().size()`
+   *               elements.
+   * @remarks The order of values is same as that of `tensor_to_vector()`.
+   */
+  void tensor_to_array(const Tensor &x, float values[]);
+
   /**
    * Retrieves argmax indices along an axis.
    * @param x A tensor.
@@ -363,11 +817,15 @@ protected:
   void reset_tensor_by_vector(const std::vector<float> &values, Tensor &x);
 
 private:
+  std::unique_ptr<MemoryArena> arena_;
+  std::vector<std::pair<std::uint32_t, std::shared_ptr<void>>> placements_;
+
   // device-specific implementations.
 
   virtual std::shared_ptr<void> new_handle(const Shape &shape) = 0;
 
   virtual std::vector<float> tensor_to_vector_impl(const Tensor &x) = 0;
+  virtual void tensor_to_array_impl(const Tensor &x, float values[]);
   virtual std::vector<std::uint32_t> argmax_impl(const Tensor &x, std::uint32_t dim) = 0;
   virtual std::vector<std::uint32_t> argmin_impl(const Tensor &x, std::uint32_t dim) = 0;
 
@@ -528,10 +986,87 @@ private:
       std::uint32_t stride0, std::uint32_t stride1,
       Tensor &gx) = 0;
 
+  virtual void lstm_cell_fw_impl(
+      const Tensor &u, const Tensor &b, const Tensor &c,
+      Tensor &h, Tensor &c_new);
+
+  virtual void lstm_cell_bw_impl(
+      const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+      const Tensor &gh, const Tensor &gc_new,
+      Tensor &gu, Tensor &gb, Tensor &gc);
+
+  virtual void gru_cell_fw_impl(
+      const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y);
+
+  virtual void gru_cell_bw_impl(
+      const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+      Tensor &gux, Tensor &guh, Tensor &gh);
+
+  virtual void sru_fw_impl(
+      const Tensor &x, const Tensor &u, const Tensor &b,
+      Tensor &h, Tensor &c);
+
+  virtual void sru_bw_impl(
+      const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+      const Tensor &gh, const Tensor &gc,
+      Tensor &gx, Tensor &gu, Tensor &gb);
+
+  virtual void attention_fw_impl(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      float scale, Tensor &y, Tensor &lse);
+
+  virtual void attention_bw_impl(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      const Tensor &y, const Tensor &lse,
+      const Tensor &gy, const Tensor &glse, float scale,
+      Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask);
+
+  virtual void elementwise_fw_impl(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs, Tensor &y);
+
+  virtual void elementwise_bw_impl(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+      const std::vector<Tensor *> &gxs);
+
+  virtual float squared_norm_impl(const std::vector<const Tensor *> &xs);
+
+  virtual void sgd_update_impl(
+      const std::vector<const Tensor *> &gs, float eta,
+      const std::vector<Tensor *> &xs);
+
+  virtual void momentum_sgd_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float momentum,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  virtual void adagrad_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float eps,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  virtual void rmsprop_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float alpha, float eps,
+      const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms);
+
+  virtual void adadelta_update_impl(
+      const std::vector<const Tensor *> &gs, float scale, float rho, float eps,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s);
+
+  virtual void adam_update_impl(
+      const std::vector<const Tensor *> &gs,
+      float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s);
+
   virtual void inplace_multiply_const_impl(float k, Tensor &x) = 0;
 
   virtual void inplace_add_impl(const Tensor &x, Tensor &y) = 0;
   virtual void inplace_subtract_impl(const Tensor &x, Tensor &y) = 0;
+
+  virtual void pick_assign_impl(
+      const Tensor &x, const std::vector<std::uint32_t> &ids,
+      std::uint32_t dim, Tensor &y);
 };
 
 }  // namespace primitiv
@@ -0,0 +1,227 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <primitiv/core/elementwise_program.h>
+#include <primitiv/core/error.h>
+
+namespace {
+
+// Number of elements processed at once. Intermediate values of each block are
+// small enough to stay in the cache.
+constexpr std::uint32_t BLOCK_SIZE = 512;
+
+}  // namespace
+
+namespace primitiv {
+
+constexpr std::uint32_t ElementwiseProgram::MAX_REGISTERS;
+
+ElementwiseProgram::ElementwiseProgram(std::uint32_t num_inputs)
+: num_inputs_(num_inputs)
+, insts_() {
+  if (num_inputs == 0 || num_inputs >= MAX_REGISTERS) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid number of inputs of the elementwise program: "
+        << num_inputs);
+  }
+}
+
+std::uint32_t ElementwiseProgram::add_instruction(
+    Opcode opcode, std::uint32_t a, std::uint32_t b, float k) {
+  const std::uint32_t ret = num_registers();
+  if (ret >= MAX_REGISTERS) {
+    PRIMITIV_THROW_ERROR(
+        "Too many registers in the elementwise program. max: "
+        << MAX_REGISTERS);
+  }
+  if (!is_binary(opcode)) b = a;
+  if (a >= ret || b >= ret) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid operands of the elementwise instruction. a: " << a
+        << ", b: " << b << ", num_registers: " << ret);
+  }
+  insts_.emplace_back(Instruction {opcode, a, b, k});
+  return ret;
+}
+
+void ElementwiseProgram::Kernels::forward(
+    const Instruction &inst, const float *a, const float *b, float *y,
+    std::uint32_t n) const {
+  const float k = inst.k;
+#define LOOP(expr) \
+  for (std::uint32_t i = 0; i < n; ++i) { y[i] = (expr); } \
+  break;
+  switch (inst.opcode) {
+    case Opcode::COPY: LOOP(a[i]);
+    case Opcode::NEGATE: LOOP(-a[i]);
+    case Opcode::ABS: LOOP(std::abs(a[i]));
+    case Opcode::SQRT: LOOP(std::sqrt(a[i]));
+    case Opcode::EXP: LOOP(std::exp(a[i]));
+    case Opcode::LOG: LOOP(std::log(a[i]));
+    case Opcode::TANH: LOOP(std::tanh(a[i]));
+    case Opcode::SIGMOID: LOOP(.5 + .5 * std::tanh(.5 * a[i]));
+    case Opcode::SOFTPLUS:
+      LOOP(a[i] > 0
+          ? a[i] + std::log(1 + std::exp(-a[i]))
+          : std::log(1 + std::exp(a[i])));
+    case Opcode::SIN: LOOP(std::sin(a[i]));
+    case Opcode::COS: LOOP(std::cos(a[i]));
+    case Opcode::TAN: LOOP(std::tan(a[i]));
+    case Opcode::PRELU: LOOP(a[i] * ((a[i] > 0) + k * (a[i] <= 0)));
+    case Opcode::ELU:
+      LOOP(a[i] * (a[i] > 0) + k * (std::exp(a[i] * (a[i] <= 0)) - 1));
+    case Opcode::ADD_CONST: LOOP(a[i] + k);
+    case Opcode::SUBTRACT_CONST_R: LOOP(a[i] - k);
+    case Opcode::SUBTRACT_CONST_L: LOOP(k - a[i]);
+    case Opcode::MULTIPLY_CONST: LOOP(a[i] * k);
+    case Opcode::DIVIDE_CONST_R: LOOP(a[i] / k);
+    case Opcode::DIVIDE_CONST_L: LOOP(k / a[i]);
+    case Opcode::ADD: LOOP(a[i] + b[i]);
+    case Opcode::SUBTRACT: LOOP(a[i] - b[i]);
+    case Opcode::MULTIPLY: LOOP(a[i] * b[i]);
+    case Opcode::DIVIDE: LOOP(a[i] / b[i]);
+  }
+#undef LOOP
+}
+
+void ElementwiseProgram::Kernels::backward(
+    const Instruction &inst, const float *a, const float *b,
+    const float *y, const float *gy, float *ga, float *gb,
+    std::uint32_t n) const {
+  const float k = inst.k;
+#define LOOP(op) \
+  for (std::uint32_t i = 0; i < n; ++i) { op; } \
+  break;
+  switch (inst.opcode) {
+    case Opcode::COPY: LOOP(ga[i] += gy[i]);
+    case Opcode::NEGATE: LOOP(ga[i] -= gy[i]);
+    case Opcode::ABS: LOOP(ga[i] += ((a[i] > 0) - (a[i] < 0)) * gy[i]);
+    case Opcode::SQRT: LOOP(ga[i] += .5 * gy[i] / y[i]);
+    case Opcode::EXP: LOOP(ga[i] += y[i] * gy[i]);
+    case Opcode::LOG: LOOP(ga[i] += gy[i] / a[i]);
+    case Opcode::TANH: LOOP(ga[i] += (1. - y[i] * y[i]) * gy[i]);
+    case Opcode::SIGMOID: LOOP(ga[i] += y[i] * (1. - y[i]) * gy[i]);
+    case Opcode::SOFTPLUS:
+      LOOP(ga[i] += (.5 + .5 * std::tanh(.5 * a[i])) * gy[i]);
+    case Opcode::SIN: LOOP(ga[i] += std::cos(a[i]) * gy[i]);
+    case Opcode::COS: LOOP(ga[i] += -std::sin(a[i]) * gy[i]);
+    case Opcode::TAN: LOOP(ga[i] += (1 + y[i] * y[i]) * gy[i]);
+    case Opcode::PRELU:
+      LOOP(ga[i] += gy[i] * ((a[i] > 0) + k * (a[i] <= 0)));
+    case Opcode::ELU:
+      LOOP(ga[i] += gy[i] * ((a[i] > 0) + (y[i] + k) * (a[i] <= 0)));
+    case Opcode::ADD_CONST: LOOP(ga[i] += gy[i]);
+    case Opcode::SUBTRACT_CONST_R: LOOP(ga[i] += gy[i]);
+    case Opcode::SUBTRACT_CONST_L: LOOP(ga[i] -= gy[i]);
+    case Opcode::MULTIPLY_CONST: LOOP(ga[i] += k * gy[i]);
+    case Opcode::DIVIDE_CONST_R: LOOP(ga[i] += gy[i] / k);
+    case Opcode::DIVIDE_CONST_L: LOOP(ga[i] += -y[i] * gy[i] / a[i]);
+    case Opcode::ADD: LOOP(ga[i] += gy[i]; gb[i] += gy[i]);
+    case Opcode::SUBTRACT: LOOP(ga[i] += gy[i]; gb[i] -= gy[i]);
+    case Opcode::MULTIPLY:
+      LOOP(const float g = gy[i]; ga[i] += b[i] * g; gb[i] += a[i] * g);
+    case Opcode::DIVIDE:
+      LOOP(const float q = gy[i] / b[i]; ga[i] += q; gb[i] -= q * y[i]);
+  }
+#undef LOOP
+}
+
+void ElementwiseProgram::forward(
+    const std::vector<const float *> &xs,
+    const std::vector<std::uint32_t> &skips,
+    std::uint32_t volume, std::uint32_t batch_size,
+    float *y, const Kernels &kernels) const {
+  if (insts_.empty()) {
+    PRIMITIV_THROW_ERROR("The elementwise program has no instructions.");
+  }
+
+  // Minibatches are merged into one range if there are no broadcasted inputs.
+  bool merge = true;
+  for (const std::uint32_t skip : skips) merge = merge && skip == volume;
+  const std::uint32_t size = merge ? volume * batch_size : volume;
+  const std::uint32_t num_ranges = merge ? 1 : batch_size;
+  const std::uint32_t block_size = std::min(BLOCK_SIZE, size);
+  const std::uint32_t num_insts = insts_.size();
+
+  // The last instruction directly writes the output.
+  std::vector<float> values((num_insts - 1) * block_size);
+  std::vector<const float *> regs(num_registers());
+
+  for (std::uint32_t batch = 0; batch < num_ranges; ++batch) {
+    for (std::uint32_t offset = 0; offset < size; offset += block_size) {
+      const std::uint32_t n = std::min(block_size, size - offset);
+      for (std::uint32_t j = 0; j < num_inputs_; ++j) {
+        regs[j] = xs[j] + batch * skips[j] + offset;
+      }
+      for (std::uint32_t t = 0; t < num_insts; ++t) {
+        const Instruction &inst = insts_[t];
+        float *r = t == num_insts - 1
+          ? y + batch * volume + offset
+          : &values[t * block_size];
+        kernels.forward(inst, regs[inst.a], regs[inst.b], r, n);
+        regs[num_inputs_ + t] = r;
+      }
+    }
+  }
+}
+
+void ElementwiseProgram::backward(
+    const std::vector<const float *> &xs,
+    const std::vector<std::uint32_t> &skips,
+    std::uint32_t volume, std::uint32_t batch_size,
+    const float *y, const float *gy, const std::vector<float *> &gxs,
+    const Kernels &kernels) const {
+  if (insts_.empty()) {
+    PRIMITIV_THROW_ERROR("The elementwise program has no instructions.");
+  }
+
+  bool merge = true;
+  for (const std::uint32_t skip : skips) merge = merge && skip == volume;
+  const std::uint32_t size = merge ? volume * batch_size : volume;
+  const std::uint32_t num_ranges = merge ? 1 : batch_size;
+  const std::uint32_t block_size = std::min(BLOCK_SIZE, size);
+  const std::uint32_t num_insts = insts_.size();
+
+  // Values and gradients of all instructions except the last one, which are
+  // given by `y` and `gy`. Gradients of inputs are directly accumulated into
+  // `gxs`.
+  std::vector<float> values((num_insts - 1) * block_size);
+  std::vector<float> grads((num_insts - 1) * block_size);
+  std::vector<const float *> regs(num_registers());
+  std::vector<float *> gregs(num_registers());
+
+  for (std::uint32_t batch = 0; batch < num_ranges; ++batch) {
+    for (std::uint32_t offset = 0; offset < size; offset += block_size) {
+      const std::uint32_t n = std::min(block_size, size - offset);
+      for (std::uint32_t j = 0; j < num_inputs_; ++j) {
+        regs[j] = xs[j] + batch * skips[j] + offset;
+        gregs[j] = gxs[j] + batch * skips[j] + offset;
+      }
+      for (std::uint32_t t = 0; t < num_insts - 1; ++t) {
+        const Instruction &inst = insts_[t];
+        float *r = &values[t * block_size];
+        float *g = &grads[t * block_size];
+        kernels.forward(inst, regs[inst.a], regs[inst.b], r, n);
+        std::fill(g, g + n, 0);
+        regs[num_inputs_ + t] = r;
+        gregs[num_inputs_ + t] = g;
+      }
+      regs[num_inputs_ + num_insts - 1] = y + batch * volume + offset;
+
+      // Propagates gradients in the reverse order of instructions.
+      for (std::uint32_t t = num_insts; t > 0; --t) {
+        const Instruction &inst = insts_[t - 1];
+        const float *g = t == num_insts
+          ? gy + batch * volume + offset
+          : gregs[num_inputs_ + t - 1];
+        kernels.backward(
+            inst, regs[inst.a], regs[inst.b], regs[num_inputs_ + t - 1], g,
+            gregs[inst.a], gregs[inst.b], n);
+      }
+    }
+  }
+}
+
+}  // namespace primitiv
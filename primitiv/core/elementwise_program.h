@@ -0,0 +1,208 @@
+#ifndef PRIMITIV_CORE_ELEMENTWISE_PROGRAM_H_
+#define PRIMITIV_CORE_ELEMENTWISE_PROGRAM_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace primitiv {
+
+/**
+ * Sequence of elementwise instructions which is evaluated by one pass over
+ * the memory. Intermediate results are kept only for small blocks of
+ * elements.
+ * Registers `0` to `num_inputs() - 1` hold values of inputs, and the result
+ * of the `i`-th instruction is stored to the register `num_inputs() + i`.
+ * The result of the last instruction becomes the output of the program.
+ */
+class ElementwiseProgram {
+public:
+  /**
+   * Maximum number of registers, including inputs.
+   */
+  static constexpr std::uint32_t MAX_REGISTERS = 64;
+
+  /**
+   * Kinds of instructions.
+   * Binary instructions use both `a` and `b` operands, and `*_CONST*`,
+   * `PRELU` and `ELU` instructions use the immediate `k`.
+   */
+  enum class Opcode : std::uint8_t {
+    COPY,
+    NEGATE,
+    ABS,
+    SQRT,
+    EXP,
+    LOG,
+    TANH,
+    SIGMOID,
+    SOFTPLUS,
+    SIN,
+    COS,
+    TAN,
+    PRELU,
+    ELU,
+    ADD_CONST,
+    SUBTRACT_CONST_R,
+    SUBTRACT_CONST_L,
+    MULTIPLY_CONST,
+    DIVIDE_CONST_R,
+    DIVIDE_CONST_L,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+  };
+
+  /**
+   * One instruction of the program.
+   */
+  struct Instruction {
+    Opcode opcode;
+    std::uint32_t a;
+    std::uint32_t b;
+    float k;
+  };
+
+  /**
+   * Implementations of each instruction over contiguous elements.
+   * Programs are evaluated block-wise by calling these functions one
+   * instruction at a time. The default implementation uses plain loops, and
+   * devices can override them with vectorized kernels.
+   */
+  class Kernels {
+  public:
+    Kernels() = default;
+    Kernels(const Kernels &) = delete;
+    Kernels &operator=(const Kernels &) = delete;
+    virtual ~Kernels() = default;
+
+    /**
+     * Calculates the result of one instruction.
+     * @param inst Instruction.
+     * @param a Pointer to the first operand.
+     * @param b Pointer to the second operand. Ignored for unary
+     *          instructions.
+     * @param y Pointer to the result.
+     * @param n Number of elements.
+     */
+    virtual void forward(
+        const Instruction &inst, const float *a, const float *b, float *y,
+        std::uint32_t n) const;
+
+    /**
+     * Calculates gradients of operands of one instruction and accumulates
+     * them.
+     * @param inst Instruction.
+     * @param a Pointer to the first operand.
+     * @param b Pointer to the second operand. Ignored for unary
+     *          instructions.
+     * @param y Pointer to the result.
+     * @param gy Pointer to the gradient of the result.
+     * @param ga Pointer to the gradient of the first operand.
+     * @param gb Pointer to the gradient of the second operand. Ignored for
+     *           unary instructions. This may be the same as `ga`.
+     * @param n Number of elements.
+     */
+    virtual void backward(
+        const Instruction &inst, const float *a, const float *b,
+        const float *y, const float *gy, float *ga, float *gb,
+        std::uint32_t n) const;
+  };
+
+  /**
+   * Creates a new program without instructions.
+   * @param num_inputs Number of inputs.
+   * @throw primitiv::Error `num_inputs` is 0 or too large.
+   */
+  explicit ElementwiseProgram(std::uint32_t num_inputs);
+
+  /**
+   * Returns the number of inputs.
+   * @return Number of inputs.
+   */
+  std::uint32_t num_inputs() const { return num_inputs_; }
+
+  /**
+   * Returns the number of registers used by the program.
+   * @return Number of registers.
+   */
+  std::uint32_t num_registers() const {
+    return num_inputs_ + insts_.size();
+  }
+
+  /**
+   * Returns the list of instructions.
+   * @return List of instructions.
+   */
+  const std::vector<Instruction> &instructions() const { return insts_; }
+
+  /**
+   * Checks whether the opcode takes two operands or not.
+   * @param opcode Opcode.
+   * @return true if the instruction is binary, false otherwise.
+   */
+  static bool is_binary(Opcode opcode) {
+    return opcode >= Opcode::ADD;
+  }
+
+  /**
+   * Appends a new instruction.
+   * @param opcode Opcode of the instruction.
+   * @param a Register ID of the first operand.
+   * @param b Register ID of the second operand. Ignored for unary
+   *          instructions.
+   * @param k Immediate value. Ignored for instructions without immediates.
+   * @return Register ID of the result.
+   * @throw primitiv::Error Operands are not available yet, or the program has
+   *                        no more registers.
+   */
+  std::uint32_t add_instruction(
+      Opcode opcode, std::uint32_t a, std::uint32_t b = 0, float k = 0);
+
+  /**
+   * Evaluates the program.
+   * @param xs Pointers to the values of inputs.
+   * @param skips Strides between minibatches for each input: `volume` for
+   *              batched inputs and 0 for broadcasted inputs.
+   * @param volume Number of elements in each minibatch.
+   * @param batch_size Batch size of the output.
+   * @param y Pointer to the output.
+   * @param kernels Implementations of instructions.
+   * @throw primitiv::Error The program has no instructions.
+   */
+  void forward(
+      const std::vector<const float *> &xs,
+      const std::vector<std::uint32_t> &skips,
+      std::uint32_t volume, std::uint32_t batch_size,
+      float *y, const Kernels &kernels = Kernels()) const;
+
+  /**
+   * Calculates gradients of inputs and accumulates them.
+   * @param xs Pointers to the values of inputs.
+   * @param skips Strides between minibatches for each input: `volume` for
+   *              batched inputs and 0 for broadcasted inputs.
+   * @param volume Number of elements in each minibatch.
+   * @param batch_size Batch size of the output.
+   * @param y Pointer to the output calculated by `forward()`.
+   * @param gy Pointer to the gradient of the output.
+   * @param gxs Pointers to the gradients of inputs.
+   * @param kernels Implementations of instructions.
+   * @throw primitiv::Error The program has no instructions.
+   * @remarks Gradients of broadcasted inputs are summed over minibatches.
+   */
+  void backward(
+      const std::vector<const float *> &xs,
+      const std::vector<std::uint32_t> &skips,
+      std::uint32_t volume, std::uint32_t batch_size,
+      const float *y, const float *gy, const std::vector<float *> &gxs,
+      const Kernels &kernels = Kernels()) const;
+
+private:
+
+  std::uint32_t num_inputs_;
+  std::vector<Instruction> insts_;
+};
+
+}  // namespace primitiv
+
+#endif  // PRIMITIV_CORE_ELEMENTWISE_PROGRAM_H_
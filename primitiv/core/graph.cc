@@ -1,14 +1,23 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
 #include <cstdlib>
-#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <tuple>
+#include <limits>
 #include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
+#include <primitiv/core/device.h>
 #include <primitiv/core/error.h>
 #include <primitiv/core/functions.h>
 #include <primitiv/core/graph.h>
+#include <primitiv/core/operator_impl.h>
 #include <primitiv/core/string_utils.h>
 
 using std::cerr;
@@ -19,8 +28,162 @@ using std::vector;
 
 namespace primitiv {
 
+namespace {
+
+// Sentinel of unplanned offsets.
+constexpr std::size_t NO_OFFSET = std::numeric_limits<std::size_t>::max();
+
+// Alignment of each block in memory arenas.
+constexpr std::size_t ARENA_ALIGNMENT = 64;
+
+// Places the next tensor on the memory arena of the device if possible.
+// Offsets which exceed the current arena (i.e., made by an older plan) are
+// ignored.
+void place_next_tensor(Device &dev, std::size_t offset, const Shape &shape) {
+  if (offset == NO_OFFSET) return;
+  const std::uint32_t size = shape.size();
+  if (offset + sizeof(float) * size > dev.memory_arena_size()) return;
+  dev.place_next_tensor(offset, size);
+}
+
+// Returns a readable name of the device.
+std::string device_name(const Device &dev) {
+  std::stringstream ss;
+  switch (dev.type()) {
+    case DeviceType::NAIVE: ss << "Naive"; break;
+    case DeviceType::EIGEN: ss << "Eigen"; break;
+    case DeviceType::CUDA: ss << "CUDA"; break;
+    case DeviceType::CUDA16: ss << "CUDA16"; break;
+    case DeviceType::OPENCL: ss << "OpenCL"; break;
+    default: ss << "Device";
+  }
+  ss << '@' << &dev;
+  return ss.str();
+}
+
+// Escapes the string to embed it into JSON.
+std::string escape_json(const std::string &str) {
+  std::stringstream ss;
+  for (const char c : str) {
+    switch (c) {
+      case '"': ss << "\\\""; break;
+      case '\\': ss << "\\\\"; break;
+      case '\n': ss << "\\n"; break;
+      default: ss << c;
+    }
+  }
+  return ss.str();
+}
+
+// Checks whether the value of the operator can be released and recalculated
+// later by the gradient checkpointing.
+bool is_recomputable(const Operator &op) {
+  return !op.has_inner_values()
+    && !op.has_side_effects()
+    && typeid(op) != typeid(operators::Checkpoint);
+}
+
+// Maximum number of operators merged into one fused operator.
+// A chain of n operators has at most n + 1 inputs, hence the fused program
+// always fits into the registers.
+constexpr std::uint32_t MAX_FUSED_OPERATORS =
+  (ElementwiseProgram::MAX_REGISTERS - 1) / 2;
+
+// Retrieves the elementwise instruction equivalent to the operator.
+// Returns false if the operator can not be fused.
+bool get_elementwise_instruction(
+    const Operator &op, ElementwiseProgram::Opcode &opcode, float &k) {
+  using Opcode = ElementwiseProgram::Opcode;
+  const std::type_info &type = typeid(op);
+#define MAP_OPERATOR(cls, code, value) \
+  if (type == typeid(operators::cls)) { \
+    opcode = Opcode::code; \
+    k = (value); \
+    return true; \
+  }
+#define MAP_OPERATOR_K(cls, code) \
+  MAP_OPERATOR(cls, code, static_cast<const operators::cls &>(op).k())
+  MAP_OPERATOR(Positive, COPY, 0);
+  MAP_OPERATOR(Negative, NEGATE, 0);
+  MAP_OPERATOR(Abs, ABS, 0);
+  MAP_OPERATOR(Sqrt, SQRT, 0);
+  MAP_OPERATOR(Exp, EXP, 0);
+  MAP_OPERATOR(Log, LOG, 0);
+  MAP_OPERATOR(Tanh, TANH, 0);
+  MAP_OPERATOR(Sigmoid, SIGMOID, 0);
+  MAP_OPERATOR(Softplus, SOFTPLUS, 0);
+  MAP_OPERATOR(Sin, SIN, 0);
+  MAP_OPERATOR(Cos, COS, 0);
+  MAP_OPERATOR(Tan, TAN, 0);
+  MAP_OPERATOR(ReLU, PRELU, 0);
+  MAP_OPERATOR(LReLU, PRELU, .01);
+  MAP_OPERATOR_K(PReLU, PRELU);
+  MAP_OPERATOR_K(ELU, ELU);
+  MAP_OPERATOR_K(AddConst, ADD_CONST);
+  MAP_OPERATOR_K(SubtractConstR, SUBTRACT_CONST_R);
+  MAP_OPERATOR_K(SubtractConstL, SUBTRACT_CONST_L);
+  MAP_OPERATOR_K(MultiplyConst, MULTIPLY_CONST);
+  MAP_OPERATOR_K(DivideConstR, DIVIDE_CONST_R);
+  MAP_OPERATOR_K(DivideConstL, DIVIDE_CONST_L);
+  MAP_OPERATOR(Add, ADD, 0);
+  MAP_OPERATOR(Subtract, SUBTRACT, 0);
+  MAP_OPERATOR(Multiply, MULTIPLY, 0);
+  MAP_OPERATOR(Divide, DIVIDE, 0);
+#undef MAP_OPERATOR_K
+#undef MAP_OPERATOR
+  return false;
+}
+
+}  // namespace
+
 void Graph::clear() {
   ops_.clear();
+  num_checkpoints_ = 0;
+  clear_profile();
+}
+
+void Graph::clear_profile() {
+  const std::lock_guard<std::mutex> lock(profile_mutex_);
+  profile_.clear();
+  profile_origin_ = std::chrono::steady_clock::now();
+}
+
+void Graph::discard_values() {
+  for (OperatorInfo &f : ops_) {
+    for (NodeInfo &n : f.rets) {
+      n.value.invalidate();
+      n.grad.invalidate();
+      n.num_pending_sinks = n.sinks.size();
+      n.pinned = false;
+    }
+    f.computed = false;
+  }
+}
+
+void Graph::set_num_threads(std::uint32_t num_threads) {
+  if (num_threads == 0) {
+    PRIMITIV_THROW_ERROR("Number of threads should be greater than 0.");
+  }
+  if (num_threads == this->num_threads()) return;
+  thread_pool_.reset(num_threads > 1 ? new ThreadPool(num_threads) : nullptr);
+}
+
+void Graph::set_operator_fusion(bool enabled) {
+  if (!enabled) {
+    for (OperatorInfo &f : ops_) {
+      f.fusion.reset();
+    }
+  }
+  operator_fusion_ = enabled;
+}
+
+void Graph::set_inference_mode(bool enabled) {
+  if (!ops_.empty()) {
+    PRIMITIV_THROW_ERROR(
+        "Could not change the inference mode of the graph which already has "
+        "some operators. num_operators: " << ops_.size());
+  }
+  inference_mode_ = enabled;
 }
 
 #define CHECK_NODE(n) { \
@@ -90,6 +253,10 @@ vector<Node> Graph::add_operator(
   vector<Shape *> ret_shapes(retn);
   for (std::uint32_t i = 0; i < retn; ++i) {
     rets[i].device = ret_device;
+    rets[i].num_pending_sinks = 0;
+    rets[i].pinned = false;
+    rets[i].value_offset = NO_OFFSET;
+    rets[i].grad_offset = NO_OFFSET;
     ret_shapes[i] = &rets[i].shape;
   }
 
@@ -98,11 +265,40 @@ vector<Node> Graph::add_operator(
   op->forward_shape(arg_shapes, ret_shapes);
 
   // Updates the graph.
+  if (typeid(*op) == typeid(operators::Checkpoint)) ++num_checkpoints_;
   const std::uint32_t ret_oid = ops_.size();
-  //for (const Address &arg_addr : arg_addrs) {
-  //  ops_[arg_addr.oid].rets[arg_addr.vid].sinks.emplace_back(ret_oid);
-  //}
-  ops_.emplace_back(OperatorInfo { move(op), move(arg_addrs), move(rets) });
+  for (const Address &arg_addr : arg_addrs) {
+    NodeInfo &arg_n = ops_[arg_addr.oid].rets[arg_addr.vid];
+    arg_n.sinks.emplace_back(ret_oid);
+    ++arg_n.num_pending_sinks;
+  }
+  ops_.emplace_back(
+      OperatorInfo { move(op), move(arg_addrs), move(rets), false, {}, {}, {},
+        {}, {}, nullptr });
+
+  // Prepares pointers to arguments and return values.
+  // These pointers remain valid even if `ops_` is reallocated, because each
+  // NodeInfo is owned by the heap memory of `OperatorInfo::rets`.
+  OperatorInfo &new_f = ops_.back();
+  new_f.args_v.reserve(argn);
+  new_f.args_g.reserve(argn);
+  for (const Address arg : new_f.args) {
+    OperatorInfo &arg_f = ops_[arg.oid];
+    NodeInfo &arg_n = arg_f.rets[arg.vid];
+    new_f.args_v.emplace_back(
+        arg_f.op->has_inner_values()
+        ? arg_f.op->get_inner_values()[arg.vid]
+        : &arg_n.value);
+    new_f.args_g.emplace_back(&arg_n.grad);
+  }
+  new_f.rets_v.reserve(retn);
+  new_f.rets_cv.reserve(retn);
+  new_f.rets_g.reserve(retn);
+  for (NodeInfo &ret : new_f.rets) {
+    new_f.rets_v.emplace_back(&ret.value);
+    new_f.rets_cv.emplace_back(&ret.value);
+    new_f.rets_g.emplace_back(&ret.grad);
+  }
 
   // Creates Node objects.
   vector<Node> nodes;
@@ -113,113 +309,774 @@ vector<Node> Graph::add_operator(
   return nodes;
 }
 
+operators::Input &Graph::get_input_operator(const Node &node) {
+  CHECK_NODE(node);
+  OperatorInfo &f = ops_[node.oid_];
+  operators::Input *input = dynamic_cast<operators::Input *>(f.op.get());
+  if (!input) {
+    PRIMITIV_THROW_ERROR(
+        "Node is not an input. operator: '" << f.op->name() << "'");
+  }
+  return *input;
+}
+
+void Graph::set_input(const Node &node, const vector<float> &data) {
+  get_input_operator(node).set_data(data);
+  discard_dependents(node.oid_);
+}
+
+void Graph::set_input(const Node &node, const Tensor &value) {
+  get_input_operator(node).set_value(value);
+  discard_dependents(node.oid_);
+}
+
+void Graph::discard_dependents(std::uint32_t root) {
+  std::unordered_set<std::uint32_t> visited { root };
+  vector<std::uint32_t> stack { root };
+  while (!stack.empty()) {
+    const std::uint32_t oid = stack.back();
+    stack.pop_back();
+    discard_operator(oid);
+    for (const NodeInfo &n : ops_[oid].rets) {
+      for (const std::uint32_t sink : n.sinks) {
+        if (visited.emplace(sink).second) stack.emplace_back(sink);
+      }
+    }
+  }
+}
+
+void Graph::discard_operator(std::uint32_t oid) {
+  OperatorInfo &f = ops_[oid];
+  for (NodeInfo &n : f.rets) {
+    n.value.invalidate();
+    n.grad.invalidate();
+  }
+  if (f.computed) {
+    // Arguments are required again in the inference mode.
+    f.computed = false;
+    for (const Address arg : f.args) {
+      ++ops_[arg.oid].rets[arg.vid].num_pending_sinks;
+    }
+  }
+}
+
 const Tensor &Graph::forward(const Node &node) {
   CHECK_NODE(node);
+  const Address addr { node.oid_, node.vid_ };
+
+  if (inference_mode_) {
+    forward_inference({ addr });
+    return get_value(addr);
+  }
+  if (memory_planning_) {
+    forward_planned(addr, collect_uncalculated({ addr }));
+    return get_value(addr);
+  }
 
-  std::function<const Tensor *(const Address)> forward_recursive = [&](
-      const Address addr) -> const Tensor * {
-    OperatorInfo &cur_f = ops_[addr.oid];
+  if (num_checkpoints_ > 0) {
+    forward_checkpointed({ addr });
+    return get_value(addr);
+  }
 
-    if (cur_f.op->has_inner_values()) {
-      return cur_f.op->get_inner_values()[addr.vid];
+  vector<std::uint32_t> oids = collect_uncalculated({ addr });
+  if (operator_fusion_) oids = fuse_operators(oids, { addr });
+  forward_operators(oids);
+  return get_value(addr);
+}
+
+vector<const Tensor *> Graph::forward(const vector<Node> &nodes) {
+  vector<Address> addrs;
+  addrs.reserve(nodes.size());
+  for (const Node &node : nodes) {
+    CHECK_NODE(node);
+    addrs.emplace_back(Address { node.oid_, node.vid_ });
+  }
+
+  if (inference_mode_) {
+    forward_inference(addrs);
+  } else if (num_checkpoints_ > 0 && !memory_planning_) {
+    forward_checkpointed(addrs);
+  } else if (!memory_planning_) {
+    vector<std::uint32_t> oids = collect_uncalculated(addrs);
+    if (operator_fusion_) oids = fuse_operators(oids, addrs);
+    forward_operators(oids);
+  }
+
+  vector<const Tensor *> ret;
+  ret.reserve(nodes.size());
+  for (const Node &node : nodes) {
+    // Except the memory planning, all values are already calculated and this
+    // call only returns the retained value.
+    ret.emplace_back(&forward(node));
+  }
+  return ret;
+}
+
+void Graph::forward_inference(const vector<Address> &addrs) {
+  // Retains all target values.
+  for (const Address addr : addrs) {
+    ops_[addr.oid].rets[addr.vid].pinned = true;
+  }
+
+  // Gathers operators which should be calculated in this call, and counts the
+  // number of uses of each value among them.
+  const auto key = [](const Address addr) {
+    return (static_cast<std::uint64_t>(addr.oid) << 32) | addr.vid;
+  };
+  const vector<std::uint32_t> oids = collect_uncalculated(addrs);
+  std::unordered_map<std::uint64_t, std::uint32_t> num_uses;
+  for (const std::uint32_t oid : oids) {
+    for (const Address arg : ops_[oid].args) {
+      ++num_uses[key(arg)];
     }
+  }
+
+  const auto maybe_release = [&](const Address addr) {
+    NodeInfo &n = ops_[addr.oid].rets[addr.vid];
+    if (n.pinned || n.num_pending_sinks > 0) return;
+    const auto it = num_uses.find(key(addr));
+    if (it == num_uses.end() || it->second == 0) n.value.invalidate();
+  };
+
+  for (const std::uint32_t oid : oids) {
+    OperatorInfo &cur_f = ops_[oid];
+    const std::uint32_t retn = cur_f.rets.size();
 
-    NodeInfo &cur_n = cur_f.rets[addr.vid];
-    if (cur_n.value.valid()) {
-      return &cur_n.value;
+    forward_operator(oid);
+
+    // Releases values which are no longer required.
+    const bool first = !cur_f.computed;
+    cur_f.computed = true;
+    for (const Address arg : cur_f.args) {
+      if (ops_[arg.oid].op->has_inner_values()) continue;
+      if (first) --ops_[arg.oid].rets[arg.vid].num_pending_sinks;
+      --num_uses[key(arg)];
+      maybe_release(arg);
+    }
+    for (std::uint32_t i = 0; i < retn; ++i) {
+      maybe_release(Address { oid, i });
+    }
+  }
+}
+
+void Graph::forward_checkpointed(const vector<Address> &addrs) {
+  // Retains all target values.
+  for (const Address addr : addrs) {
+    ops_[addr.oid].rets[addr.vid].pinned = true;
+  }
+
+  // Counts the number of uses of each value in this call.
+  const auto key = [](const Address addr) {
+    return (static_cast<std::uint64_t>(addr.oid) << 32) | addr.vid;
+  };
+  const vector<std::uint32_t> oids = collect_uncalculated(addrs);
+  std::unordered_map<std::uint64_t, std::uint32_t> num_uses;
+  for (const std::uint32_t oid : oids) {
+    for (const Address arg : ops_[oid].args) {
+      ++num_uses[key(arg)];
     }
+  }
+
+  const auto maybe_release = [&](const Address addr) {
+    OperatorInfo &f = ops_[addr.oid];
+    NodeInfo &n = f.rets[addr.vid];
+    if (n.pinned || !is_recomputable(*f.op)) return;
+    const auto it = num_uses.find(key(addr));
+    if (it == num_uses.end() || it->second == 0) n.value.invalidate();
+  };
+
+  for (const std::uint32_t oid : oids) {
+    OperatorInfo &cur_f = ops_[oid];
+    cur_f.fusion.reset();
+    forward_operator(oid);
 
-    // Gathers arguments and return values.
-    vector<const Tensor *> args_v;
-    vector<Tensor *> rets_v;
-    args_v.reserve(cur_f.args.size());
-    rets_v.reserve(cur_f.rets.size());
+    // Releases values which are no longer required in this call.
+    // They are recalculated by backward() if necessary.
     for (const Address arg : cur_f.args) {
-      args_v.emplace_back(forward_recursive(arg));
+      const auto it = num_uses.find(key(arg));
+      if (it != num_uses.end()) --it->second;
+      maybe_release(arg);
+    }
+    for (std::uint32_t vid = 0; vid < cur_f.rets.size(); ++vid) {
+      maybe_release(Address { oid, vid });
     }
+  }
+}
+
+void Graph::recompute_values(std::uint32_t oid) {
+  OperatorInfo &f = ops_[oid];
+  f.fusion.reset();
+
+  vector<Address> required;
+  for (std::uint32_t vid = 0; vid < f.rets.size(); ++vid) {
+    if (!f.rets[vid].value.valid()) required.emplace_back(Address { oid, vid });
+  }
+  for (const Address arg : f.args) {
+    const OperatorInfo &arg_f = ops_[arg.oid];
+    if (arg_f.op->has_inner_values()) continue;
+    if (!arg_f.rets[arg.vid].value.valid()) required.emplace_back(arg);
+  }
+  if (required.empty()) return;
+
+  // This recalculates the whole segment from the nearest checkpoints, and
+  // following backward steps in the same segment reuse these values.
+  for (const std::uint32_t i : collect_uncalculated(required)) {
+    ops_[i].fusion.reset();
+    forward_operator(i);
+  }
+}
+
+void Graph::forward_planned(
+    const Address addr, const vector<std::uint32_t> &oids) {
+  ops_[addr.oid].rets[addr.vid].pinned = true;
+  if (oids.empty()) return;
+
+  plan_memory(addr, oids);
+
+  for (const std::uint32_t oid : oids) {
+    OperatorInfo &cur_f = ops_[oid];
+    for (NodeInfo &ret : cur_f.rets) {
+      place_next_tensor(*ret.device, ret.value_offset, ret.shape);
+    }
+
+    // Planned lifetimes assume the original arguments.
+    cur_f.fusion.reset();
+    forward_operator(oid);
+
+    // Some operators do not allocate new memory for return values (e.g., they
+    // return views of arguments), and placements remain in such cases.
     for (NodeInfo &ret : cur_f.rets) {
-      rets_v.emplace_back(&ret.value);
+      ret.device->discard_placements();
     }
+  }
+}
+
+void Graph::plan_memory(
+    const Address addr, const vector<std::uint32_t> &oids) {
+  // The timeline consists of `oids.size()` forward steps followed by backward
+  // steps for all operators from `addr.oid` down to 0.
+  // Each block is alive during the closed interval [begin, end] of steps.
+  constexpr std::uint32_t FOREVER = std::numeric_limits<std::uint32_t>::max();
+  const std::uint32_t num_fw_steps = oids.size();
+  const auto bw_step = [&](std::uint32_t oid) {
+    return num_fw_steps + (addr.oid - oid);
+  };
+
+  struct Block {
+    Device *device;
+    std::size_t size;
+    std::uint32_t begin;
+    std::uint32_t end;
+    std::size_t *offset;
+  };
+  vector<Block> blocks;
+  const auto add_block = [&](
+      NodeInfo &n, std::size_t *offset,
+      std::uint32_t begin, std::uint32_t end) {
+    *offset = NO_OFFSET;
+    if (!n.device->supports_memory_arena()) return;
+    const std::size_t size = sizeof(float) * n.shape.size();
+    blocks.emplace_back(Block {
+        n.device,
+        (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT,
+        begin, end, offset });
+  };
 
-    // Calculates the value.
-    cur_f.op->forward(args_v, rets_v);
+  // Values are alive from the forward step to the backward step of the
+  // producer. Retained values are alive forever.
+  for (std::uint32_t step = 0; step < num_fw_steps; ++step) {
+    const std::uint32_t oid = oids[step];
+    for (NodeInfo &ret : ops_[oid].rets) {
+      add_block(
+          ret, &ret.value_offset, step, ret.pinned ? FOREVER : bw_step(oid));
+    }
+  }
 
-    return &cur_n.value;
+  // Gradients are alive from the backward step of the last consumer to the
+  // backward step of the producer.
+  const auto key = [](const Address addr) {
+    return (static_cast<std::uint64_t>(addr.oid) << 32) | addr.vid;
   };
+  const vector<std::uint32_t> ancestors = collect_ancestors(addr);
+  std::unordered_map<std::uint64_t, std::uint32_t> last_consumers;
+  for (const std::uint32_t oid : ancestors) {
+    for (const Address arg : ops_[oid].args) {
+      // `ancestors` is sorted, and the last assignment is the largest one.
+      last_consumers[key(arg)] = oid;
+    }
+  }
+  for (const std::uint32_t oid : ancestors) {
+    OperatorInfo &f = ops_[oid];
+    for (std::uint32_t vid = 0; vid < f.rets.size(); ++vid) {
+      const auto it = last_consumers.find(key(Address { oid, vid }));
+      const std::uint32_t begin = it != last_consumers.end()
+        ? bw_step(it->second)
+        : bw_step(oid);
+      add_block(f.rets[vid], &f.rets[vid].grad_offset, begin, bw_step(oid));
+    }
+  }
+
+  // Assigns offsets device by device.
+  // Larger blocks are placed first at the lowest offset which does not
+  // overlap with any placed block alive at the same time.
+  std::unordered_map<Device *, vector<std::uint32_t>> device_blocks;
+  for (std::uint32_t i = 0; i < blocks.size(); ++i) {
+    device_blocks[blocks[i].device].emplace_back(i);
+  }
+  planned_sizes_.clear();
+  for (auto &kv : device_blocks) {
+    vector<std::uint32_t> &ids = kv.second;
+    std::sort(
+        ids.begin(), ids.end(),
+        [&](std::uint32_t a, std::uint32_t b) {
+          const Block &ba = blocks[a];
+          const Block &bb = blocks[b];
+          return ba.size != bb.size ? ba.size > bb.size : ba.begin < bb.begin;
+        });
 
-  return *forward_recursive(Address { node.oid_, node.vid_ });
+    std::size_t peak = 0;
+    vector<std::uint32_t> placed;
+    vector<std::pair<std::size_t, std::size_t>> conflicts;
+    for (const std::uint32_t id : ids) {
+      const Block &cur = blocks[id];
+      conflicts.clear();
+      for (const std::uint32_t other_id : placed) {
+        const Block &other = blocks[other_id];
+        if (cur.begin <= other.end && other.begin <= cur.end) {
+          conflicts.emplace_back(*other.offset, other.size);
+        }
+      }
+      std::sort(conflicts.begin(), conflicts.end());
+      std::size_t offset = 0;
+      for (const auto &c : conflicts) {
+        if (offset + cur.size <= c.first) break;
+        offset = std::max(offset, c.first + c.second);
+      }
+      *cur.offset = offset;
+      peak = std::max(peak, offset + cur.size);
+      placed.emplace_back(id);
+    }
+
+    kv.first->reserve_memory_arena(peak);
+    planned_sizes_[kv.first] = peak;
+  }
+}
+
+vector<std::uint32_t> Graph::collect_uncalculated(
+    const vector<Address> &addrs) const {
+  vector<std::uint32_t> oids;
+  std::unordered_set<std::uint32_t> visited;
+  vector<Address> stack(addrs.begin(), addrs.end());
+  while (!stack.empty()) {
+    const Address addr = stack.back();
+    stack.pop_back();
+    const OperatorInfo &f = ops_[addr.oid];
+    if (f.op->has_inner_values() || f.rets[addr.vid].value.valid()) continue;
+    if (!visited.emplace(addr.oid).second) continue;
+    oids.emplace_back(addr.oid);
+    for (const Address arg : f.args) {
+      stack.emplace_back(arg);
+    }
+  }
+
+  // Operator IDs are already sorted in the topological order.
+  std::sort(oids.begin(), oids.end());
+  return oids;
+}
+
+vector<std::uint32_t> Graph::collect_ancestors(const Address addr) const {
+  vector<std::uint32_t> oids;
+  std::unordered_set<std::uint32_t> visited { addr.oid };
+  vector<std::uint32_t> stack { addr.oid };
+  while (!stack.empty()) {
+    const std::uint32_t oid = stack.back();
+    stack.pop_back();
+    oids.emplace_back(oid);
+    for (const Address arg : ops_[oid].args) {
+      if (visited.emplace(arg.oid).second) stack.emplace_back(arg.oid);
+    }
+  }
+  std::sort(oids.begin(), oids.end());
+  return oids;
+}
+
+template<typename Fn>
+void Graph::profile_operator(std::uint32_t oid, bool backward, Fn &&fn) {
+  using Clock = std::chrono::steady_clock;
+  const std::uint64_t bytes = Device::get_thread_allocated_bytes();
+  const Clock::time_point begin = Clock::now();
+  fn();
+  const Clock::time_point end = Clock::now();
+
+  const OperatorInfo &f = ops_[oid];
+  ProfileRecord record {
+    oid, backward, f.fusion ? f.fusion->op->name() : f.op->name(),
+    get_effective_args(f), std::this_thread::get_id(),
+    begin - profile_origin_, end - begin,
+    Device::get_thread_allocated_bytes() - bytes };
+  const std::lock_guard<std::mutex> lock(profile_mutex_);
+  profile_.emplace_back(move(record));
+}
+
+void Graph::forward_operator(std::uint32_t oid) {
+  OperatorInfo &f = ops_[oid];
+  const auto fn = [&] {
+    if (f.fusion) f.fusion->op->forward(f.fusion->args_v, f.rets_v);
+    else f.op->forward(f.args_v, f.rets_v);
+  };
+  if (profiling_) profile_operator(oid, false, fn);
+  else fn();
+}
+
+void Graph::backward_operator(std::uint32_t oid) {
+  OperatorInfo &f = ops_[oid];
+  const auto fn = [&] {
+    if (f.fusion) {
+      f.fusion->op->backward(
+          f.fusion->args_v, f.rets_cv, f.rets_g, f.fusion->args_g);
+    } else {
+      f.op->backward(f.args_v, f.rets_cv, f.rets_g, f.args_g);
+    }
+  };
+  if (profiling_) profile_operator(oid, true, fn);
+  else fn();
+}
+
+vector<std::uint32_t> Graph::fuse_operators(
+    const vector<std::uint32_t> &oids, const vector<Address> &addrs) {
+  std::unordered_set<std::uint32_t> candidates(oids.begin(), oids.end());
+  for (const Address addr : addrs) {
+    candidates.erase(addr.oid);
+  }
+
+  // Operators are visited in descending order so that each chain is absorbed
+  // into its last operator.
+  std::unordered_set<std::uint32_t> absorbed;
+  for (auto it = oids.rbegin(); it != oids.rend(); ++it) {
+    OperatorInfo &f = ops_[*it];
+    if (absorbed.count(*it)) {
+      f.fusion.reset();
+      continue;
+    }
+
+    // Reuses the previous fusion if all members are still available.
+    bool reusable = !!f.fusion;
+    if (reusable) {
+      for (const std::uint32_t m : f.fusion->members) {
+        if (!candidates.count(m) || ops_[m].rets[0].sinks.size() != 1) {
+          reusable = false;
+          break;
+        }
+      }
+    }
+    if (!reusable) make_fusion(*it, candidates);
+
+    if (f.fusion) {
+      absorbed.insert(f.fusion->members.begin(), f.fusion->members.end());
+    }
+  }
+
+  if (absorbed.empty()) return oids;
+  vector<std::uint32_t> ret;
+  ret.reserve(oids.size() - absorbed.size());
+  for (const std::uint32_t oid : oids) {
+    if (!absorbed.count(oid)) ret.emplace_back(oid);
+  }
+  return ret;
+}
+
+void Graph::make_fusion(
+    std::uint32_t oid, const std::unordered_set<std::uint32_t> &candidates) {
+  OperatorInfo &f = ops_[oid];
+  f.fusion.reset();
+
+  ElementwiseProgram::Opcode opcode;
+  float k;
+  if (f.rets.size() != 1 || !get_elementwise_instruction(*f.op, opcode, k)) {
+    return;
+  }
+  Device *dev = f.rets[0].device;
+  if (!dev->supports_elementwise_fusion()) return;
+
+  // Collects operators which are used only by the chain.
+  vector<std::uint32_t> group { oid };
+  for (std::uint32_t i = 0; i < group.size(); ++i) {
+    for (const Address arg : ops_[group[i]].args) {
+      const OperatorInfo &arg_f = ops_[arg.oid];
+      if (group.size() == MAX_FUSED_OPERATORS ||
+          !candidates.count(arg.oid) ||
+          arg_f.rets.size() != 1 ||
+          arg_f.rets[0].sinks.size() != 1 ||
+          arg_f.rets[0].device != dev ||
+          !get_elementwise_instruction(*arg_f.op, opcode, k)) continue;
+      group.emplace_back(arg.oid);
+    }
+  }
+  if (group.size() == 1) return;
+
+  // Operator IDs are sorted in the topological order, and the ascending order
+  // of the group is also a valid order of instructions.
+  std::sort(group.begin(), group.end());
+  const auto key = [](const Address addr) {
+    return (static_cast<std::uint64_t>(addr.oid) << 32) | addr.vid;
+  };
+  std::unordered_set<std::uint32_t> members(group.begin(), group.end());
+  vector<Address> inputs;
+  std::unordered_map<std::uint64_t, std::uint32_t> regs;
+  for (const std::uint32_t member : group) {
+    for (const Address arg : ops_[member].args) {
+      if (members.count(arg.oid) || regs.count(key(arg))) continue;
+      if (ops_[arg.oid].rets[arg.vid].device != dev) return;
+      regs.emplace(key(arg), inputs.size());
+      inputs.emplace_back(arg);
+    }
+  }
+
+  ElementwiseProgram program(inputs.size());
+  for (const std::uint32_t member : group) {
+    const OperatorInfo &member_f = ops_[member];
+    get_elementwise_instruction(*member_f.op, opcode, k);
+    const std::uint32_t a = regs.at(key(member_f.args[0]));
+    const std::uint32_t b =
+      member_f.args.size() > 1 ? regs.at(key(member_f.args[1])) : 0;
+    regs[key(Address { member, 0 })] =
+      program.add_instruction(opcode, a, b, k);
+  }
+
+  std::unique_ptr<FusionInfo> fusion(new FusionInfo);
+  fusion->op.reset(new operators::FusedElementwise(program));
+  fusion->members.assign(group.begin(), group.end() - 1);
+  fusion->args_v.reserve(inputs.size());
+  fusion->args_g.reserve(inputs.size());
+  for (const Address arg : inputs) {
+    OperatorInfo &arg_f = ops_[arg.oid];
+    NodeInfo &arg_n = arg_f.rets[arg.vid];
+    fusion->args_v.emplace_back(
+        arg_f.op->has_inner_values()
+        ? arg_f.op->get_inner_values()[arg.vid]
+        : &arg_n.value);
+    fusion->args_g.emplace_back(&arg_n.grad);
+  }
+  fusion->args = move(inputs);
+  f.fusion = move(fusion);
+}
+
+const Tensor &Graph::get_value(const Address addr) const {
+  const OperatorInfo &f = ops_[addr.oid];
+  return f.op->has_inner_values()
+    ? *f.op->get_inner_values()[addr.vid]
+    : f.rets[addr.vid].value;
 }
 
 void Graph::backward(const Node &node) {
   CHECK_NODE(node);
 
+  if (inference_mode_) {
+    PRIMITIV_THROW_ERROR(
+        "Graph::backward() is not available in the inference mode.");
+  }
+
   OperatorInfo &last_f = ops_[node.oid_];
   NodeInfo &last_n = last_f.rets[node.vid_];
 
   // Force to perform the forward operation.
-  if (!last_n.value.valid()) {
+  if (memory_planning_) {
+    // Intermediate values may be released by the previous backward().
+    const Address addr { node.oid_, node.vid_ };
+    vector<std::uint32_t> oids;
+    for (const std::uint32_t oid : collect_ancestors(addr)) {
+      const OperatorInfo &f = ops_[oid];
+      if (f.op->has_inner_values()) continue;
+      for (const NodeInfo &n : f.rets) {
+        if (!n.value.valid()) {
+          oids.emplace_back(oid);
+          break;
+        }
+      }
+    }
+    forward_planned(addr, oids);
+  } else if (!last_n.value.valid()) {
     forward(node);
   }
 
   // Makes the identity gradient (dx/dx = 1) at the last node.
+  place_next_tensor(*last_n.device, last_n.grad_offset, last_n.shape);
   last_n.grad = functions::ones<Tensor>(last_n.shape, last_n.device);
+  last_n.device->discard_placements();
 
   // Performs the backpropagation.
-  // NOTE(odashi):
-  // In the current implementation, the node ID corresponds to the inverse
-  // topological order of the computation graph.
-  for (std::int32_t oid = node.oid_; oid >= 0; --oid) {
-    OperatorInfo &cur_f = ops_[oid];
-    const std::uint32_t argn = cur_f.args.size();
-    const std::uint32_t retn = cur_f.rets.size();
-
-    // Gathers information of return values.
-    vector<const Tensor *> rets_v(retn), rets_g(retn);
-    bool enabled = false;
-    for (uint32_t i = 0; i < retn; ++i) {
-      NodeInfo &cur_n = cur_f.rets[i];
-      rets_v[i] = &cur_n.value;
-      rets_g[i] = &cur_n.grad;
-      enabled = enabled || cur_n.grad.valid();
-    }
-    if (!enabled) {
-      // This operator is out of the forward path because all gradients of
-      // return values are invalid.
-      continue;
+  if (memory_planning_) {
+    // Concurrent execution is not used together with the memory planning,
+    // because planned lifetimes assume the sequential order.
+    for (std::int32_t oid = node.oid_; oid >= 0; --oid) {
+      backward_step(oid);
+    }
+    return;
+  }
+  const vector<std::uint32_t> oids =
+    collect_ancestors({ node.oid_, node.vid_ });
+  if (num_checkpoints_ > 0 || !runs_concurrently(oids)) {
+    // NOTE(odashi):
+    // In the current implementation, the node ID corresponds to the inverse
+    // topological order of the computation graph.
+    // Recalculation of checkpointed segments also assumes this order.
+    for (auto it = oids.rbegin(); it != oids.rend(); ++it) {
+      backward_step(*it);
     }
+    return;
+  }
 
-    // All invalid gradients of return values should be treated as 0.
-    for (uint32_t i = 0; i < retn; ++i) {
-      NodeInfo &cur_n = cur_f.rets[i];
-      if (!cur_n.grad.valid()) {
-        cur_n.grad = functions::zeros<Tensor>(cur_n.shape, cur_n.device);
+  // Builds dependencies among operators in the inverse order.
+  // The gradient of each node is accumulated by its consumers in descending
+  // order of operator IDs, which keeps results deterministic.
+  const auto key = [](const Address addr) {
+    return (static_cast<std::uint64_t>(addr.oid) << 32) | addr.vid;
+  };
+  const std::uint32_t num_tasks = oids.size();
+  std::unordered_map<std::uint32_t, std::uint32_t> task_ids;
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    task_ids.emplace(oids[num_tasks - i - 1], i);
+  }
+  vector<vector<std::uint32_t>> successors(num_tasks);
+  std::unordered_map<std::uint64_t, std::uint32_t> last_writers;
+  std::uint32_t last_side_effect = num_tasks;
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    const OperatorInfo &f = ops_[oids[num_tasks - i - 1]];
+    for (const Address arg : get_effective_args(f)) {
+      successors[i].emplace_back(task_ids.at(arg.oid));
+      const auto it = last_writers.find(key(arg));
+      if (it == last_writers.end()) {
+        last_writers.emplace(key(arg), i);
+      } else if (it->second != i) {
+        successors[it->second].emplace_back(i);
+        it->second = i;
+      }
+    }
+    if (f.op->has_side_effects()) {
+      if (last_side_effect != num_tasks) {
+        successors[last_side_effect].emplace_back(i);
       }
+      last_side_effect = i;
     }
+  }
+
+  thread_pool_->run(successors, [&](std::uint32_t i) {
+      backward_step(oids[num_tasks - i - 1]);
+  });
+}
+
+void Graph::backward_step(std::uint32_t oid) {
+  OperatorInfo &cur_f = ops_[oid];
 
-    // Gathers information of arguments.
-    vector<const Tensor *> args_v(argn);
-    vector<Tensor *> args_g(argn);
-    for (uint32_t i = 0; i < argn; ++i) {
-      const Address arg = cur_f.args[i];
-      OperatorInfo &arg_f = ops_[arg.oid];
-      NodeInfo &arg_n = arg_f.rets[arg.vid];
-      args_v[i] = arg_n.value.valid()
-        ? &arg_n.value
-        : arg_f.op->get_inner_values()[arg.vid];
-      args_g[i] = &arg_n.grad;
+  bool enabled = false;
+  for (const NodeInfo &cur_n : cur_f.rets) {
+    enabled = enabled || cur_n.grad.valid();
+  }
+  if (!enabled) {
+    // This operator is out of the forward path because all gradients of
+    // return values are invalid.
+    return;
+  }
+
+  const bool checkpointing = num_checkpoints_ > 0 && !memory_planning_;
+  if (checkpointing) recompute_values(oid);
+
+  // All invalid gradients of return values should be treated as 0.
+  for (NodeInfo &cur_n : cur_f.rets) {
+    if (!cur_n.grad.valid()) {
+      place_next_tensor(*cur_n.device, cur_n.grad_offset, cur_n.shape);
+      cur_n.grad = functions::zeros<Tensor>(cur_n.shape, cur_n.device);
+      cur_n.device->discard_placements();
+    }
+  }
+
+  // Also gradients of arguments are accumulated from 0.
+  // Operators which assign gradients directly write the first gradient of
+  // each argument, and filling 0 is omitted. This is disabled while memory
+  // planning because planned gradients should be placed on the arena.
+  const auto fill_arg_grads = [&] {
+    for (const Address arg : get_effective_args(cur_f)) {
+      NodeInfo &arg_n = ops_[arg.oid].rets[arg.vid];
       if (!arg_n.grad.valid()) {
+        place_next_tensor(*arg_n.device, arg_n.grad_offset, arg_n.shape);
         arg_n.grad = functions::zeros<Tensor>(arg_n.shape, arg_n.device);
+        arg_n.device->discard_placements();
       }
     }
+  };
+  const Operator &cur_op = cur_f.fusion ? *cur_f.fusion->op : *cur_f.op;
+  const bool assigns = cur_op.assigns_gradients() && !memory_planning_;
+  if (!assigns) fill_arg_grads();
 
-    // Propagetes the gradient from this node.
-    cur_f.op->backward(args_v, rets_v, rets_g, args_g);
+  // Propagetes the gradient from this node.
+  backward_operator(oid);
 
-    // Deletes current gradient to suppress memory.
-    for (uint32_t i = 0; i < retn; ++i) {
-      cur_f.rets[i].grad.invalidate();
+  // Gradients of arguments should be valid after calculating them.
+  if (assigns) fill_arg_grads();
+
+  // Deletes current gradient to suppress memory.
+  for (NodeInfo &cur_n : cur_f.rets) {
+    cur_n.grad.invalidate();
+  }
+
+  // Deletes intermediate values which are no longer used by the remaining
+  // backward steps.
+  if (memory_planning_ ||
+      (checkpointing && is_recomputable(*cur_f.op))) {
+    for (NodeInfo &ret : cur_f.rets) {
+      if (!ret.pinned) ret.value.invalidate();
+    }
+  }
+}
+
+bool Graph::runs_concurrently(const vector<std::uint32_t> &oids) const {
+  if (!thread_pool_ || oids.size() < 2) return false;
+  for (const std::uint32_t oid : oids) {
+    const OperatorInfo &f = ops_[oid];
+    for (const NodeInfo &n : f.rets) {
+      if (!n.device->supports_concurrent_execution()) return false;
+    }
+    for (const Address arg : get_effective_args(f)) {
+      const Device *dev = ops_[arg.oid].rets[arg.vid].device;
+      if (!dev->supports_concurrent_execution()) return false;
     }
   }
+  return true;
+}
+
+void Graph::forward_operators(const vector<std::uint32_t> &oids) {
+  if (!runs_concurrently(oids)) {
+    for (const std::uint32_t oid : oids) {
+      forward_operator(oid);
+    }
+    return;
+  }
+
+  // Builds dependencies among operators.
+  const std::uint32_t num_tasks = oids.size();
+  std::unordered_map<std::uint32_t, std::uint32_t> task_ids;
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    task_ids.emplace(oids[i], i);
+  }
+  vector<vector<std::uint32_t>> successors(num_tasks);
+  std::uint32_t last_side_effect = num_tasks;
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    const OperatorInfo &f = ops_[oids[i]];
+    for (const Address arg : get_effective_args(f)) {
+      const auto it = task_ids.find(arg.oid);
+      if (it != task_ids.end()) successors[it->second].emplace_back(i);
+    }
+    if (f.op->has_side_effects()) {
+      if (last_side_effect != num_tasks) {
+        successors[last_side_effect].emplace_back(i);
+      }
+      last_side_effect = i;
+    }
+  }
+
+  thread_pool_->run(successors, [&](std::uint32_t i) {
+      forward_operator(oids[i]);
+  });
 }
 
 Shape Graph::get_shape(const Node &node) const {
@@ -233,6 +1090,8 @@ Device &Graph::get_device(const Node &node) const {
 }
 
 std::string Graph::dump(const std::string &format) const {
+  if (format == "profile") return dump_profile();
+  if (format == "trace") return dump_trace();
   if (format != "dot") PRIMITIV_THROW_ERROR("Unknown format: " << format);
 
   std::stringstream ss;
@@ -273,4 +1132,130 @@ std::string Graph::dump(const std::string &format) const {
   return ss.str();
 }
 
+vector<Graph::ProfileRecord> Graph::copy_profile() const {
+  // Records may be appended by other threads during the parallel backward.
+  const std::lock_guard<std::mutex> lock(profile_mutex_);
+  return profile_;
+}
+
+std::string Graph::dump_profile() const {
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  const vector<ProfileRecord> profile = copy_profile();
+
+  // Aggregates records by the phase, the operator, arguments and the device.
+  using Key = std::tuple<bool, std::string, std::string>;
+  struct Entry {
+    std::uint32_t calls;
+    std::uint64_t time;
+    std::uint64_t bytes;
+  };
+  std::map<Key, Entry> entries;
+  std::uint64_t total_time = 0;
+  for (const ProfileRecord &r : profile) {
+    const NodeInfo &ret = ops_[r.oid].rets[0];
+    std::string signature = r.name + '(';
+    for (std::uint32_t i = 0; i < r.args.size(); ++i) {
+      if (i > 0) signature += ',';
+      signature += ops_[r.args[i].oid].rets[r.args[i].vid].shape.to_string();
+    }
+    signature += ") -> " + ret.shape.to_string();
+    const std::uint64_t time = duration_cast<nanoseconds>(r.duration).count();
+    Entry &e = entries[
+      std::make_tuple(r.backward, move(signature), device_name(*ret.device))];
+    ++e.calls;
+    e.time += time;
+    e.bytes += r.bytes;
+    total_time += time;
+  }
+
+  // Sorts entries in descending order of time.
+  vector<std::pair<const Key *, const Entry *>> sorted;
+  sorted.reserve(entries.size());
+  for (const auto &kv : entries) {
+    sorted.emplace_back(&kv.first, &kv.second);
+  }
+  std::stable_sort(
+      sorted.begin(), sorted.end(),
+      [](const std::pair<const Key *, const Entry *> &a,
+         const std::pair<const Key *, const Entry *> &b) {
+        return a.second->time > b.second->time;
+      });
+
+  std::stringstream ss;
+  ss << std::fixed;
+  ss << "Operators: " << profile.size()
+     << ", total time: " << std::setprecision(3) << total_time * 1e-6
+     << " [ms]\n";
+  ss << std::setw(12) << "time[ms]" << std::setw(8) << "ratio"
+     << std::setw(8) << "calls" << std::setw(12) << "avg[us]"
+     << std::setw(14) << "bytes" << "  phase     device  operator\n";
+  for (const auto &kv : sorted) {
+    const bool backward = std::get<0>(*kv.first);
+    const Entry &e = *kv.second;
+    ss << std::setw(12) << std::setprecision(3) << e.time * 1e-6
+       << std::setw(7) << std::setprecision(1)
+       << (total_time > 0 ? 100. * e.time / total_time : 0.) << '%'
+       << std::setw(8) << e.calls
+       << std::setw(12) << std::setprecision(3) << e.time * 1e-3 / e.calls
+       << std::setw(14) << e.bytes
+       << "  " << (backward ? "backward" : "forward ")
+       << "  " << std::get<2>(*kv.first)
+       << "  " << std::get<1>(*kv.first) << '\n';
+  }
+  return ss.str();
+}
+
+std::string Graph::dump_trace() const {
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  const vector<ProfileRecord> profile = copy_profile();
+
+  // Assigns small IDs to threads in the order of appearance.
+  std::unordered_map<std::thread::id, std::uint32_t> thread_ids;
+  for (const ProfileRecord &r : profile) {
+    thread_ids.emplace(r.thread, thread_ids.size());
+  }
+
+  const auto shapes = [&](const vector<Address> &addrs) {
+    std::string ret = "[";
+    for (std::uint32_t i = 0; i < addrs.size(); ++i) {
+      if (i > 0) ret += ',';
+      ret += '"';
+      ret += ops_[addrs[i].oid].rets[addrs[i].vid].shape.to_string();
+      ret += '"';
+    }
+    return ret + ']';
+  };
+
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for (std::uint32_t i = 0; i < profile.size(); ++i) {
+    const ProfileRecord &r = profile[i];
+    const OperatorInfo &f = ops_[r.oid];
+    vector<Address> rets;
+    for (std::uint32_t vid = 0; vid < f.rets.size(); ++vid) {
+      rets.emplace_back(Address { r.oid, vid });
+    }
+    ss << (i > 0 ? ",\n" : "\n")
+       << "  {\"name\": \"" << escape_json(r.name)
+       << "\", \"cat\": \"" << (r.backward ? "backward" : "forward")
+       << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": "
+       << thread_ids.at(r.thread)
+       << ", \"ts\": " << duration_cast<nanoseconds>(r.begin).count() * 1e-3
+       << ", \"dur\": "
+       << duration_cast<nanoseconds>(r.duration).count() * 1e-3
+       << ", \"args\": {\"operator_id\": " << r.oid
+       << ", \"device\": \"" << device_name(*f.rets[0].device)
+       << "\", \"inputs\": " << shapes(r.args)
+       << ", \"outputs\": " << shapes(rets)
+       << ", \"bytes\": " << r.bytes << "}}";
+  }
+  ss << "\n]}\n";
+  return ss.str();
+}
+
 }  // namespace primitiv
@@ -1,14 +1,22 @@
 #ifndef PRIMITIV_CORE_GRAPH_H_
 #define PRIMITIV_CORE_GRAPH_H_
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <primitiv/core/mixins/default_settable.h>
 #include <primitiv/core/mixins/nonmovable.h>
 #include <primitiv/core/operator.h>
 #include <primitiv/core/shape.h>
+#include <primitiv/core/thread_pool.h>
 
 namespace primitiv {
 
@@ -16,6 +24,10 @@ class Device;
 class Graph;
 class Node;
 
+namespace operators {
+class Input;
+}  // namespace operators
+
 /**
  * Pointer of a node in the computation graph.
  */
@@ -145,7 +157,17 @@ class Graph
     : public mixins::DefaultSettable<Graph>
     , mixins::Nonmovable<Graph> {
 public:
-  Graph() = default;
+  Graph()
+    : ops_()
+    , inference_mode_(false)
+    , memory_planning_(false)
+    , planned_sizes_()
+    , thread_pool_()
+    , operator_fusion_(false)
+    , num_checkpoints_(0)
+    , profiling_(false)
+    , profile_origin_(std::chrono::steady_clock::now())
+    , profile_() {}
   ~Graph() = default;
 
   /**
@@ -155,6 +177,40 @@ public:
    */
   void clear();
 
+  /**
+   * Discards all values and gradients calculated in the graph while retaining
+   * operators.
+   * @remarks This function enables to reuse the same graph for every step of a
+   *          training loop with a fixed topology: the next `forward()`
+   *          recalculates all values using current parameters and data given by
+   *          `set_input()`, without constructing operators again.
+   *          Node objects supplied by the graph remain valid.
+   */
+  void discard_values();
+
+  /**
+   * Replaces the data of an input node.
+   * @param node Node object created by `functions::input()`.
+   * @param data New data of the node. The size should be equal to the number
+   *             of elements of the node.
+   * @throw primitiv::Error `node` is not an input node, or data sizes
+   *                        mismatched.
+   * @remarks Values and gradients depending on `node` are discarded.
+   */
+  void set_input(const Node &node, const std::vector<float> &data);
+
+  /**
+   * Replaces the value of an input node with an existing tensor.
+   * @param node Node object created by `functions::input()`.
+   * @param value New value of the node. The shape and the device should be
+   *              same as those of the node.
+   * @throw primitiv::Error `node` is not an input node, or shapes or devices
+   *                        mismatched.
+   * @remarks The node shares the internal memory of `value` without copying
+   *          values. Values and gradients depending on `node` are discarded.
+   */
+  void set_input(const Node &node, const Tensor &value);
+
   /**
    * Adds an operator into the graph.
    * @param op Interface of the new operator.
@@ -177,14 +233,150 @@ public:
    */
   const Tensor &forward(const Node &node);
 
+  /**
+   * Calculates the values of given nodes.
+   * @param nodes List of Node objects specifying the target nodes.
+   * @return List of pointers to calculated values.
+   * @remarks This function calculates all nodes at once, which is important
+   *          in the inference mode: all target nodes are retained while
+   *          intermediate results required by them can be released.
+   */
+  std::vector<const Tensor *> forward(const std::vector<Node> &nodes);
+
   /**
    * Calculates the backpropagation.
    * @param node Node object specifying the output node.
    * @remarks If `node` is not yet forwarded, this function implicitly calls
    *          `forward(node)`.
+   *          If the graph has checkpoints made by `functions::checkpoint()`,
+   *          `forward()` retains only the values of checkpoints, parameters,
+   *          operators with side effects and target nodes, and this function
+   *          recalculates other values segment by segment, releasing each of
+   *          them after its gradients are propagated.
    */
   void backward(const Node &node);
 
+  /**
+   * Enables or disables the inference mode.
+   * @param enabled `true` to enable the inference mode, `false` otherwise.
+   * @throw primitiv::Error The graph already has some operators.
+   * @remarks In the inference mode, the graph retains only the values of the
+   *          nodes explicitly passed to `forward()`. Every other intermediate
+   *          value is released as soon as all operators consuming it (at the
+   *          time of the calculation) have been calculated, and is
+   *          recalculated if it is required again later.
+   *          `backward()` is not available in the inference mode.
+   */
+  void set_inference_mode(bool enabled);
+
+  /**
+   * Checks whether the graph is in the inference mode or not.
+   * @return `true` if the inference mode is enabled, `false` otherwise.
+   */
+  bool inference_mode() const { return inference_mode_; }
+
+  /**
+   * Enables or disables the static memory planning.
+   * @param enabled `true` to enable the memory planning, `false` otherwise.
+   * @remarks When the memory planning is enabled, `forward()` analyzes the
+   *          lifetimes of all values and gradients which will be produced by
+   *          the subsequent `forward()` and `backward()` calls, and assigns
+   *          them to fixed offsets of one memory arena per device so that
+   *          blocks with disjoint lifetimes share the same memory.
+   *          `backward()` also releases each intermediate value as soon as the
+   *          gradients of its arguments are calculated.
+   *          Devices which do not support memory arenas fall back to the
+   *          usual on-demand allocation.
+   *          The memory planning is ignored in the inference mode.
+   */
+  void set_memory_planning(bool enabled) { memory_planning_ = enabled; }
+
+  /**
+   * Checks whether the static memory planning is enabled or not.
+   * @return `true` if the memory planning is enabled, `false` otherwise.
+   */
+  bool memory_planning() const { return memory_planning_; }
+
+  /**
+   * Sets the number of threads to execute operators.
+   * @param num_threads Number of threads. 1 disables the concurrent execution.
+   * @throw primitiv::Error `num_threads` is 0.
+   * @remarks When 2 or more threads are specified, `forward()` and
+   *          `backward()` execute independent operators concurrently if all
+   *          devices involved support it (e.g., CPU devices).
+   *          Operators with side effects are executed in the order of the
+   *          graph, and gradients are always accumulated in the same order as
+   *          the sequential execution, hence results are deterministic.
+   *          The concurrent execution is not used in the inference mode, with
+   *          the memory planning, or in graphs with checkpoints.
+   */
+  void set_num_threads(std::uint32_t num_threads);
+
+  /**
+   * Retrieves the number of threads to execute operators.
+   * @return Number of threads.
+   */
+  std::uint32_t num_threads() const {
+    return thread_pool_ ? thread_pool_->num_threads() : 1;
+  }
+
+  /**
+   * Enables or disables the elementwise operator fusion.
+   * @param enabled `true` to enable the operator fusion, `false` otherwise.
+   * @remarks When the operator fusion is enabled, `forward()` merges each
+   *          chain of elementwise operators (e.g., arithmetic operators and
+   *          activation functions) into one operator which is evaluated by one
+   *          pass over the memory, and `backward()` also calculates gradients
+   *          of the chain at once.
+   *          Only operators whose results are used by exactly one operator in
+   *          the same chain are merged, and values of such intermediate nodes
+   *          are not stored unless they are required later.
+   *          Devices which do not support elementwise programs fall back to
+   *          the usual execution.
+   *          The operator fusion is ignored in the inference mode, with the
+   *          memory planning, or in graphs with checkpoints.
+   */
+  void set_operator_fusion(bool enabled);
+
+  /**
+   * Checks whether the elementwise operator fusion is enabled or not.
+   * @return `true` if the operator fusion is enabled, `false` otherwise.
+   */
+  bool operator_fusion() const { return operator_fusion_; }
+
+  /**
+   * Enables or disables the profiler.
+   * @param enabled `true` to enable the profiler, `false` otherwise.
+   * @remarks While the profiler is enabled, every execution of operators in
+   *          `forward()` and `backward()` is recorded with its wall time and
+   *          the size of memory allocated by it. Records are retained after
+   *          disabling the profiler, and can be retrieved by `dump()` with
+   *          "profile" or "trace" formats.
+   */
+  void set_profiling(bool enabled) { profiling_ = enabled; }
+
+  /**
+   * Checks whether the profiler is enabled or not.
+   * @return `true` if the profiler is enabled, `false` otherwise.
+   */
+  bool profiling() const { return profiling_; }
+
+  /**
+   * Discards all records of the profiler.
+   */
+  void clear_profile();
+
+  /**
+   * Retrieves the peak memory size estimated by the last memory planning.
+   * @param device Device object to retrieve the size.
+   * @return Size of the planned memory arena of the device in bytes, or 0 if
+   *         no memory is planned on the device.
+   */
+  std::size_t get_planned_memory_size(const Device &device) const {
+    const auto it = planned_sizes_.find(&device);
+    return it != planned_sizes_.end() ? it->second : 0;
+  }
+
   /**
    * Retrieves the shape of the node.
    * @param node Node object specifying the target node.
@@ -203,6 +395,10 @@ public:
    * Dump internal graph structure.
    * @param format Name of the format. Available options:
    *                 "dot" ... Graphviz's dot format.
+   *                 "profile" ... Table of profiler records aggregated by
+   *                               operators and shapes.
+   *                 "trace" ... Profiler records in the trace event format
+   *                             of Chrome (chrome://tracing).
    * @return A string that represents the internal graph using given format.
    */
   std::string dump(const std::string &format) const;
@@ -230,21 +426,243 @@ private:
     Device *device;
     Tensor value;
     Tensor grad;
-    //std::vector<std::uint32_t> sinks;
+    std::vector<std::uint32_t> sinks;
+    std::uint32_t num_pending_sinks;
+    bool pinned;
+    std::size_t value_offset;
+    std::size_t grad_offset;
+  };
+
+  /**
+   * Record of one execution of an operator measured by the profiler.
+   */
+  struct ProfileRecord {
+    std::uint32_t oid;
+    bool backward;
+    std::string name;
+    std::vector<Address> args;
+    std::thread::id thread;
+    std::chrono::steady_clock::duration begin;
+    std::chrono::steady_clock::duration duration;
+    std::uint64_t bytes;
+  };
+
+  /**
+   * Fused operator which replaces the operator and its absorbed ancestors.
+   */
+  struct FusionInfo {
+    std::unique_ptr<Operator> op;
+    std::vector<Address> args;
+    std::vector<std::uint32_t> members;
+    std::vector<const Tensor *> args_v;
+    std::vector<Tensor *> args_g;
   };
 
   /**
    * Set of informations that represents the operator: an implementation of the
    * operator, its arguments, and its return values.
+   * Pointer arrays passed to `Operator::forward()` and `Operator::backward()`
+   * are prepared once when the operator is added.
+   * If `fusion` is not null, the fused operator is executed instead.
    */
   struct OperatorInfo {
     std::unique_ptr<Operator> op;
     std::vector<Address> args;
     std::vector<NodeInfo> rets;
+    bool computed;
+    std::vector<const Tensor *> args_v;
+    std::vector<Tensor *> args_g;
+    std::vector<Tensor *> rets_v;
+    std::vector<const Tensor *> rets_cv;
+    std::vector<const Tensor *> rets_g;
+    std::unique_ptr<FusionInfo> fusion;
   };
 
+  /**
+   * Retrieves arguments which are actually used by the operator.
+   * @param f Target operator.
+   * @return Arguments of the fused operator if available, or those of the
+   *         operator itself otherwise.
+   */
+  static const std::vector<Address> &get_effective_args(
+      const OperatorInfo &f) {
+    return f.fusion ? f.fusion->args : f.args;
+  }
+
+  /**
+   * Calculates the values of given nodes in the inference mode.
+   * @param addrs List of addresses of the target nodes.
+   */
+  void forward_inference(const std::vector<Address> &addrs);
+
+  /**
+   * Calculates the value of given node using the static memory planning.
+   * @param addr Address of the target node.
+   * @param oids List of operator IDs to be calculated, in ascending order.
+   */
+  void forward_planned(
+      const Address addr, const std::vector<std::uint32_t> &oids);
+
+  /**
+   * Assigns arena offsets to values and gradients, and prepares arenas.
+   * @param addr Address of the target node.
+   * @param oids List of operator IDs to be calculated, in ascending order.
+   */
+  void plan_memory(
+      const Address addr, const std::vector<std::uint32_t> &oids);
+
+  /**
+   * Calculates the values of given nodes in graphs with checkpoints.
+   * @param addrs List of addresses of the target nodes.
+   */
+  void forward_checkpointed(const std::vector<Address> &addrs);
+
+  /**
+   * Recalculates values released by the gradient checkpointing, which are
+   * required by the backward operation of the operator.
+   * @param oid Operator ID.
+   */
+  void recompute_values(std::uint32_t oid);
+
+  /**
+   * Collects operators which have to be calculated to obtain given nodes.
+   * @param addrs List of addresses of the target nodes.
+   * @return List of operator IDs in ascending order.
+   */
+  std::vector<std::uint32_t> collect_uncalculated(
+      const std::vector<Address> &addrs) const;
+
+  /**
+   * Collects all operators which given node depends on, including itself.
+   * @param addr Address of the target node.
+   * @return List of operator IDs in ascending order.
+   */
+  std::vector<std::uint32_t> collect_ancestors(const Address addr) const;
+
+  /**
+   * Calculates return values of the operator.
+   * @param oid Operator ID.
+   * @remarks All arguments should be already calculated.
+   */
+  void forward_operator(std::uint32_t oid);
+
+  /**
+   * Calculates gradients of arguments of the operator.
+   * @param oid Operator ID.
+   * @remarks All values and gradients used by the operator should be already
+   *          prepared.
+   */
+  void backward_operator(std::uint32_t oid);
+
+  /**
+   * Executes the function and records it as an execution of the operator.
+   * @param oid Operator ID.
+   * @param backward `true` if the function performs the backward operation,
+   *                 `false` otherwise.
+   * @param fn Function to execute.
+   */
+  template<typename Fn>
+  void profile_operator(std::uint32_t oid, bool backward, Fn &&fn);
+
+  /**
+   * Takes a snapshot of profiler records.
+   * @return A copy of records.
+   */
+  std::vector<ProfileRecord> copy_profile() const;
+
+  /**
+   * Makes the aggregated table of profiler records.
+   * @return A string of the table.
+   */
+  std::string dump_profile() const;
+
+  /**
+   * Makes the trace event JSON of profiler records.
+   * @return A string of the JSON.
+   */
+  std::string dump_trace() const;
+
+  /**
+   * Performs the backward operation of the operator if it is on the path of
+   * the backpropagation.
+   * @param oid Operator ID.
+   */
+  void backward_step(std::uint32_t oid);
+
+  /**
+   * Checks whether given operators should be executed concurrently or not.
+   * @param oids List of operator IDs.
+   * @return true if the concurrent execution is available, false otherwise.
+   */
+  bool runs_concurrently(const std::vector<std::uint32_t> &oids) const;
+
+  /**
+   * Calculates the values of given operators, concurrently if available.
+   * @param oids List of operator IDs to be calculated, in ascending order.
+   */
+  void forward_operators(const std::vector<std::uint32_t> &oids);
+
+  /**
+   * Merges chains of elementwise operators.
+   * @param oids List of operator IDs to be calculated, in ascending order.
+   * @param addrs List of addresses of the target nodes, which are never
+   *              absorbed into other operators.
+   * @return List of operator IDs which should be executed, in ascending
+   *         order.
+   */
+  std::vector<std::uint32_t> fuse_operators(
+      const std::vector<std::uint32_t> &oids,
+      const std::vector<Address> &addrs);
+
+  /**
+   * Makes the fused operator rooted at given operator.
+   * @param oid Operator ID of the root.
+   * @param candidates Set of operator IDs which can be absorbed.
+   * @remarks `fusion` of the root is reset if no operator can be absorbed.
+   */
+  void make_fusion(
+      std::uint32_t oid, const std::unordered_set<std::uint32_t> &candidates);
+
+  /**
+   * Retrieves the value of the node.
+   * @param addr Address of the node.
+   * @return Current value of the node.
+   */
+  const Tensor &get_value(const Address addr) const;
+
+  /**
+   * Discards values and gradients of the operator.
+   * @param oid Operator ID.
+   */
+  void discard_operator(std::uint32_t oid);
+
+  /**
+   * Discards values and gradients of the operator and all operators depending
+   * on it.
+   * @param root Operator ID.
+   */
+  void discard_dependents(std::uint32_t root);
+
+  /**
+   * Retrieves the Input operator of the node.
+   * @param node Node object.
+   * @return Reference of the operator.
+   * @throw primitiv::Error `node` is not an input node.
+   */
+  operators::Input &get_input_operator(const Node &node);
+
   static Graph *default_obj_;
   std::vector<OperatorInfo> ops_;
+  bool inference_mode_;
+  bool memory_planning_;
+  std::unordered_map<const Device *, std::size_t> planned_sizes_;
+  std::unique_ptr<ThreadPool> thread_pool_;
+  bool operator_fusion_;
+  std::uint32_t num_checkpoints_;
+  bool profiling_;
+  std::chrono::steady_clock::time_point profile_origin_;
+  std::vector<ProfileRecord> profile_;
+  mutable std::mutex profile_mutex_;
 };
 
 inline Shape Node::shape() const {
@@ -0,0 +1,52 @@
+#include <primitiv/config.h>
+
+#include <primitiv/core/error.h>
+#include <primitiv/core/memory_arena.h>
+
+namespace primitiv {
+
+void MemoryArena::Deleter::operator()(void *ptr) {
+  static_cast<void>(ptr);
+  const std::lock_guard<std::mutex> lock(state_->mutex);
+  auto &used = state_->used;
+  for (auto it = used.begin(); it != used.end(); ++it) {
+    if (it->first == offset_) {
+      used.erase(it);
+      break;
+    }
+  }
+}
+
+MemoryArena::MemoryArena(std::shared_ptr<void> &&base, std::size_t size)
+: state_(new State) {
+  state_->base = std::move(base);
+  state_->size = size;
+}
+
+bool MemoryArena::in_use() const {
+  const std::lock_guard<std::mutex> lock(state_->mutex);
+  return !state_->used.empty();
+}
+
+std::shared_ptr<void> MemoryArena::acquire(
+    std::size_t offset, std::size_t size) {
+  if (size == 0 || offset + size > state_->size) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid sub-block of the memory arena. offset: " << offset
+        << ", size: " << size << ", arena size: " << state_->size);
+  }
+
+  const std::lock_guard<std::mutex> lock(state_->mutex);
+  for (const auto &block : state_->used) {
+    if (offset < block.first + block.second && block.first < offset + size) {
+      // Overlaps with a living sub-block.
+      return std::shared_ptr<void>();
+    }
+  }
+  state_->used.emplace_back(offset, size);
+  return std::shared_ptr<void>(
+      static_cast<char *>(state_->base.get()) + offset,
+      Deleter(state_, offset));
+}
+
+}  // namespace primitiv
@@ -0,0 +1,79 @@
+#ifndef PRIMITIV_CORE_MEMORY_ARENA_H_
+#define PRIMITIV_CORE_MEMORY_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <primitiv/core/mixins/nonmovable.h>
+
+namespace primitiv {
+
+/**
+ * Contiguous memory region which supplies sub-blocks at arbitrary offsets.
+ * The arena tracks sub-blocks currently in use and never supplies
+ * overlapping regions at the same time.
+ */
+class MemoryArena : mixins::Nonmovable<MemoryArena> {
+  /**
+   * Internal state shared with all supplied sub-blocks, which keeps the
+   * underlying memory alive until all sub-blocks are released.
+   */
+  struct State {
+    std::shared_ptr<void> base;
+    std::size_t size;
+    std::mutex mutex;
+    std::vector<std::pair<std::size_t, std::size_t>> used;
+  };
+
+  /**
+   * Custom deleter class for sub-blocks.
+   */
+  class Deleter {
+    std::shared_ptr<State> state_;
+    std::size_t offset_;
+  public:
+    Deleter(const std::shared_ptr<State> &state, std::size_t offset)
+      : state_(state), offset_(offset) {}
+    void operator()(void *ptr);
+  };
+
+  std::shared_ptr<State> state_;
+
+public:
+  /**
+   * Creates a new arena.
+   * @param base Memory region managed by the arena. The region should be
+   *             addressable by byte offsets.
+   * @param size Size of the region in bytes.
+   */
+  MemoryArena(std::shared_ptr<void> &&base, std::size_t size);
+
+  /**
+   * Returns the size of the arena.
+   * @return Size of the arena in bytes.
+   */
+  std::size_t size() const { return state_->size; }
+
+  /**
+   * Checks whether some sub-blocks are in use or not.
+   * @return true if at least one sub-block is in use, false otherwise.
+   */
+  bool in_use() const;
+
+  /**
+   * Obtains a sub-block.
+   * @param offset Offset of the sub-block in bytes.
+   * @param size Size of the sub-block in bytes.
+   * @return Shared pointer of the sub-block, or an empty pointer if the
+   *         requested region overlaps with other sub-blocks in use.
+   * @throw primitiv::Error The requested region exceeds the arena.
+   */
+  std::shared_ptr<void> acquire(std::size_t offset, std::size_t size);
+};
+
+}  // namespace primitiv
+
+#endif  // PRIMITIV_CORE_MEMORY_ARENA_H_
@@ -39,6 +39,7 @@ std::shared_ptr<void> MemoryPool::allocate(std::size_t size) {
   const std::uint64_t shift = numeric_utils::calculate_shifts(size);
   if (shift > MAX_SHIFTS) PRIMITIV_THROW_ERROR("Invalid memory size: " << size);
 
+  const std::lock_guard<std::mutex> lock(mutex_);
   void *ptr;
   if (reserved_[shift].empty()) {
     // Allocates a new block.
@@ -47,7 +48,7 @@ std::shared_ptr<void> MemoryPool::allocate(std::size_t size) {
     } catch (...) {
       // Maybe out-of-memory.
       // Release other blocks and try allocation again.
-      release_reserved_blocks();
+      release_reserved_blocks_unlocked();
       // Below allocation may throw an error when the memory allocation
       // process finally failed.
       ptr = allocator_(1ull << shift);
@@ -64,6 +65,7 @@ std::shared_ptr<void> MemoryPool::allocate(std::size_t size) {
 }
 
 void MemoryPool::free(void *ptr) {
+  const std::lock_guard<std::mutex> lock(mutex_);
   auto it = supplied_.find(ptr);
   if (it == supplied_.end()) {
     PRIMITIV_THROW_ERROR("Detected to dispose unknown handle: " << ptr);
@@ -73,6 +75,11 @@ void MemoryPool::free(void *ptr) {
 }
 
 void MemoryPool::release_reserved_blocks() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  release_reserved_blocks_unlocked();
+}
+
+void MemoryPool::release_reserved_blocks_unlocked() {
   for (auto &ptrs : reserved_) {
     while (!ptrs.empty()) {
       deleter_(ptrs.back());
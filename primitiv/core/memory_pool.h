@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -14,6 +15,7 @@ namespace primitiv {
 
 /**
  * Memory manager on the device specified by allocator/deleter functors.
+ * All member functions can be called from multiple threads.
  */
 class MemoryPool : public mixins::Identifiable<MemoryPool> {
   /**
@@ -38,6 +40,7 @@ class MemoryPool : public mixins::Identifiable<MemoryPool> {
   std::function<void(void *)> deleter_;
   std::vector<std::vector<void *>> reserved_;
   std::unordered_map<void *, std::uint32_t> supplied_;
+  std::mutex mutex_;
 
 public:
   /**
@@ -58,6 +61,12 @@ public:
    */
   std::shared_ptr<void> allocate(std::size_t size);
 
+  /**
+   * Releases all reserved memory blocks.
+   * @remarks Memory blocks currently supplied to users are not affected.
+   */
+  void release_reserved_blocks();
+
 private:
   /**
    * Disposes the memory managed by this pool.
@@ -66,9 +75,9 @@ private:
   void free(void *ptr);
 
   /**
-   * Releases all reserved memory blocks.
+   * Releases all reserved memory blocks without locking.
    */
-  void release_reserved_blocks();
+  void release_reserved_blocks_unlocked();
 };
 
 }  // namespace primitiv
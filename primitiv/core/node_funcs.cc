@@ -127,10 +127,21 @@ Node input_node(
   )[0];
 }
 
+Node input_node(const Tensor &x, Graph *g) {
+  return REG(Graph::get_reference_or_default(g), Input(x))[0];
+}
+
 Node parameter_node(primitiv::Parameter &param, Graph *g) {
   return REG(Graph::get_reference_or_default(g), Parameter(param))[0];
 }
 
+Node lookup_node(
+    primitiv::Parameter &param, const std::vector<std::uint32_t> &ids,
+    std::uint32_t dim, Graph *g) {
+  return REG(
+      Graph::get_reference_or_default(g), Lookup(param, ids, dim))[0];
+}
+
 template<>
 Node copy(const Node &x, Device *dev) {
   return REGX(x, Copy(Device::get_reference_or_default(dev)), x)[0];
@@ -318,6 +329,11 @@ Node stop_gradient(const Node &x) {
   return REGX(x, StopGradient(), x)[0];
 }
 
+template<>
+Node checkpoint(const Node &x) {
+  return REGX(x, Checkpoint(), x)[0];
+}
+
 template<>
 Node conv2d(
     const Node &x, const Node &w,
@@ -344,6 +360,33 @@ Node max_pool2d(
   )[0];
 }
 
+template<>
+std::vector<Node> lstm_cell(const Node &u, const Node &b, const Node &c) {
+  return REGX(u, LSTMCell(), u, b, c);
+}
+
+template<>
+Node gru_cell(const Node &ux, const Node &uh, const Node &h) {
+  return REGX(ux, GRUCell(), ux, uh, h)[0];
+}
+
+template<>
+std::vector<Node> sru(const Node &x, const Node &u, const Node &b) {
+  return REGX(x, SRU(), x, u, b);
+}
+
+template<>
+Node attention(const Node &q, const Node &k, const Node &v, float scale) {
+  return REGX(q, Attention(scale), q, k, v)[0];
+}
+
+template<>
+Node attention(
+    const Node &q, const Node &k, const Node &v, const Node &mask,
+    float scale) {
+  return REGX(q, Attention(scale), q, k, v, mask)[0];
+}
+
 namespace batch {
 
 template<>
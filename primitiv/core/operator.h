@@ -57,6 +57,26 @@ public:
    */
   virtual Device *get_device() const { return nullptr; }
 
+  /**
+   * Returns whether the operator has side effects or not.
+   * @return `true` if the operator updates some states other than its return
+   *         values and gradients of its arguments (e.g., random number
+   *         generators or gradients of parameters), `false` otherwise.
+   * @remarks Operators with side effects are never executed concurrently
+   *          with each other, and are executed in the order of the graph.
+   */
+  virtual bool has_side_effects() const { return false; }
+
+  /**
+   * Returns whether `backward()` accepts invalid gradients of arguments.
+   * @return `true` if `backward()` assigns the new gradient to each invalid
+   *         tensor in `args_g` instead of adding it, `false` if all tensors in
+   *         `args_g` should be initialized before calling `backward()`.
+   * @remarks This function allows callers to omit filling 0 to gradients
+   *          which are not yet calculated by any other operators.
+   */
+  virtual bool assigns_gradients() const { return false; }
+
   /**
    * Calculates only the resulting shape.
    * @param args Shapes of argument values.
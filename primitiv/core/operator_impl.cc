@@ -23,15 +23,54 @@ namespace operators {
 
 Input::Input(const Shape &shape, const vector<float> &data, Device &device)
 : shape_(shape)
-, data_(data)
+, data_()
+, value_()
 , device_(device) {
-  if (data_.size() != shape_.size()) {
+  set_data(data);
+}
+
+Input::Input(const Tensor &value)
+: shape_(value.shape())
+, data_()
+, value_()
+, device_(value.device()) {
+  set_value(value);
+}
+
+/*
+ * Other member functions.
+ */
+
+void Input::set_data(const vector<float> &data) {
+  if (data.size() != shape_.size()) {
     PRIMITIV_THROW_ERROR(
         "Data sizes mismatched."
         << " operator: Input"
         << ", required: " << shape_.size() << " (" << shape_.to_string() << ")"
-        << ", actual: " << data_.size());
+        << ", actual: " << data.size());
   }
+  data_ = data;
+  value_ = Tensor();
+}
+
+void Input::set_value(const Tensor &value) {
+  if (value.shape() != shape_) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched."
+        << " operator: Input"
+        << ", required: " << shape_.to_string()
+        << ", actual: " << value.shape().to_string());
+  }
+  if (&value.device() != &device_) {
+    PRIMITIV_THROW_ERROR(
+        "Device mismatched."
+        << " operator: Input"
+        << ", required: " << &device_
+        << ", actual: " << &value.device());
+  }
+  // The tensor shares its memory without copying values.
+  value_ = value;
+  data_.clear();
 }
 
 /*
@@ -52,6 +91,7 @@ Input::Input(const Shape &shape, const vector<float> &data, Device &device)
 
 IMPL_NAME_0(Input);
 IMPL_NAME_0(Parameter);
+IMPL_NAME_1(Lookup, dim_);
 IMPL_NAME_0(Copy);
 IMPL_NAME_1(Constant, k_);
 IMPL_NAME_1(Identity, size_);
@@ -83,6 +123,7 @@ IMPL_NAME_2(Broadcast, dim_, size_);
 IMPL_NAME_1(SoftmaxCrossEntropy, dim_);
 IMPL_NAME_1(SparseSoftmaxCrossEntropy, dim_);
 IMPL_NAME_0(StopGradient);
+IMPL_NAME_0(Checkpoint);
 IMPL_NAME_0(Flatten);
 IMPL_NAME_0(Positive);
 IMPL_NAME_0(Negative);
@@ -143,6 +184,11 @@ std::string BatchSlice::name() const {
 IMPL_NAME_1(BatchSplit, n_);
 IMPL_NAME_0(BatchConcat);
 IMPL_NAME_0(BatchSum);
+IMPL_NAME_0(LSTMCell);
+IMPL_NAME_0(GRUCell);
+IMPL_NAME_0(SRU);
+IMPL_NAME_1(Attention, scale_);
+IMPL_NAME_1(FusedElementwise, program_.instructions().size());
 
 std::string Convolution2D::name() const {
   return "Convolution2D("
@@ -188,6 +234,10 @@ std::string MaxPooling2D::name() const {
 
 FWD_SHAPE(Input) { UNUSED(x); *y[0] = shape_; }
 FWD_SHAPE(Parameter) { UNUSED(x); *y[0] = param_.shape(); }
+FWD_SHAPE(Lookup) {
+  UNUSED(x);
+  *y[0] = shape_ops::pick(param_.shape(), ids_, dim_);
+}
 FWD_SHAPE(Copy) { *y[0] = *x[0]; }
 FWD_SHAPE(Constant) { UNUSED(x); *y[0] = shape_; }
 FWD_SHAPE(Identity) { UNUSED(x); *y[0] = Shape({size_, size_}); }
@@ -285,6 +335,12 @@ FWD_SHAPE(BatchSplit) {
 }
 FWD_SHAPE(BatchConcat) { *y[0] = shape_ops::batch_concat(x); }
 FWD_SHAPE(BatchSum) { *y[0] = x[0]->resize_batch(1); }
+FWD_SHAPE(FusedElementwise) {
+  *y[0] = *x[0];
+  for (std::uint32_t i = 1; i < x.size(); ++i) {
+    *y[0] = shape_ops::elementwise(*y[0], *x[i]);
+  }
+}
 FWD_SHAPE(Convolution2D) {
   *y[0] = shape_ops::conv2d(
       *x[0], *x[1],
@@ -294,6 +350,25 @@ FWD_SHAPE(MaxPooling2D) {
   *y[0] = shape_ops::pool2d(
       *x[0], window0_, window1_, padding0_, padding1_, stride0_, stride1_);
 }
+FWD_SHAPE(LSTMCell) {
+  *y[0] = *y[1] = shape_ops::lstm_cell(*x[0], *x[1], *x[2]);
+}
+FWD_SHAPE(GRUCell) {
+  *y[0] = shape_ops::gru_cell(*x[0], *x[1], *x[2]);
+}
+FWD_SHAPE(SRU) {
+  *y[0] = *y[1] = shape_ops::sru(*x[0], *x[1], *x[2]);
+}
+FWD_SHAPE(Attention) {
+  if (x.size() != 3 && x.size() != 4) {
+    PRIMITIV_THROW_ERROR(
+        "Attention requires 3 or 4 arguments, but " << x.size() << " given.");
+  }
+  *y[0] = x.size() == 4
+    ? shape_ops::attention(*x[0], *x[1], *x[2], *x[3])
+    : shape_ops::attention(*x[0], *x[1], *x[2]);
+  *y[1] = Shape({1, (*y[0])[1]}, y[0]->batch());
+}
 FWD_SHAPE(SoftmaxCrossEntropy) {
   *y[0] = shape_ops::elementwise(*x[0], *x[1]);
   y[0]->update_dim(dim_, 1);
@@ -302,6 +377,7 @@ FWD_SHAPE(SparseSoftmaxCrossEntropy) {
   *y[0] = shape_ops::pick(*x[0], ids_, dim_);
 }
 FWD_SHAPE_UNARY(StopGradient);
+FWD_SHAPE_UNARY(Checkpoint);
 
 #undef FWD_SHAPE_UNARY
 #undef FWD_SHAPE_SCALAR
@@ -327,7 +403,13 @@ vector<const Tensor *> Parameter::get_inner_values() const {
 
 FORWARD(Input) {
   UNUSED(x);
-  *y[0] = functions::input<Tensor>(shape_, data_, device_);
+  if (value_.valid()) *y[0] = value_;
+  else *y[0] = functions::input<Tensor>(shape_, data_, device_);
+}
+
+FORWARD(Lookup) {
+  UNUSED(x);
+  *y[0] = functions::pick(param_.value(), ids_, dim_);
 }
 
 FORWARD(Copy) { *y[0] = functions::copy(*x[0], device_); }
@@ -442,6 +524,10 @@ FORWARD(BatchConcat) { *y[0] = functions::batch::concat(x); }
 
 FORWARD(BatchSum) { *y[0] = functions::batch::sum(*x[0]); }
 
+FORWARD(FusedElementwise) {
+  *y[0] = x[0]->device().elementwise_fw(program_, x);
+}
+
 FORWARD(Convolution2D) {
   *y[0] = functions::conv2d(
       *x[0], *x[1],
@@ -453,6 +539,24 @@ FORWARD(MaxPooling2D) {
       *x[0], window0_, window1_, padding0_, padding1_, stride0_, stride1_);
 }
 
+FORWARD(LSTMCell) {
+  x[0]->device().lstm_cell_fw(*x[0], *x[1], *x[2], *y[0], *y[1]);
+}
+
+FORWARD(GRUCell) {
+  x[0]->device().gru_cell_fw(*x[0], *x[1], *x[2], *y[0]);
+}
+
+FORWARD(SRU) {
+  x[0]->device().sru_fw(*x[0], *x[1], *x[2], *y[0], *y[1]);
+}
+
+FORWARD(Attention) {
+  const Tensor *mask = x.size() == 4 ? x[3] : nullptr;
+  x[0]->device().attention_fw(
+      *x[0], *x[1], *x[2], mask, scale_, *y[0], *y[1]);
+}
+
 FORWARD(SoftmaxCrossEntropy) {
   *y[0] = functions::softmax_cross_entropy(*x[0], *x[1], dim_);
 }
@@ -466,6 +570,7 @@ FORWARD(SparseSoftmaxCrossEntropy) {
 }
 
 FORWARD(StopGradient) { *y[0] = *x[0]; }
+FORWARD(Checkpoint) { *y[0] = *x[0]; }
 
 #undef FORWARD
 
@@ -473,6 +578,36 @@ FORWARD(StopGradient) { *y[0] = *x[0]; }
  * Backward operations.
  */
 
+namespace {
+
+// Adds `g` to the gradient `gx` of the argument `x`.
+// `g` is directly assigned to `gx` without filling 0 if `gx` is invalid.
+void add_gradient(const Tensor &g, const Tensor &x, Tensor &gx) {
+  if (gx.valid()) {
+    gx += g;
+  } else if (g.shape() == x.shape()) {
+    gx = g;
+  } else {
+    // `g` should be summed along the minibatch.
+    gx = functions::zeros<Tensor>(x.shape(), x.device());
+    gx += g;
+  }
+}
+
+// Subtracts `g` from the gradient `gx` of the argument `x`.
+void subtract_gradient(const Tensor &g, const Tensor &x, Tensor &gx) {
+  if (gx.valid()) {
+    gx -= g;
+  } else if (g.shape() == x.shape()) {
+    gx = -g;
+  } else {
+    gx = functions::zeros<Tensor>(x.shape(), x.device());
+    gx -= g;
+  }
+}
+
+}  // namespace
+
 #define BACKWARD(name) \
   void name::backward( \
       const vector<const Tensor *> &x, \
@@ -489,13 +624,19 @@ BACKWARD(Parameter) {
   UNUSED(x);
   UNUSED(y);
   UNUSED(gx);
-  param_.gradient() += *gy[0];
+  param_.add_gradient(*gy[0]);
 }
 
-BACKWARD(Copy) {
+BACKWARD(Lookup) {
   UNUSED(x);
   UNUSED(y);
-  *gx[0] += functions::copy(*gy[0], gx[0]->device());
+  UNUSED(gx);
+  param_.add_sparse_gradient(ids_, dim_, *gy[0]);
+}
+
+BACKWARD(Copy) {
+  UNUSED(y);
+  add_gradient(functions::copy(*gy[0], x[0]->device()), *x[0], *gx[0]);
 }
 
 BACKWARD_NOP(Constant);
@@ -506,9 +647,11 @@ BACKWARD_NOP(RandomNormal);
 BACKWARD_NOP(RandomLogNormal);
 
 BACKWARD(Pick) {
-  UNUSED(x);
   UNUSED(y);
-  gy[0]->device().pick_bw(*gy[0], ids_, dim_, *gx[0]);
+  Device &dev = gy[0]->device();
+  // Only picked slices receive the gradient, and others remain 0.
+  if (!gx[0]->valid()) *gx[0] = dev.new_tensor_by_constant(x[0]->shape(), 0);
+  dev.pick_bw(*gy[0], ids_, dim_, *gx[0]);
 }
 
 BACKWARD(Slice) {
@@ -528,36 +671,34 @@ BACKWARD(Split) {
 }
 
 BACKWARD(Concat) {
-  UNUSED(x);
   UNUSED(y);
   std::uint32_t offset = 0;
-  for (Tensor *gxi : gx) {
-    const std::uint32_t span = gxi->shape()[dim_];
-    *gxi += functions::slice(*gy[0], dim_, offset, offset + span);
+  for (std::uint32_t i = 0; i < x.size(); ++i) {
+    const std::uint32_t span = x[i]->shape()[dim_];
+    add_gradient(
+        functions::slice(*gy[0], dim_, offset, offset + span), *x[i], *gx[i]);
     offset += span;
   }
 }
 
 BACKWARD(Reshape) {
   UNUSED(y);
-  *gx[0] += gy[0]->reshape(x[0]->shape());
+  add_gradient(gy[0]->reshape(x[0]->shape()), *x[0], *gx[0]);
 }
 
 BACKWARD(Flatten) {
   UNUSED(y);
-  *gx[0] += gy[0]->reshape(x[0]->shape());
+  add_gradient(gy[0]->reshape(x[0]->shape()), *x[0], *gx[0]);
 }
 
 BACKWARD(Positive) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] += *gy[0];
+  add_gradient(*gy[0], *x[0], *gx[0]);
 }
 
 BACKWARD(Negative) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] -= *gy[0];
+  subtract_gradient(*gy[0], *x[0], *gx[0]);
 }
 
 BACKWARD(Abs) {
@@ -661,62 +802,75 @@ BACKWARD(PowN) {
 }
 
 BACKWARD(AddScalar) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] += *gy[0];
-  *gx[1] += functions::sum(gy[0]->flatten(), 0);
+  add_gradient(*gy[0], *x[0], *gx[0]);
+  add_gradient(functions::sum(gy[0]->flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(SubtractScalarR) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] += *gy[0];
-  *gx[1] -= functions::sum(gy[0]->flatten(), 0);
+  add_gradient(*gy[0], *x[0], *gx[0]);
+  subtract_gradient(functions::sum(gy[0]->flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(SubtractScalarL) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] -= *gy[0];
-  *gx[1] += functions::sum(gy[0]->flatten(), 0);
+  subtract_gradient(*gy[0], *x[0], *gx[0]);
+  add_gradient(functions::sum(gy[0]->flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(MultiplyScalar) {
   UNUSED(y);
-  *gx[0] += *x[1] * *gy[0];
-  *gx[1] += functions::sum((*x[0] * *gy[0]).flatten(), 0);
+  add_gradient(*x[1] * *gy[0], *x[0], *gx[0]);
+  add_gradient(
+      functions::sum((*x[0] * *gy[0]).flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(DivideScalarR) {
   const Tensor a = *gy[0] / *x[1];
-  *gx[0] += a;
-  *gx[1] -= functions::sum((a * *y[0]).flatten(), 0);
+  add_gradient(a, *x[0], *gx[0]);
+  subtract_gradient(
+      functions::sum((a * *y[0]).flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(DivideScalarL) {
   const Tensor a = *gy[0] / *x[0];
-  *gx[0] -= a * *y[0];
-  *gx[1] += functions::sum(a.flatten(), 0);
+  subtract_gradient(a * *y[0], *x[0], *gx[0]);
+  add_gradient(functions::sum(a.flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(PowScalarR) {
   const Tensor a = *gy[0] * *y[0];
-  *gx[0] += a * *x[1] / *x[0];
-  *gx[1] += functions::sum((a * functions::log(*x[0])).flatten(), 0);
+  add_gradient(a * *x[1] / *x[0], *x[0], *gx[0]);
+  add_gradient(
+      functions::sum((a * functions::log(*x[0])).flatten(), 0),
+      *x[1], *gx[1]);
 }
 
 BACKWARD(PowScalarL) {
   const Tensor a = *gy[0] * *y[0];
-  *gx[0] += a * functions::log(*x[1]);
-  *gx[1] += functions::sum((a * *x[0] / *x[1]).flatten(), 0);
+  add_gradient(a * functions::log(*x[1]), *x[0], *gx[0]);
+  add_gradient(
+      functions::sum((a * *x[0] / *x[1]).flatten(), 0), *x[1], *gx[1]);
 }
 
 BACKWARD(Add) {
-  gy[0]->device().add_bw(*x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
+  if (gx[0]->valid() && gx[1]->valid()) {
+    gy[0]->device().add_bw(*x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
+  } else {
+    add_gradient(*gy[0], *x[0], *gx[0]);
+    add_gradient(*gy[0], *x[1], *gx[1]);
+  }
 }
 
 BACKWARD(Subtract) {
-  gy[0]->device().subtract_bw(*x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
+  if (gx[0]->valid() && gx[1]->valid()) {
+    gy[0]->device().subtract_bw(
+        *x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
+  } else {
+    add_gradient(*gy[0], *x[0], *gx[0]);
+    subtract_gradient(*gy[0], *x[1], *gx[1]);
+  }
 }
 
 BACKWARD(Multiply) {
@@ -732,7 +886,15 @@ BACKWARD(Pow) {
 }
 
 BACKWARD(MatrixMultiply) {
-  gy[0]->device().matmul_bw(*x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
+  Device &dev = gy[0]->device();
+  // matmul_bw() accumulates the results, and also sums them along the
+  // minibatch for broadcasted operands without temporary products.
+  for (std::uint32_t i = 0; i < 2; ++i) {
+    if (!gx[i]->valid()) {
+      *gx[i] = dev.new_tensor_by_constant(x[i]->shape(), 0);
+    }
+  }
+  dev.matmul_bw(*x[0], *x[1], *y[0], *gy[0], *gx[0], *gx[1]);
 }
 
 BACKWARD(Flip) {
@@ -751,21 +913,23 @@ BACKWARD(Min) {
 
 BACKWARD(Sum) {
   UNUSED(y);
-  *gx[0] += functions::broadcast(*gy[0], dim_, x[0]->shape()[dim_]);
+  add_gradient(
+      functions::broadcast(*gy[0], dim_, x[0]->shape()[dim_]),
+      *x[0], *gx[0]);
 }
 
 BACKWARD(LogSumExp) {
   // NOTE(odashi): dy/dx = softmax(x) = exp(x - y)
   const std::uint32_t n = x[0]->shape()[dim_];
-  *gx[0]
-    += functions::exp(*x[0] - functions::broadcast(*y[0], dim_, n))
-    * functions::broadcast(*gy[0], dim_, n);
+  add_gradient(
+      functions::exp(*x[0] - functions::broadcast(*y[0], dim_, n))
+      * functions::broadcast(*gy[0], dim_, n),
+      *x[0], *gx[0]);
 }
 
 BACKWARD(Broadcast) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] += functions::sum(*gy[0], dim_);
+  add_gradient(functions::sum(*gy[0], dim_), *x[0], *gx[0]);
 }
 
 BACKWARD(BatchPick) {
@@ -791,20 +955,24 @@ BACKWARD(BatchSplit) {
 }
 
 BACKWARD(BatchConcat) {
-  UNUSED(x);
   UNUSED(y);
   std::uint32_t offset = 0;
-  for (Tensor *gxi : gx) {
-    const std::uint32_t span = gxi->shape().batch();
-    *gxi += functions::batch::slice(*gy[0], offset, offset + span);
+  for (std::uint32_t i = 0; i < x.size(); ++i) {
+    const std::uint32_t span = x[i]->shape().batch();
+    add_gradient(
+        functions::batch::slice(*gy[0], offset, offset + span),
+        *x[i], *gx[i]);
     offset += span;
   }
 }
 
 BACKWARD(BatchSum) {
-  UNUSED(x);
   UNUSED(y);
-  *gx[0] += *gy[0];
+  add_gradient(*gy[0], *x[0], *gx[0]);
+}
+
+BACKWARD(FusedElementwise) {
+  gy[0]->device().elementwise_bw(program_, x, *y[0], *gy[0], gx);
 }
 
 BACKWARD(Convolution2D) {
@@ -821,13 +989,38 @@ BACKWARD(MaxPooling2D) {
       *gx[0]);
 }
 
+BACKWARD(LSTMCell) {
+  gy[0]->device().lstm_cell_bw(
+      *x[0], *x[1], *x[2], *y[1], *gy[0], *gy[1], *gx[0], *gx[1], *gx[2]);
+}
+
+BACKWARD(GRUCell) {
+  UNUSED(y);
+  gy[0]->device().gru_cell_bw(
+      *x[0], *x[1], *x[2], *gy[0], *gx[0], *gx[1], *gx[2]);
+}
+
+BACKWARD(SRU) {
+  gy[0]->device().sru_bw(
+      *x[0], *x[1], *x[2], *y[1], *gy[0], *gy[1], *gx[0], *gx[1], *gx[2]);
+}
+
+BACKWARD(Attention) {
+  const bool masked = x.size() == 4;
+  gy[0]->device().attention_bw(
+      *x[0], *x[1], *x[2], masked ? x[3] : nullptr, *y[0], *y[1],
+      *gy[0], *gy[1], scale_, *gx[0], *gx[1], *gx[2],
+      masked ? gx[3] : nullptr);
+}
+
 BACKWARD(SoftmaxCrossEntropy) {
   UNUSED(y);
   const Tensor log_softmax_x = functions::log_softmax(*x[0], dim_);
   const Tensor bcast_gy = functions::broadcast(
       *gy[0], dim_, x[0]->shape()[dim_]);
-  *gx[0] += (functions::exp(log_softmax_x) - *x[1]) * bcast_gy;
-  *gx[1] -= log_softmax_x * bcast_gy;
+  add_gradient(
+      (functions::exp(log_softmax_x) - *x[1]) * bcast_gy, *x[0], *gx[0]);
+  subtract_gradient(log_softmax_x * bcast_gy, *x[1], *gx[1]);
 }
 
 BACKWARD(SparseSoftmaxCrossEntropy) {
@@ -848,6 +1041,11 @@ BACKWARD(SparseSoftmaxCrossEntropy) {
 
 BACKWARD_NOP(StopGradient);
 
+BACKWARD(Checkpoint) {
+  UNUSED(y);
+  add_gradient(*gy[0], *x[0], *gx[0]);
+}
+
 #undef BACKWARD_NOP
 #undef BACKWARD
 
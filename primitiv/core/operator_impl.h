@@ -3,6 +3,7 @@
 
 #include <cstdint>
 
+#include <primitiv/core/elementwise_program.h>
 #include <primitiv/core/operator.h>
 #include <primitiv/core/parameter.h>
 #include <primitiv/core/shape.h>
@@ -35,14 +36,24 @@ public: \
       const std::vector<const Tensor *> &args, \
       const std::vector<Tensor *> &rets) const override;
 
+// Declares that `backward()` assigns gradients to invalid `args_g`.
+#define PRIMITIV_DECL_ASSIGNS_GRADIENTS \
+public: \
+  bool assigns_gradients() const override { return true; }
+
 class Input : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(0, 1);
 public:
   Input(const Shape &shape, const std::vector<float> &data, Device &device);
+  explicit Input(const Tensor &value);
   Device *get_device() const override { return &device_; }
+  void set_data(const std::vector<float> &data);
+  void set_value(const Tensor &value);
 private:
   Shape shape_;
   std::vector<float> data_;
+  // If valid, `value_` is returned instead of making a tensor from `data_`.
+  Tensor value_;
   Device &device_;
 };
 
@@ -51,13 +62,30 @@ class Parameter : public Operator {
 public:
   explicit Parameter(primitiv::Parameter &param) : param_(param) {}
   Device *get_device() const override { return &param_.device(); }
+  bool has_side_effects() const override { return true; }
   std::vector<const Tensor *> get_inner_values() const override;
 private:
   primitiv::Parameter &param_;
 };
 
+class Lookup : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(0, 1);
+public:
+  Lookup(
+      primitiv::Parameter &param,
+      const std::vector<std::uint32_t> &ids, std::uint32_t dim)
+    : param_(param), ids_(ids), dim_(dim) {}
+  Device *get_device() const override { return &param_.device(); }
+  bool has_side_effects() const override { return true; }
+private:
+  primitiv::Parameter &param_;
+  std::vector<std::uint32_t> ids_;
+  std::uint32_t dim_;
+};
+
 class Copy : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit Copy(Device &device) : device_(device) {}
   Device *get_device() const override { return &device_; }
@@ -93,6 +121,7 @@ public:
   RandomBernoulli(const Shape &shape, float p, Device &device)
     : shape_(shape), p_(p), device_(device) {}
   Device *get_device() const override { return &device_; }
+  bool has_side_effects() const override { return true; }
 private:
   Shape shape_;
   float p_;
@@ -105,6 +134,7 @@ public:
   RandomUniform(const Shape &shape, float lower, float upper, Device &device)
     : shape_(shape), lower_(lower), upper_(upper), device_(device) {}
   Device *get_device() const override { return &device_; }
+  bool has_side_effects() const override { return true; }
 private:
   Shape shape_;
   float lower_;
@@ -118,6 +148,7 @@ public:
   RandomNormal(const Shape &shape, float mean, float sd, Device &device)
     : shape_(shape), mean_(mean), sd_(sd), device_(device) {}
   Device *get_device() const override { return &device_; }
+  bool has_side_effects() const override { return true; }
 private:
   Shape shape_;
   float mean_;
@@ -131,6 +162,7 @@ public:
   RandomLogNormal(const Shape &shape, float mu, float beta, Device &device)
     : shape_(shape), mu_(mu), beta_(beta), device_(device) {}
   Device *get_device() const override { return &device_; }
+  bool has_side_effects() const override { return true; }
 private:
   Shape shape_;
   float mu_;
@@ -140,6 +172,7 @@ private:
 
 class Pick : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   Pick(const std::vector<std::uint32_t> &ids, std::uint32_t dim)
     : ids_(ids), dim_(dim) {}
@@ -170,6 +203,7 @@ private:
 
 class Concat : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(Operator::NONZERO, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit Concat(std::uint32_t dim) : dim_(dim) {}
 private:
@@ -178,6 +212,7 @@ private:
 
 class Reshape : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit Reshape(const Shape &shape) : shape_(shape) {}
 private:
@@ -210,6 +245,7 @@ private:
 
 class Sum : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit Sum(std::uint32_t dim) : dim_(dim) {}
 private:
@@ -218,6 +254,7 @@ private:
 
 class LogSumExp : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit LogSumExp(std::uint32_t dim) : dim_(dim) {}
 private:
@@ -226,6 +263,7 @@ private:
 
 class Broadcast : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   Broadcast(std::uint32_t dim, std::uint32_t size) : dim_(dim), size_(size) {}
 private:
@@ -235,6 +273,7 @@ private:
 
 class SoftmaxCrossEntropy : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 public:
   explicit SoftmaxCrossEntropy(std::uint32_t dim) : dim_(dim) {}
 private:
@@ -265,6 +304,7 @@ private:
     PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1); \
   public: \
     explicit name_(type k) : k_(k) {} \
+    type k() const { return k_; } \
   private: \
     type k_; \
   }
@@ -275,11 +315,26 @@ private:
     PRIMITIV_DECL_DEFAULTS_AND_FORWARD(2, 1); \
   }
 
+// Unary operator with no parameter which assigns gradients.
+#define PRIMITIV_DECL_UNARY_ASSIGNS(name_) \
+  class name_ : public Operator { \
+    PRIMITIV_DECL_DEFAULTS_AND_FORWARD(1, 1); \
+    PRIMITIV_DECL_ASSIGNS_GRADIENTS; \
+  }
+
+// Binary operator with no parameter which assigns gradients.
+#define PRIMITIV_DECL_BINARY_ASSIGNS(name_) \
+  class name_ : public Operator { \
+    PRIMITIV_DECL_DEFAULTS_AND_FORWARD(2, 1); \
+    PRIMITIV_DECL_ASSIGNS_GRADIENTS; \
+  }
+
 PRIMITIV_DECL_UNARY(StopGradient);
-PRIMITIV_DECL_UNARY(Flatten);
+PRIMITIV_DECL_UNARY_ASSIGNS(Checkpoint);
+PRIMITIV_DECL_UNARY_ASSIGNS(Flatten);
 
-PRIMITIV_DECL_UNARY(Positive);
-PRIMITIV_DECL_UNARY(Negative);
+PRIMITIV_DECL_UNARY_ASSIGNS(Positive);
+PRIMITIV_DECL_UNARY_ASSIGNS(Negative);
 
 PRIMITIV_DECL_UNARY_K(AddConst, float);
 PRIMITIV_DECL_UNARY_K(SubtractConstR, float);
@@ -294,17 +349,17 @@ PRIMITIV_DECL_UNARY_K(ELU, float);
 
 PRIMITIV_DECL_UNARY_K(PowN, std::int32_t);
 
-PRIMITIV_DECL_BINARY(AddScalar);
-PRIMITIV_DECL_BINARY(SubtractScalarR);
-PRIMITIV_DECL_BINARY(SubtractScalarL);
-PRIMITIV_DECL_BINARY(MultiplyScalar);
-PRIMITIV_DECL_BINARY(DivideScalarR);
-PRIMITIV_DECL_BINARY(DivideScalarL);
-PRIMITIV_DECL_BINARY(PowScalarR);
-PRIMITIV_DECL_BINARY(PowScalarL);
-
-PRIMITIV_DECL_BINARY(Add);
-PRIMITIV_DECL_BINARY(Subtract);
+PRIMITIV_DECL_BINARY_ASSIGNS(AddScalar);
+PRIMITIV_DECL_BINARY_ASSIGNS(SubtractScalarR);
+PRIMITIV_DECL_BINARY_ASSIGNS(SubtractScalarL);
+PRIMITIV_DECL_BINARY_ASSIGNS(MultiplyScalar);
+PRIMITIV_DECL_BINARY_ASSIGNS(DivideScalarR);
+PRIMITIV_DECL_BINARY_ASSIGNS(DivideScalarL);
+PRIMITIV_DECL_BINARY_ASSIGNS(PowScalarR);
+PRIMITIV_DECL_BINARY_ASSIGNS(PowScalarL);
+
+PRIMITIV_DECL_BINARY_ASSIGNS(Add);
+PRIMITIV_DECL_BINARY_ASSIGNS(Subtract);
 PRIMITIV_DECL_BINARY(Multiply);
 PRIMITIV_DECL_BINARY(Divide);
 PRIMITIV_DECL_BINARY(Pow);
@@ -319,7 +374,7 @@ private:
   std::vector<std::uint32_t> perm_;
 };
 
-PRIMITIV_DECL_BINARY(MatrixMultiply);
+PRIMITIV_DECL_BINARY_ASSIGNS(MatrixMultiply);
 
 PRIMITIV_DECL_UNARY(Abs);
 PRIMITIV_DECL_UNARY(Sqrt);
@@ -362,9 +417,10 @@ private:
 
 class BatchConcat : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(Operator::NONZERO, 1);
+  PRIMITIV_DECL_ASSIGNS_GRADIENTS;
 };
 
-PRIMITIV_DECL_UNARY(BatchSum);
+PRIMITIV_DECL_UNARY_ASSIGNS(BatchSum);
 
 class Convolution2D : public Operator {
   PRIMITIV_DECL_DEFAULTS_AND_FORWARD(2, 1);
@@ -398,10 +454,48 @@ private:
   std::uint32_t stride0_, stride1_;
 };
 
+// One step of the LSTM cell: (u, b, c) -> (h, c_new).
+class LSTMCell : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(3, 2);
+};
+
+// One step of the GRU cell: (ux, uh, h) -> h_new.
+class GRUCell : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(3, 1);
+};
+
+// Whole sequence of the SRU: (x, u, b) -> (h, c).
+class SRU : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(3, 2);
+};
+
+// Scaled dot-product attention: (q, k, v[, mask]) -> (y, lse).
+class Attention : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(Operator::NONZERO, 2);
+public:
+  explicit Attention(float scale) : scale_(scale) {}
+private:
+  float scale_;
+};
+
+// Chain of elementwise operators evaluated at once.
+class FusedElementwise : public Operator {
+  PRIMITIV_DECL_DEFAULTS_AND_FORWARD(Operator::NONZERO, 1);
+public:
+  explicit FusedElementwise(const ElementwiseProgram &program)
+    : program_(program) {}
+  const ElementwiseProgram &program() const { return program_; }
+private:
+  ElementwiseProgram program_;
+};
+
 #undef PRIMITIV_DECL_UNARY
 #undef PRIMITIV_DECL_UNARY_K
 #undef PRIMITIV_DECL_BINARY
+#undef PRIMITIV_DECL_UNARY_ASSIGNS
+#undef PRIMITIV_DECL_BINARY_ASSIGNS
 
+#undef PRIMITIV_DECL_ASSIGNS_GRADIENTS
 #undef PRIMITIV_DECL_DEFAULTS_AND_FORWARD
 #undef PRIMITIV_DECL_DEFAULTS
 
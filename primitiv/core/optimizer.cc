@@ -1,16 +1,24 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <utility>
+#include <vector>
+
+#include <primitiv/core/device.h>
 #include <primitiv/core/error.h>
 #include <primitiv/core/file_format.h>
 #include <primitiv/core/functions.h>
 #include <primitiv/core/model.h>
 #include <primitiv/core/parameter.h>
 #include <primitiv/core/optimizer.h>
+#include <primitiv/core/tensor_expression.h>
 #include <primitiv/msgpack/reader.h>
 #include <primitiv/msgpack/writer.h>
 
+namespace E = primitiv::expressions;
+
 namespace primitiv {
 
 void Optimizer::load(const std::string &path) {
@@ -77,32 +85,61 @@ void Optimizer::update() {
   if (l2_strength_ > 0) {
     // Weight decay
     for (Parameter *param : params_) {
-      param->gradient() += l2_strength_ * param->value();
+      Tensor &g = param->gradient();
+      g = E::lazy(g) + l2_strength_ * E::lazy(param->value());
     }
   }
 
   if (clip_threshold_ > 0) {
     // Gradient clipping
+    // Gradients are reduced by one call for each device to avoid
+    // synchronizing the device for each parameter.
+    // Sparse gradients are clipped without making dense gradients.
+    std::vector<Tensor *> grads;
+    std::vector<std::pair<Device *, std::vector<const Tensor *>>> groups;
+    for (Parameter *param : params_) {
+      std::vector<std::uint32_t> ids;
+      std::uint32_t dim;
+      Tensor *g = param->has_sparse_gradient()
+        ? &param->sparse_gradient(ids, dim) : &param->gradient();
+      grads.emplace_back(g);
+      Device *dev = &param->device();
+      auto it = std::find_if(
+          groups.begin(), groups.end(),
+          [dev](const std::pair<Device *, std::vector<const Tensor *>> &g) {
+            return g.first == dev;
+          });
+      if (it == groups.end()) {
+        groups.emplace_back(dev, std::vector<const Tensor *>());
+        it = groups.end() - 1;
+      }
+      it->second.emplace_back(g);
+    }
     float sq_norm = 0;
-    for (const Parameter *param : params_) {
-      const Tensor &g = param->gradient();
-      sq_norm += functions::sum(functions::flatten(g * g), 0).to_float();
+    for (const auto &group : groups) {
+      sq_norm += group.first->squared_norm(group.second);
     }
     if (sq_norm > clip_threshold_ * clip_threshold_) {
       float clip_scale = clip_threshold_ / std::sqrt(sq_norm);
-      for (Parameter *param : params_) {
-        param->gradient() *= clip_scale;
+      for (Tensor *g : grads) {
+        *g *= clip_scale;
       }
     }
   }
 
-  for (Parameter *param : params_) {
-    update_parameter(lr_scale_, *param);
-  }
+  update_parameters(lr_scale_, std::vector<Parameter *>(
+        params_.begin(), params_.end()));
 
   ++epoch_;
 }
 
+void Optimizer::update_parameters(
+    float scale, const std::vector<Parameter *> &params) {
+  for (Parameter *param : params) {
+    update_parameter(scale, *param);
+  }
+}
+
 void Optimizer::get_configs(
     std::unordered_map<std::string, std::uint32_t> &uint_configs,
     std::unordered_map<std::string, float> &float_configs) const {
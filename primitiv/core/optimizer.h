@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <primitiv/core/error.h>
 #include <primitiv/core/mixins/nonmovable.h>
@@ -188,6 +189,17 @@ private:
    * @param scale Additional learning rate scaling factor.
    */
   virtual void update_parameter(float scale, Parameter &param) = 0;
+
+  /**
+   * Updates several parameters at once.
+   * @param scale Additional learning rate scaling factor.
+   * @param params Parameters to be updated.
+   * @remarks The default implementation calls `update_parameter()` for each
+   *          parameter. Subclasses may override this function to update
+   *          many parameters with a small number of device calls.
+   */
+  virtual void update_parameters(
+      float scale, const std::vector<Parameter *> &params);
 };
 
 }  // namespace primitiv
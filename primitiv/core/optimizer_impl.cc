@@ -1,15 +1,117 @@
 #include <primitiv/config.h>
 
 #include <algorithm>
-#include <cmath>
+#include <initializer_list>
+#include <list>
+#include <vector>
 
-#include <primitiv/core/functions.h>
+#include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
+#include <primitiv/core/device.h>
 #include <primitiv/core/parameter.h>
 #include <primitiv/core/optimizer_impl.h>
 
+using std::vector;
+
 namespace primitiv {
 namespace optimizers {
 
+namespace {
+
+// Tensors of parameters on the same device.
+struct ParameterGroup {
+  Device *device;
+  vector<const Tensor *> gs;
+  vector<Tensor *> xs;
+  vector<vector<Tensor *>> stats;
+};
+
+// Rows of a parameter which has only sparse gradients.
+struct SparseRows {
+  Parameter *param;
+  vector<std::uint32_t> ids;
+  std::uint32_t dim;
+  Tensor g;
+  // Rows of the value and statistics.
+  vector<Tensor> rows;
+};
+
+// Collects tensors of parameters to update them by fused device functions.
+// Parameters with sparse gradients are represented by gathered rows, which
+// are written back by `scatter()` after the update.
+class UpdateBatch {
+public:
+  UpdateBatch(
+      const vector<Parameter *> &params,
+      std::initializer_list<const char *> stats_names)
+  : stats_names_(stats_names) {
+    for (Parameter *param : params) {
+      if (param->has_sparse_gradient()) add_sparse(*param);
+      else add_dense(*param);
+    }
+  }
+
+  const vector<ParameterGroup> &groups() const { return groups_; }
+
+  // Writes updated rows back to parameters.
+  void scatter() {
+    for (SparseRows &sr : sparse_) {
+      Device &dev = sr.param->device();
+      for (std::uint32_t i = 0; i < sr.rows.size(); ++i) {
+        Tensor &dest = i == 0
+          ? sr.param->value() : sr.param->stats(stats_names_[i - 1]);
+        dev.pick_assign(sr.rows[i], sr.ids, sr.dim, dest);
+      }
+    }
+  }
+
+private:
+  ParameterGroup &group(Device &dev) {
+    auto it = std::find_if(
+        groups_.begin(), groups_.end(),
+        [&dev](const ParameterGroup &g) { return g.device == &dev; });
+    if (it != groups_.end()) return *it;
+    groups_.emplace_back(ParameterGroup {
+        &dev, {}, {}, vector<vector<Tensor *>>(stats_names_.size())});
+    return groups_.back();
+  }
+
+  void add_dense(Parameter &param) {
+    ParameterGroup &g = group(param.device());
+    g.gs.emplace_back(&param.gradient());
+    g.xs.emplace_back(&param.value());
+    for (std::uint32_t i = 0; i < stats_names_.size(); ++i) {
+      g.stats[i].emplace_back(&param.stats(stats_names_[i]));
+    }
+  }
+
+  void add_sparse(Parameter &param) {
+    sparse_.emplace_back();
+    SparseRows &sr = sparse_.back();
+    sr.param = &param;
+    sr.g = param.sparse_gradient(sr.ids, sr.dim);
+    sr.rows.emplace_back(functions::pick(param.value(), sr.ids, sr.dim));
+    for (const char *name : stats_names_) {
+      sr.rows.emplace_back(
+          functions::pick(param.stats(name), sr.ids, sr.dim));
+    }
+
+    ParameterGroup &g = group(param.device());
+    g.gs.emplace_back(&sr.g);
+    g.xs.emplace_back(&sr.rows[0]);
+    for (std::uint32_t i = 0; i < stats_names_.size(); ++i) {
+      g.stats[i].emplace_back(&sr.rows[i + 1]);
+    }
+  }
+
+  vector<const char *> stats_names_;
+  vector<ParameterGroup> groups_;
+  // std::list is used to keep addresses of tensors.
+  std::list<SparseRows> sparse_;
+};
+
+}  // namespace
+
 #define SET_CONFIG(dest, cfg, key) { \
   const auto it = cfg.find(key); \
   if (it != cfg.end()) { \
@@ -20,7 +122,16 @@ namespace optimizers {
 void SGD::configure_parameter(Parameter &) {}
 
 void SGD::update_parameter(float scale, Parameter &param) {
-  param.value() -= (scale * eta_) * param.gradient();
+  update_parameters(scale, {&param});
+}
+
+void SGD::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->sgd_update(g.gs, scale * eta_, g.xs);
+  }
+  batch.scatter();
 }
 
 void SGD::get_configs(
@@ -45,10 +156,17 @@ void MomentumSGD::configure_parameter(Parameter &param) {
 }
 
 void MomentumSGD::update_parameter(float scale, Parameter &param) {
-  Tensor &m = param.stats("MomentumSGD.m");
-  m *= momentum_;
-  m -= (scale * eta_) * param.gradient();
-  param.value() += m;
+  update_parameters(scale, {&param});
+}
+
+void MomentumSGD::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {"MomentumSGD.m"});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->momentum_sgd_update(
+        g.gs, scale * eta_, momentum_, g.xs, g.stats[0]);
+  }
+  batch.scatter();
 }
 
 void MomentumSGD::get_configs(
@@ -75,10 +193,17 @@ void AdaGrad::configure_parameter(Parameter &param) {
 }
 
 void AdaGrad::update_parameter(float scale, Parameter &param) {
-  const Tensor &g = param.gradient();
-  Tensor &m = param.stats("AdaGrad.m");
-  m += g * g;
-  param.value() -= (scale * eta_) * g / (functions::sqrt(m) + eps_);
+  update_parameters(scale, {&param});
+}
+
+void AdaGrad::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {"AdaGrad.m"});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->adagrad_update(
+        g.gs, scale * eta_, eps_, g.xs, g.stats[0]);
+  }
+  batch.scatter();
 }
 
 void AdaGrad::get_configs(
@@ -105,10 +230,17 @@ void RMSProp::configure_parameter(Parameter &param) {
 }
 
 void RMSProp::update_parameter(float scale, Parameter &param) {
-  const Tensor &g = param.gradient();
-  Tensor &m = param.stats("RMSProp.m");
-  m = alpha_ * m + (1 - alpha_) * g * g;
-  param.value() -= (scale * eta_) * g / (functions::sqrt(m) + eps_);
+  update_parameters(scale, {&param});
+}
+
+void RMSProp::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {"RMSProp.m"});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->rmsprop_update(
+        g.gs, scale * eta_, alpha_, eps_, g.xs, g.stats[0]);
+  }
+  batch.scatter();
 }
 
 void RMSProp::get_configs(
@@ -138,15 +270,17 @@ void AdaDelta::configure_parameter(Parameter &param) {
 }
 
 void AdaDelta::update_parameter(float scale, Parameter &param) {
-  const Tensor &g = param.gradient();
-  Tensor &m1 = param.stats("AdaDelta.m1");
-  Tensor &m2 = param.stats("AdaDelta.m2");
-  m2 *= rho_;
-  m2 += (1 - rho_) * g * g;
-  const Tensor dx = functions::sqrt((m1 + eps_) / (m2 + eps_)) * g;
-  m1 *= rho_;
-  m1 += (1 - rho_) * dx * dx;
-  param.value() -= scale * dx;
+  update_parameters(scale, {&param});
+}
+
+void AdaDelta::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {"AdaDelta.m1", "AdaDelta.m2"});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->adadelta_update(
+        g.gs, scale, rho_, eps_, g.xs, g.stats[0], g.stats[1]);
+  }
+  batch.scatter();
 }
 
 void AdaDelta::get_configs(
@@ -174,15 +308,18 @@ void Adam::configure_parameter(Parameter &param) {
 }
 
 void Adam::update_parameter(float scale, Parameter &param) {
-  const std::uint32_t epoch = get_epoch() + 1;
-  const Tensor &g = param.gradient();
-  Tensor &m1 = param.stats("Adam.m1");
-  Tensor &m2 = param.stats("Adam.m2");
-  m1 = beta1_ * m1 + (1 - beta1_) * g;
-  m2 = beta2_ * m2 + (1 - beta2_) * g * g;
-  const Tensor mm1 = m1 / (1 - std::pow(beta1_, epoch));
-  const Tensor mm2 = m2 / (1 - std::pow(beta2_, epoch));
-  param.value() -= (scale * alpha_) * mm1 / (functions::sqrt(mm2) + eps_);
+  update_parameters(scale, {&param});
+}
+
+void Adam::update_parameters(
+    float scale, const vector<Parameter *> &params) {
+  UpdateBatch batch(params, {"Adam.m1", "Adam.m2"});
+  for (const ParameterGroup &g : batch.groups()) {
+    g.device->adam_update(
+        g.gs, scale * alpha_, beta1_, beta2_, eps_, get_epoch() + 1,
+        g.xs, g.stats[0], g.stats[1]);
+  }
+  batch.scatter();
 }
 
 void Adam::get_configs(
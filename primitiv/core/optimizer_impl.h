@@ -16,7 +16,9 @@ public: \
       const std::unordered_map<std::string, float> &float_configs) override; \
 private: \
   void configure_parameter(Parameter &param) override; \
-  void update_parameter(float scale, Parameter &param) override;
+  void update_parameter(float scale, Parameter &param) override; \
+  void update_parameters( \
+      float scale, const std::vector<Parameter *> &params) override;
 
 /**
  * Simple stochastic gradient descent.
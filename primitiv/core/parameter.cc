@@ -1,6 +1,7 @@
 #include <primitiv/config.h>
 
 #include <fstream>
+#include <unordered_map>
 
 #include <primitiv/core/device.h>
 #include <primitiv/core/error.h>
@@ -8,6 +9,7 @@
 #include <primitiv/core/functions.h>
 #include <primitiv/core/initializer.h>
 #include <primitiv/core/parameter.h>
+#include <primitiv/core/shape_ops.h>
 
 using std::string;
 using std::vector;
@@ -82,7 +84,10 @@ Parameter::Parameter(
 : shape_(shape)
 , device_(&Device::get_reference_or_default(device))
 , value_(functions::input<Tensor>(shape, value, device_))
-, grad_(functions::zeros<Tensor>(shape, device_)) {
+, grad_(functions::zeros<Tensor>(shape, device_))
+, grad_reset_pending_(false)
+, sparse_dim_(0)
+, sparse_merged_(false) {
   ::assert_shape(value_, grad_);
 }
 
@@ -91,7 +96,10 @@ Parameter::Parameter(
 : shape_(shape)
 , device_(&Device::get_reference_or_default(device))
 , value_(functions::zeros<Tensor>(shape, device_))
-, grad_(functions::zeros<Tensor>(shape, device_)) {
+, grad_(functions::zeros<Tensor>(shape, device_))
+, grad_reset_pending_(false)
+, sparse_dim_(0)
+, sparse_merged_(false) {
   ::assert_shape(value_, grad_);
   initializer.apply(value_);
 }
@@ -109,6 +117,7 @@ void Parameter::init(
   device_ = &device_temp;
   value_ = std::move(value_temp);
   grad_ = std::move(grad_temp);
+  clear_gradient_state();
   stats_.clear();
 }
 
@@ -126,6 +135,7 @@ void Parameter::init(
   device_ = &device_temp;
   value_ = std::move(value_temp);
   grad_ = std::move(grad_temp);
+  clear_gradient_state();
   stats_.clear();
 }
 
@@ -155,6 +165,7 @@ void Parameter::load_inner(
   device_ = &device;
   value_ = std::move(value_temp);
   grad_ = std::move(grad_temp);
+  clear_gradient_state();
   stats_ = std::move(stats);
 }
 
@@ -216,7 +227,122 @@ void Parameter::save(const string &path, bool with_stats) const  {
 
 void Parameter::reset_gradient() {
   if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
-  grad_.reset(0);
+  // Filling 0 is postponed so that parameters which receive only sparse
+  // gradients never touch the whole gradient tensor.
+  grad_reset_pending_ = true;
+  sparse_grads_.clear();
+  sparse_merged_ = false;
+}
+
+void Parameter::add_gradient(const Tensor &gy) {
+  if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
+  if (gy.shape() != shape_) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched. gy.shape(): " << gy.shape().to_string()
+        << " != shape(): " << shape_.to_string());
+  }
+  if (&gy.device() != device_) {
+    PRIMITIV_THROW_ERROR(
+        "Device mismatched. &gy.device(): " << &gy.device()
+        << " != &device(): " << device_);
+  }
+  if (grad_reset_pending_) {
+    // `gy` may be placed on the memory managed by the computation graph, and
+    // the gradient should not share it. The memory of the previous gradient
+    // is reused if possible.
+    device_->copy_tensor(gy, grad_);
+    grad_reset_pending_ = false;
+    flush_gradient();
+  } else {
+    grad_ += gy;
+  }
+}
+
+void Parameter::add_sparse_gradient(
+    const vector<std::uint32_t> &ids, std::uint32_t dim, const Tensor &gy) {
+  if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
+  const Shape expected = shape_ops::pick(shape_, ids, dim);
+  if (gy.shape() != expected) {
+    PRIMITIV_THROW_ERROR(
+        "Shape mismatched. gy.shape(): " << gy.shape().to_string()
+        << " != expected shape: " << expected.to_string());
+  }
+  if (&gy.device() != device_) {
+    PRIMITIV_THROW_ERROR(
+        "Device mismatched. &gy.device(): " << &gy.device()
+        << " != &device(): " << device_);
+  }
+  if (!grad_reset_pending_) {
+    // The dense gradient is already used.
+    device_->pick_bw(gy, ids, dim, grad_);
+    return;
+  }
+  if (!sparse_grads_.empty() && dim != sparse_dim_) {
+    // Rows along different dimensions could not be merged.
+    flush_gradient();
+    device_->pick_bw(gy, ids, dim, grad_);
+    return;
+  }
+  sparse_dim_ = dim;
+  sparse_grads_.emplace_back(SparseGradient {ids, gy});
+  sparse_merged_ = false;
+}
+
+Tensor &Parameter::sparse_gradient(
+    vector<std::uint32_t> &ids, std::uint32_t &dim) {
+  if (!has_sparse_gradient()) {
+    PRIMITIV_THROW_ERROR("The parameter does not have sparse gradients.");
+  }
+  dim = sparse_dim_;
+  if (sparse_merged_) {
+    ids = sparse_grads_[0].ids;
+    return sparse_grads_[0].gy;
+  }
+
+  // Assigns a position to each distinct row.
+  vector<std::uint32_t> distinct;
+  vector<vector<std::uint32_t>> positions;
+  std::unordered_map<std::uint32_t, std::uint32_t> position_of;
+  for (const SparseGradient &sg : sparse_grads_) {
+    positions.emplace_back();
+    positions.back().reserve(sg.ids.size());
+    for (const std::uint32_t id : sg.ids) {
+      const auto it = position_of.emplace(id, distinct.size()).first;
+      if (it->second == distinct.size()) distinct.emplace_back(id);
+      positions.back().emplace_back(it->second);
+    }
+  }
+
+  Tensor merged = functions::zeros<Tensor>(
+      shape_ops::pick(shape_, distinct, sparse_dim_), device_);
+  for (std::uint32_t i = 0; i < sparse_grads_.size(); ++i) {
+    device_->batch_pick_bw(sparse_grads_[i].gy, positions[i], merged);
+  }
+  ids = distinct;
+  sparse_grads_.clear();
+  sparse_grads_.emplace_back(
+      SparseGradient {std::move(distinct), std::move(merged)});
+  sparse_merged_ = true;
+  return sparse_grads_[0].gy;
+}
+
+void Parameter::flush_gradient() const {
+  if (grad_reset_pending_) {
+    grad_.reset(0);
+    grad_reset_pending_ = false;
+  }
+  for (const SparseGradient &sg : sparse_grads_) {
+    device_->pick_bw(sg.gy, sg.ids, sparse_dim_, grad_);
+  }
+  sparse_grads_.clear();
+  sparse_merged_ = false;
+}
+
+void Parameter::clear_gradient_state() {
+  grad_reset_pending_ = false;
+  sparse_dim_ = 0;
+  sparse_grads_.clear();
+  sparse_merged_ = false;
 }
 
 void Parameter::add_stats(const string &name, const Shape &shape) {
@@ -43,7 +43,9 @@ public:
   /**
    * Creates an invalid parameter object.
    */
-  Parameter() : shape_(), device_(nullptr), value_(), grad_() {}
+  Parameter()
+    : shape_(), device_(nullptr), value_(), grad_()
+    , grad_reset_pending_(false), sparse_dim_(0), sparse_merged_(false) {}
 
   /**
    * Creates a new Parameter object.
@@ -226,9 +228,55 @@ public:
 
   /**
    * Set all gradients to 0.
+   * @remarks The dense gradient tensor is filled lazily at the next access
+   *          through `gradient()`.
    */
   void reset_gradient();
 
+  /**
+   * Accumulates a gradient of the whole parameter.
+   * @param gy Gradient to be added. The shape should be equal to `shape()`.
+   * @remarks The first call after `reset_gradient()` overwrites the gradient
+   *          tensor by `gy` instead of filling 0 before adding.
+   */
+  void add_gradient(const Tensor &gy);
+
+  /**
+   * Accumulates a gradient of some rows of the parameter.
+   * @param ids Row IDs along the dimension `dim`. IDs may be duplicated.
+   * @param dim Dimension along which rows are selected.
+   * @param gy Gradient of rows. The shape should be equal to that of
+   *           `functions::pick(value(), ids, dim)`.
+   * @remarks Sparse gradients are kept separately from the dense gradient
+   *          until `gradient()` is called, so that optimizers can update
+   *          only rows which appear in the gradient.
+   */
+  void add_sparse_gradient(
+      const std::vector<std::uint32_t> &ids, std::uint32_t dim,
+      const Tensor &gy);
+
+  /**
+   * Checks whether the gradient is held only as sparse rows.
+   * @return true if all nonzero gradients are given by
+   *         `add_sparse_gradient()`, false otherwise.
+   */
+  bool has_sparse_gradient() const {
+    if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
+    return grad_reset_pending_ && !sparse_grads_.empty();
+  }
+
+  /**
+   * Merges sparse gradients into one tensor with distinct row IDs.
+   * @param ids Destination of distinct row IDs.
+   * @param dim Destination of the dimension of rows.
+   * @return A tensor with the shape of `functions::pick(value(), ids, dim)`.
+   *         The n-th minibatch holds the total gradient of the row `ids[n]`.
+   *         The tensor can be modified until the next call of functions
+   *         which update the gradient.
+   * @throw primitiv::Error `has_sparse_gradient()` is false.
+   */
+  Tensor &sparse_gradient(std::vector<std::uint32_t> &ids, std::uint32_t &dim);
+
   /**
    * Adds a new optional statistics tensor.
    * @param name Name of the statistics.
@@ -289,6 +337,7 @@ public:
    */
   const Tensor &gradient() const {
     if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
+    flush_gradient();
     return grad_;
   }
 
@@ -298,7 +347,9 @@ public:
    */
   Tensor &gradient() {
     if (!valid()) PRIMITIV_THROW_ERROR("Invalid parameter.");
-    return grad_; }
+    flush_gradient();
+    return grad_;
+  }
 
   /**
    * Returns the current opotional statistics tensor specified by given name.
@@ -321,11 +372,37 @@ public:
   }
 
 private:
+  /**
+   * Gradient of some rows.
+   */
+  struct SparseGradient {
+    std::vector<std::uint32_t> ids;
+    Tensor gy;
+  };
+
+  /**
+   * Makes `grad_` hold the whole gradient, including sparse gradients.
+   */
+  void flush_gradient() const;
+
+  /**
+   * Clears the state of the gradient after replacing `grad_`.
+   */
+  void clear_gradient_state();
+
   Shape shape_;
   Device *device_;
   Tensor value_;
-  Tensor grad_;
   std::unordered_map<std::string, Tensor> stats_;
+
+  // Below members are updated by `flush_gradient()` in const functions.
+  mutable Tensor grad_;
+  // Whether `grad_` should be regarded as 0 regardless of its contents.
+  mutable bool grad_reset_pending_;
+  mutable std::uint32_t sparse_dim_;
+  mutable std::vector<SparseGradient> sparse_grads_;
+  // Whether `sparse_grads_` has only one entry with distinct IDs.
+  mutable bool sparse_merged_;
 };
 
 }  // namespace primitiv
@@ -211,6 +211,72 @@ Shape pool2d(
       x.batch());
 }
 
+Shape lstm_cell(const Shape &u, const Shape &b, const Shape &c) {
+  if (!u.is_column_vector() || !b.is_column_vector() ||
+      !c.is_column_vector() || u[0] != 4 * c[0] || b[0] != u[0] ||
+      !u.has_compatible_batch(b) || !u.has_compatible_batch(c) ||
+      !b.has_compatible_batch(c)) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid arguments to calculate an LSTM cell: "
+        << u.to_string() << ", " << b.to_string() << ", " << c.to_string());
+  }
+  return Shape(
+      {c[0]}, std::max(u.batch(), std::max(b.batch(), c.batch())));
+}
+
+Shape gru_cell(const Shape &ux, const Shape &uh, const Shape &h) {
+  if (!ux.is_column_vector() || !uh.is_column_vector() ||
+      !h.is_column_vector() || ux[0] != 3 * h[0] || uh[0] != ux[0] ||
+      !ux.has_compatible_batch(uh) || !ux.has_compatible_batch(h) ||
+      !uh.has_compatible_batch(h)) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid arguments to calculate a GRU cell: "
+        << ux.to_string() << ", " << uh.to_string() << ", " << h.to_string());
+  }
+  return Shape(
+      {h[0]}, std::max(ux.batch(), std::max(uh.batch(), h.batch())));
+}
+
+Shape sru(const Shape &x, const Shape &u, const Shape &b) {
+  if (!x.is_matrix() || !u.is_matrix() || !b.is_column_vector() ||
+      u[0] != 3 * x[0] || u[1] != x[1] || b[0] != 2 * x[0] ||
+      !x.has_compatible_batch(u) || !x.has_compatible_batch(b) ||
+      !u.has_compatible_batch(b)) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid arguments to calculate an SRU: "
+        << x.to_string() << ", " << u.to_string() << ", " << b.to_string());
+  }
+  return Shape(
+      {x[0], x[1]}, std::max(x.batch(), std::max(u.batch(), b.batch())));
+}
+
+Shape attention(const Shape &q, const Shape &k, const Shape &v) {
+  if (!q.is_matrix() || !k.is_matrix() || !v.is_matrix() ||
+      k[0] != q[0] || v[1] != k[1] ||
+      !q.has_compatible_batch(k) || !q.has_compatible_batch(v) ||
+      !k.has_compatible_batch(v)) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid arguments to calculate an attention: "
+        << q.to_string() << ", " << k.to_string() << ", " << v.to_string());
+  }
+  return Shape(
+      {v[0], q[1]}, std::max(q.batch(), std::max(k.batch(), v.batch())));
+}
+
+Shape attention(
+    const Shape &q, const Shape &k, const Shape &v, const Shape &mask) {
+  const Shape y = attention(q, k, v);
+  if (!mask.is_matrix() || mask[0] != k[1] || mask[1] != q[1] ||
+      !mask.has_compatible_batch(q) || !mask.has_compatible_batch(k) ||
+      !mask.has_compatible_batch(v)) {
+    PRIMITIV_THROW_ERROR(
+        "Invalid arguments to calculate a masked attention: "
+        << q.to_string() << ", " << k.to_string() << ", " << v.to_string()
+        << ", " << mask.to_string());
+  }
+  return y.resize_batch(std::max(y.batch(), mask.batch()));
+}
+
 Shape batch_pick(const Shape &x, const std::vector<std::uint32_t> &ids) {
   const std::uint32_t n = x.batch();
   const std::uint32_t bi = ids.size();
@@ -141,6 +141,53 @@ Shape pool2d(
     std::uint32_t padding0, std::uint32_t padding1,
     std::uint32_t stride0, std::uint32_t stride1);
 
+/**
+ * Calculates a resulting shape of the LSTM cell.
+ * @param u Shape of preactivations of gates.
+ * @param b Shape of biases of gates.
+ * @param c Shape of the previous cell state.
+ * @return Calculated shape of both the new hidden and cell states.
+ */
+Shape lstm_cell(const Shape &u, const Shape &b, const Shape &c);
+
+/**
+ * Calculates a resulting shape of the GRU cell.
+ * @param ux Shape of preactivations of gates from the input.
+ * @param uh Shape of preactivations of gates from the previous state.
+ * @param h Shape of the previous hidden state.
+ * @return Calculated shape of the new hidden state.
+ */
+Shape gru_cell(const Shape &ux, const Shape &uh, const Shape &h);
+
+/**
+ * Calculates a resulting shape of the SRU.
+ * @param x Shape of the input sequence.
+ * @param u Shape of transformed inputs.
+ * @param b Shape of biases of gates.
+ * @return Calculated shape of both the hidden and cell state sequences.
+ */
+Shape sru(const Shape &x, const Shape &u, const Shape &b);
+
+/**
+ * Calculates a resulting shape of the scaled dot-product attention.
+ * @param q Shape of queries.
+ * @param k Shape of keys.
+ * @param v Shape of values.
+ * @return Calculated shape of attended values.
+ */
+Shape attention(const Shape &q, const Shape &k, const Shape &v);
+
+/**
+ * Calculates a resulting shape of the masked scaled dot-product attention.
+ * @param q Shape of queries.
+ * @param k Shape of keys.
+ * @param v Shape of values.
+ * @param mask Shape of the mask added to attention scores.
+ * @return Calculated shape of attended values.
+ */
+Shape attention(
+    const Shape &q, const Shape &k, const Shape &v, const Shape &mask);
+
 /**
  * Calculates a picked shape with the batch addresses.
  * @param x A shape.
@@ -20,6 +20,11 @@ std::vector<float> Tensor::to_vector() const {
   return device_->tensor_to_vector(*this);
 }
 
+void Tensor::to_array(float values[]) const {
+  check_valid();
+  device_->tensor_to_array(*this, values);
+}
+
 std::vector<std::uint32_t> Tensor::argmax(std::uint32_t dim) const {
   check_valid();
   return device_->argmax(*this, dim);
@@ -97,6 +97,14 @@ public:
    */
   std::vector<float> to_vector() const;
 
+  /**
+   * Retrieves internal values in the tensor into an array.
+   * @param values Pointer to the array which has at least `shape().size()`
+   *               elements.
+   * @remarks The order of values is same as that of `to_vector()`.
+   */
+  void to_array(float values[]) const;
+
   /**
    * Retrieves argmax indices along an axis.
    * @param dim A specified axis.
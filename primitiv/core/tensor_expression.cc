@@ -0,0 +1,164 @@
+#include <primitiv/config.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
+#include <primitiv/core/device.h>
+#include <primitiv/core/error.h>
+#include <primitiv/core/tensor_expression.h>
+
+using std::vector;
+
+namespace primitiv {
+namespace expressions {
+
+/**
+ * Node of the expression tree.
+ * Leaves hold valid tensors, and other terms hold an operation.
+ */
+struct Expression::Term {
+  Tensor value;
+  Opcode opcode;
+  float k;
+  std::shared_ptr<const Term> a;
+  std::shared_ptr<const Term> b;
+};
+
+namespace {
+
+using Opcode = ElementwiseProgram::Opcode;
+
+// Applies an operation using Tensor functions.
+Tensor apply_eagerly(
+    Opcode opcode, const Tensor &a, const Tensor &b, float k) {
+  switch (opcode) {
+    case Opcode::COPY: return a;
+    case Opcode::NEGATE: return -a;
+    case Opcode::ABS: return functions::abs(a);
+    case Opcode::SQRT: return functions::sqrt(a);
+    case Opcode::EXP: return functions::exp(a);
+    case Opcode::LOG: return functions::log(a);
+    case Opcode::TANH: return functions::tanh(a);
+    case Opcode::SIGMOID: return functions::sigmoid(a);
+    case Opcode::SOFTPLUS: return functions::softplus(a);
+    case Opcode::SIN: return functions::sin(a);
+    case Opcode::COS: return functions::cos(a);
+    case Opcode::TAN: return functions::tan(a);
+    case Opcode::PRELU: return functions::prelu(a, k);
+    case Opcode::ELU: return functions::elu(a, k);
+    case Opcode::ADD_CONST: return a + k;
+    case Opcode::SUBTRACT_CONST_R: return a - k;
+    case Opcode::SUBTRACT_CONST_L: return k - a;
+    case Opcode::MULTIPLY_CONST: return a * k;
+    case Opcode::DIVIDE_CONST_R: return a / k;
+    case Opcode::DIVIDE_CONST_L: return k / a;
+    case Opcode::ADD: return a + b;
+    case Opcode::SUBTRACT: return a - b;
+    case Opcode::MULTIPLY: return a * b;
+    case Opcode::DIVIDE: return a / b;
+  }
+  PRIMITIV_THROW_ERROR("Unknown opcode: " << static_cast<int>(opcode));
+}
+
+}  // namespace
+
+Expression::Expression(const Tensor &x)
+: term_(std::make_shared<Term>(Term {x, Opcode::COPY, 0, nullptr, nullptr})) {
+  x.check_valid();
+}
+
+Expression Expression::unary(Opcode opcode, const Expression &x, float k) {
+  if (ElementwiseProgram::is_binary(opcode)) {
+    PRIMITIV_THROW_ERROR(
+        "Binary opcode is used as a unary expression: "
+        << static_cast<int>(opcode));
+  }
+  return Expression(std::make_shared<Term>(
+        Term {Tensor(), opcode, k, x.term_, nullptr}));
+}
+
+Expression Expression::binary(
+    Opcode opcode, const Expression &a, const Expression &b) {
+  if (!ElementwiseProgram::is_binary(opcode)) {
+    PRIMITIV_THROW_ERROR(
+        "Unary opcode is used as a binary expression: "
+        << static_cast<int>(opcode));
+  }
+  return Expression(std::make_shared<Term>(
+        Term {Tensor(), opcode, 0, a.term_, b.term_}));
+}
+
+Tensor Expression::evaluate() const {
+  if (term_->value.valid()) return term_->value;
+
+  // Enumerates distinct terms in the post order.
+  vector<const Term *> leaves;
+  vector<const Term *> ops;
+  std::unordered_map<const Term *, std::uint32_t> ids;
+  {
+    vector<std::pair<const Term *, bool>> stack {{term_.get(), false}};
+    while (!stack.empty()) {
+      const Term *t = stack.back().first;
+      const bool expanded = stack.back().second;
+      stack.pop_back();
+      if (ids.count(t)) continue;
+      if (t->value.valid()) {
+        ids.emplace(t, leaves.size());
+        leaves.emplace_back(t);
+      } else if (expanded) {
+        ids.emplace(t, ops.size());
+        ops.emplace_back(t);
+      } else {
+        stack.emplace_back(t, true);
+        if (t->b) stack.emplace_back(t->b.get(), false);
+        stack.emplace_back(t->a.get(), false);
+      }
+    }
+  }
+
+  // Single operations are directly calculated by the device functions,
+  // which have their own optimized kernels.
+  Device &dev = leaves[0]->value.device();
+  bool fusable =
+    ops.size() > 1 &&
+    dev.supports_elementwise_fusion() &&
+    leaves.size() + ops.size() <= ElementwiseProgram::MAX_REGISTERS;
+  // Tensor functions also accept scalar operands with different dims, which
+  // are not supported by elementwise programs.
+  for (const Term *t : leaves) {
+    fusable = fusable &&
+      t->value.shape().has_same_dims(leaves[0]->value.shape());
+  }
+
+  if (!fusable) {
+    vector<Tensor> values;
+    values.reserve(ops.size());
+    const auto value = [&](const Term *t) -> const Tensor & {
+      return t->value.valid() ? t->value : values[ids.at(t)];
+    };
+    for (const Term *t : ops) {
+      values.emplace_back(apply_eagerly(
+            t->opcode, value(t->a.get()),
+            t->b ? value(t->b.get()) : Tensor(), t->k));
+    }
+    return values.back();
+  }
+
+  ElementwiseProgram program(leaves.size());
+  const auto reg = [&](const Term *t) {
+    return t->value.valid() ? ids.at(t) : leaves.size() + ids.at(t);
+  };
+  for (const Term *t : ops) {
+    program.add_instruction(
+        t->opcode, reg(t->a.get()), t->b ? reg(t->b.get()) : 0, t->k);
+  }
+  vector<const Tensor *> xs;
+  xs.reserve(leaves.size());
+  for (const Term *t : leaves) xs.emplace_back(&t->value);
+  return dev.elementwise_fw(program, xs);
+}
+
+}  // namespace expressions
+}  // namespace primitiv
@@ -0,0 +1,158 @@
+#ifndef PRIMITIV_CORE_TENSOR_EXPRESSION_H_
+#define PRIMITIV_CORE_TENSOR_EXPRESSION_H_
+
+#include <memory>
+
+#include <primitiv/core/elementwise_program.h>
+#include <primitiv/core/tensor.h>
+
+namespace primitiv {
+namespace expressions {
+
+/**
+ * Lazily evaluated elementwise expression of Tensors.
+ * Operators on Expression objects only record the computation, and the whole
+ * expression is evaluated by `evaluate()` with one pass over the memory if
+ * the device supports elementwise programs. The program is evaluated over
+ * small blocks of elements by the vectorized kernels of the device.
+ * Otherwise, or if the expression has only one operation, the expression is
+ * evaluated by the usual Tensor functions.
+ *
+ * Example:
+ * @code
+ * namespace E = primitiv::expressions;
+ * // Only one tensor is allocated.
+ * const Tensor y = E::sqrt(E::lazy(a) * E::lazy(b) + 1);
+ * @endcode
+ */
+class Expression {
+public:
+  using Opcode = ElementwiseProgram::Opcode;
+
+  /**
+   * Creates a new expression which represents a tensor.
+   * @param x A tensor.
+   * @throw primitiv::Error `x` is invalid.
+   */
+  Expression(const Tensor &x);
+
+  Expression(const Expression &) = default;
+  Expression(Expression &&) = default;
+  Expression &operator=(const Expression &) = default;
+  Expression &operator=(Expression &&) = default;
+  ~Expression() = default;
+
+  /**
+   * Creates a new expression which applies a unary operation.
+   * @param opcode Opcode of the operation. This should not be binary.
+   * @param x An expression of the argument.
+   * @param k Immediate value of the operation.
+   * @return A new expression.
+   * @throw primitiv::Error `opcode` is binary.
+   */
+  static Expression unary(Opcode opcode, const Expression &x, float k = 0);
+
+  /**
+   * Creates a new expression which applies a binary operation.
+   * @param opcode Opcode of the operation. This should be binary.
+   * @param a An expression of the first argument.
+   * @param b An expression of the second argument.
+   * @return A new expression.
+   * @throw primitiv::Error `opcode` is not binary.
+   */
+  static Expression binary(
+      Opcode opcode, const Expression &a, const Expression &b);
+
+  /**
+   * Evaluates the expression.
+   * @return A new tensor, or the original tensor if the expression directly
+   *         represents a tensor.
+   * @remarks Common sub-expressions (i.e., same Expression objects used
+   *          several times) are evaluated only once.
+   */
+  Tensor evaluate() const;
+
+  /**
+   * Evaluates the expression.
+   * @return A new tensor.
+   */
+  operator Tensor() const { return evaluate(); }
+
+private:
+  struct Term;
+
+  explicit Expression(std::shared_ptr<const Term> &&term)
+    : term_(std::move(term)) {}
+
+  std::shared_ptr<const Term> term_;
+};
+
+/**
+ * Creates a new expression which represents a tensor.
+ * @param x A tensor.
+ * @return A new expression.
+ */
+inline Expression lazy(const Tensor &x) { return Expression(x); }
+
+/// @cond
+
+#define PRIMITIV_EXPR_UNARY(name, opcode) \
+inline Expression name(const Expression &x) { \
+  return Expression::unary(Expression::Opcode::opcode, x); \
+}
+
+#define PRIMITIV_EXPR_UNARY_K(name, opcode) \
+inline Expression name(const Expression &x, float k) { \
+  return Expression::unary(Expression::Opcode::opcode, x, k); \
+}
+
+#define PRIMITIV_EXPR_CONST(op, opcode_r, opcode_l) \
+inline Expression operator op(const Expression &x, float k) { \
+  return Expression::unary(Expression::Opcode::opcode_r, x, k); \
+} \
+inline Expression operator op(float k, const Expression &x) { \
+  return Expression::unary(Expression::Opcode::opcode_l, x, k); \
+}
+
+#define PRIMITIV_EXPR_BINARY(op, opcode) \
+inline Expression operator op(const Expression &a, const Expression &b) { \
+  return Expression::binary(Expression::Opcode::opcode, a, b); \
+}
+
+inline Expression operator+(const Expression &x) { return x; }
+PRIMITIV_EXPR_UNARY(operator-, NEGATE)
+
+PRIMITIV_EXPR_UNARY(abs, ABS)
+PRIMITIV_EXPR_UNARY(sqrt, SQRT)
+PRIMITIV_EXPR_UNARY(exp, EXP)
+PRIMITIV_EXPR_UNARY(log, LOG)
+PRIMITIV_EXPR_UNARY(tanh, TANH)
+PRIMITIV_EXPR_UNARY(sigmoid, SIGMOID)
+PRIMITIV_EXPR_UNARY(softplus, SOFTPLUS)
+PRIMITIV_EXPR_UNARY(sin, SIN)
+PRIMITIV_EXPR_UNARY(cos, COS)
+PRIMITIV_EXPR_UNARY(tan, TAN)
+PRIMITIV_EXPR_UNARY_K(prelu, PRELU)
+PRIMITIV_EXPR_UNARY_K(elu, ELU)
+
+PRIMITIV_EXPR_CONST(+, ADD_CONST, ADD_CONST)
+PRIMITIV_EXPR_CONST(-, SUBTRACT_CONST_R, SUBTRACT_CONST_L)
+PRIMITIV_EXPR_CONST(*, MULTIPLY_CONST, MULTIPLY_CONST)
+PRIMITIV_EXPR_CONST(/, DIVIDE_CONST_R, DIVIDE_CONST_L)
+
+PRIMITIV_EXPR_BINARY(+, ADD)
+PRIMITIV_EXPR_BINARY(-, SUBTRACT)
+PRIMITIV_EXPR_BINARY(*, MULTIPLY)
+PRIMITIV_EXPR_BINARY(/, DIVIDE)
+
+#undef PRIMITIV_EXPR_UNARY
+#undef PRIMITIV_EXPR_UNARY_K
+#undef PRIMITIV_EXPR_CONST
+#undef PRIMITIV_EXPR_BINARY
+
+/// @endcond
+
+}  // namespace expressions
+}  // namespace primitiv
+
+#endif  // PRIMITIV_CORE_TENSOR_EXPRESSION_H_
@@ -136,6 +136,11 @@ Tensor parameter_tensor(Parameter &param) {
   return param.value();
 }
 
+Tensor lookup_tensor(
+    Parameter &param, const std::vector<std::uint32_t> &ids, std::uint32_t dim) {
+  return param.device().pick_fw(param.value(), ids, dim);
+}
+
 template<>
 Tensor copy(const Tensor &x, Device *dev) {
   return ::get_device(dev).copy_tensor(x);
@@ -331,6 +336,9 @@ Tensor softmax_cross_entropy(
 template<>
 Tensor stop_gradient(const Tensor &x) { return x; }
 
+template<>
+Tensor checkpoint(const Tensor &x) { return x; }
+
 template<>
 Tensor conv2d(
     const Tensor &x, const Tensor &w,
@@ -351,6 +359,45 @@ Tensor max_pool2d(
       x, window0, window1, padding0, padding1, stride0, stride1);
 }
 
+template<>
+std::vector<Tensor> lstm_cell(
+    const Tensor &u, const Tensor &b, const Tensor &c) {
+  std::vector<Tensor> ret(2);
+  u.device().lstm_cell_fw(u, b, c, ret[0], ret[1]);
+  return ret;
+}
+
+template<>
+Tensor gru_cell(const Tensor &ux, const Tensor &uh, const Tensor &h) {
+  Tensor y;
+  ux.device().gru_cell_fw(ux, uh, h, y);
+  return y;
+}
+
+template<>
+std::vector<Tensor> sru(const Tensor &x, const Tensor &u, const Tensor &b) {
+  std::vector<Tensor> ret(2);
+  x.device().sru_fw(x, u, b, ret[0], ret[1]);
+  return ret;
+}
+
+template<>
+Tensor attention(
+    const Tensor &q, const Tensor &k, const Tensor &v, float scale) {
+  Tensor y, lse;
+  q.device().attention_fw(q, k, v, nullptr, scale, y, lse);
+  return y;
+}
+
+template<>
+Tensor attention(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor &mask,
+    float scale) {
+  Tensor y, lse;
+  q.device().attention_fw(q, k, v, &mask, scale, y, lse);
+  return y;
+}
+
 namespace batch {
 
 template<>
@@ -0,0 +1,220 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+
+#include <primitiv/core/error.h>
+#include <primitiv/core/thread_pool.h>
+
+namespace primitiv {
+
+ThreadPool::ThreadPool(std::uint32_t num_threads)
+: num_threads_(num_threads)
+, queues_()
+, workers_()
+, generation_(0)
+, num_active_(0)
+, stop_(false)
+, successors_(nullptr)
+, task_(nullptr)
+, counters_()
+, remaining_(0)
+, num_ready_(0)
+, failed_(false)
+, error_() {
+  if (num_threads == 0) {
+    PRIMITIV_THROW_ERROR("Number of threads should be greater than 0.");
+  }
+  queues_.reset(new Queue[num_threads]);
+  workers_.reserve(num_threads - 1);
+  for (std::uint32_t i = 1; i < num_threads; ++i) {
+    workers_.emplace_back(&ThreadPool::worker_main, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::run(
+    const std::vector<std::vector<std::uint32_t>> &successors,
+    const std::function<void(std::uint32_t)> &task) {
+  const std::lock_guard<std::mutex> lock(run_mutex_);
+  execute(successors, task);
+}
+
+void ThreadPool::parallel_for(
+    std::size_t size, std::size_t grain_size,
+    const std::function<void(std::size_t, std::size_t)> &fn) {
+  const std::size_t num_chunks = std::min<std::size_t>(
+      num_threads_, size / std::max<std::size_t>(grain_size, 1));
+  if (num_chunks < 2) {
+    fn(0, size);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(run_mutex_, std::try_to_lock);
+  if (!lock) {
+    // Another thread is executing a job on this pool.
+    fn(0, size);
+    return;
+  }
+
+  const std::vector<std::vector<std::uint32_t>> successors(num_chunks);
+  execute(successors, [&](std::uint32_t i) {
+      fn(size * i / num_chunks, size * (i + 1) / num_chunks);
+  });
+}
+
+void ThreadPool::execute(
+    const std::vector<std::vector<std::uint32_t>> &successors,
+    const std::function<void(std::uint32_t)> &task) {
+  const std::uint32_t num_tasks = successors.size();
+  if (num_tasks == 0) return;
+
+  // Counts the number of unfinished predecessors of each task.
+  counters_.reset(new std::atomic<std::uint32_t>[num_tasks]);
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    counters_[i] = 0;
+  }
+  for (const auto &succs : successors) {
+    for (const std::uint32_t s : succs) {
+      ++counters_[s];
+    }
+  }
+
+  successors_ = &successors;
+  task_ = &task;
+  remaining_ = num_tasks;
+  num_ready_ = 0;
+  failed_ = false;
+  error_ = nullptr;
+
+  // Distributes initial tasks to all workers.
+  std::uint32_t worker_id = 0;
+  for (std::uint32_t i = 0; i < num_tasks; ++i) {
+    if (counters_[i] == 0) {
+      queues_[worker_id].tasks.emplace_back(i);
+      ++num_ready_;
+      worker_id = (worker_id + 1) % num_threads_;
+    }
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    num_active_ = num_threads_ - 1;
+    ++generation_;
+  }
+  cv_.notify_all();
+
+  work(0);
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return num_active_ == 0; });
+  }
+
+  successors_ = nullptr;
+  task_ = nullptr;
+  if (error_) std::rethrow_exception(error_);
+}
+
+void ThreadPool::worker_main(std::uint32_t worker_id) {
+  std::uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] { return stop_ || generation_ != generation; });
+      if (stop_) return;
+      generation = generation_;
+    }
+
+    work(worker_id);
+
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      --num_active_;
+    }
+    cv_.notify_all();
+  }
+}
+
+void ThreadPool::work(std::uint32_t worker_id) {
+  while (true) {
+    std::uint32_t task_id;
+    if (!pop_task(worker_id, task_id)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return num_ready_ > 0 || remaining_ == 0; });
+      if (remaining_ == 0) return;
+      continue;
+    }
+
+    // After a failure, remaining tasks are only drained without execution.
+    if (!failed_) {
+      try {
+        (*task_)(task_id);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+        failed_ = true;
+      }
+    }
+
+    for (const std::uint32_t s : (*successors_)[task_id]) {
+      if (--counters_[s] == 0) push_task(worker_id, s);
+    }
+
+    if (--remaining_ == 0) {
+      { const std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_all();
+      return;
+    }
+  }
+}
+
+void ThreadPool::push_task(std::uint32_t worker_id, std::uint32_t task_id) {
+  {
+    Queue &q = queues_[worker_id];
+    const std::lock_guard<std::mutex> lock(q.mutex);
+    q.tasks.emplace_back(task_id);
+  }
+  ++num_ready_;
+  { const std::lock_guard<std::mutex> lock(mutex_); }
+  cv_.notify_all();
+}
+
+bool ThreadPool::pop_task(std::uint32_t worker_id, std::uint32_t &task_id) {
+  // Takes the newest task of the own queue.
+  {
+    Queue &q = queues_[worker_id];
+    const std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.tasks.empty()) {
+      task_id = q.tasks.back();
+      q.tasks.pop_back();
+      --num_ready_;
+      return true;
+    }
+  }
+
+  // Steals the oldest task of other queues.
+  for (std::uint32_t i = 1; i < num_threads_; ++i) {
+    Queue &q = queues_[(worker_id + i) % num_threads_];
+    const std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.tasks.empty()) {
+      task_id = q.tasks.front();
+      q.tasks.pop_front();
+      --num_ready_;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace primitiv
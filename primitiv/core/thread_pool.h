@@ -0,0 +1,145 @@
+#ifndef PRIMITIV_CORE_THREAD_POOL_H_
+#define PRIMITIV_CORE_THREAD_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <primitiv/core/mixins/nonmovable.h>
+
+namespace primitiv {
+
+/**
+ * Work-stealing thread pool which executes tasks with dependencies.
+ */
+class ThreadPool : mixins::Nonmovable<ThreadPool> {
+  /**
+   * Task queue owned by each worker.
+   */
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::uint32_t> tasks;
+  };
+
+  std::uint32_t num_threads_;
+  std::unique_ptr<Queue[]> queues_;
+  std::vector<std::thread> workers_;
+
+  // Held while a job is executed.
+  std::mutex run_mutex_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::uint64_t generation_;
+  std::uint32_t num_active_;
+  bool stop_;
+
+  // States of the current job.
+  const std::vector<std::vector<std::uint32_t>> *successors_;
+  const std::function<void(std::uint32_t)> *task_;
+  std::unique_ptr<std::atomic<std::uint32_t>[]> counters_;
+  std::atomic<std::uint32_t> remaining_;
+  std::atomic<std::int32_t> num_ready_;
+  std::atomic<bool> failed_;
+  std::exception_ptr error_;
+
+public:
+  /**
+   * Creates a new thread pool.
+   * @param num_threads Number of threads, including the thread calling
+   *                    `run()`.
+   * @throw primitiv::Error `num_threads` is 0.
+   */
+  explicit ThreadPool(std::uint32_t num_threads);
+
+  ~ThreadPool();
+
+  /**
+   * Returns the number of threads.
+   * @return Number of threads, including the thread calling `run()`.
+   */
+  std::uint32_t num_threads() const { return num_threads_; }
+
+  /**
+   * Executes tasks following given dependencies, and waits until all tasks
+   * are finished.
+   * @param successors List of tasks which depend on each task. The number of
+   *                   tasks is `successors.size()`, and the graph should be
+   *                   acyclic.
+   * @param task Function to execute a task, which takes the task ID.
+   * @throw Any exception thrown by `task`. Remaining tasks are not executed
+   *        after an exception is thrown.
+   * @remarks The calling thread also executes tasks. If multiple threads call
+   *          this function at the same time, jobs are executed one by one.
+   */
+  void run(
+      const std::vector<std::vector<std::uint32_t>> &successors,
+      const std::function<void(std::uint32_t)> &task);
+
+  /**
+   * Splits a range into contiguous chunks and executes them in parallel.
+   * @param size Size of the range [0, size).
+   * @param grain_size Minimum size of each chunk.
+   * @param fn Function to process a chunk, which takes the beginning and the
+   *           end of the chunk.
+   * @throw Any exception thrown by `fn`.
+   * @remarks Unlike `run()`, this function does not wait for other threads.
+   *          If the pool is already used by another job, or the range is not
+   *          larger than `grain_size`, `fn(0, size)` is called by the calling
+   *          thread.
+   */
+  void parallel_for(
+      std::size_t size, std::size_t grain_size,
+      const std::function<void(std::size_t, std::size_t)> &fn);
+
+private:
+  /**
+   * Executes tasks following given dependencies. `run_mutex_` should be
+   * held by the caller.
+   * @param successors List of tasks which depend on each task.
+   * @param task Function to execute a task, which takes the task ID.
+   */
+  void execute(
+      const std::vector<std::vector<std::uint32_t>> &successors,
+      const std::function<void(std::uint32_t)> &task);
+
+  /**
+   * Entry point of background threads.
+   * @param worker_id Worker ID.
+   */
+  void worker_main(std::uint32_t worker_id);
+
+  /**
+   * Executes tasks until the current job is finished.
+   * @param worker_id Worker ID.
+   */
+  void work(std::uint32_t worker_id);
+
+  /**
+   * Pushes a ready task into the queue of the worker.
+   * @param worker_id Worker ID.
+   * @param task_id Task ID.
+   */
+  void push_task(std::uint32_t worker_id, std::uint32_t task_id);
+
+  /**
+   * Obtains a ready task from the queue of the worker, or steals one from
+   * other workers.
+   * @param worker_id Worker ID.
+   * @param task_id Task ID obtained by this function.
+   * @return true if a task was obtained, false otherwise.
+   */
+  bool pop_task(std::uint32_t worker_id, std::uint32_t &task_id);
+};
+
+}  // namespace primitiv
+
+#endif  // PRIMITIV_CORE_THREAD_POOL_H_
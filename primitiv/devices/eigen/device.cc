@@ -0,0 +1,61 @@
+#include <primitiv/config.h>
+
+#include <primitiv/core/aligned_memory.h>
+#include <primitiv/core/error.h>
+#include <primitiv/devices/eigen/device.h>
+
+namespace {
+
+std::unique_ptr<primitiv::MemoryPool> create_memory_pool() {
+  return std::unique_ptr<primitiv::MemoryPool>(new primitiv::MemoryPool(
+      [](std::size_t size) -> void * {  // allocator
+        void *ptr = primitiv::aligned_memory::allocate(size);
+        if (!ptr) {
+          PRIMITIV_THROW_ERROR(
+              "Memory allocation failed. Requested size: " << size);
+        }
+        return ptr;
+      },
+      [](void *ptr) -> void {  // deleter
+        primitiv::aligned_memory::free(ptr);
+      }));
+}
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+Eigen::Eigen() : randomizer_(), pool_(::create_memory_pool()) {}
+
+Eigen::Eigen(std::uint32_t seed)
+: randomizer_(seed)
+, pool_(::create_memory_pool()) {}
+
+Eigen::Eigen(std::uint32_t seed, bool use_memory_pool)
+: randomizer_(seed)
+, pool_(use_memory_pool ? ::create_memory_pool() : nullptr) {}
+
+Eigen::Eigen(std::uint32_t seed, bool use_memory_pool, std::uint32_t num_threads)
+: randomizer_(seed)
+, pool_(use_memory_pool ? ::create_memory_pool() : nullptr)
+, thread_pool_() {
+  if (num_threads == 0) {
+    PRIMITIV_THROW_ERROR("Number of threads should be greater than 0.");
+  }
+  if (num_threads > 1) thread_pool_.reset(new ThreadPool(num_threads));
+}
+
+void Eigen::trim() {
+  if (pool_) pool_->release_reserved_blocks();
+}
+
+void Eigen::parallel_for(
+    std::size_t size, std::size_t grain_size,
+    const std::function<void(std::size_t, std::size_t)> &fn) {
+  if (thread_pool_) thread_pool_->parallel_for(size, grain_size, fn);
+  else fn(0, size);
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -0,0 +1,158 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace {
+
+// Number of queries processed at once.
+// Workspaces for scores are bounded by (number of keys) * BLOCK_SIZE.
+constexpr std::uint32_t BLOCK_SIZE = 64;
+
+constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Eigen::attention_fw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    float scale, Tensor &y, Tensor &lse) {
+  const std::uint32_t d = q.shape()[0];
+  const std::uint32_t m = q.shape()[1];
+  const std::uint32_t n = k.shape()[1];
+  const std::uint32_t e = v.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_q = q.shape().has_batch() * d * m;
+  const std::uint32_t skip_k = k.shape().has_batch() * d * n;
+  const std::uint32_t skip_v = v.shape().has_batch() * e * n;
+  const std::uint32_t skip_mask = mask ? mask->shape().has_batch() * n * m : 0;
+  const float *pq = CDATA(q);
+  const float *pk = CDATA(k);
+  const float *pv = CDATA(v);
+  const float *pmask = mask ? CDATA(*mask) : nullptr;
+  float *py = MDATA(y);
+  float *plse = MDATA(lse);
+
+  EMatrixXf s(n, std::min(m, BLOCK_SIZE));
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EMatrixXf> kk(pk, d, n);
+    const EMap<const EMatrixXf> vv(pv, e, n);
+    for (std::uint32_t j0 = 0; j0 < m; j0 += BLOCK_SIZE) {
+      const std::uint32_t bm = std::min(BLOCK_SIZE, m - j0);
+      auto sb = s.leftCols(bm);
+      sb.noalias() = scale * kk.transpose() * EMap<const EMatrixXf>(
+          pq + d * j0, d, bm);
+      if (pmask) sb += EMap<const EMatrixXf>(pmask + n * j0, n, bm);
+      for (std::uint32_t j = 0; j < bm; ++j) {
+        auto sj = sb.col(j).array();
+        const float max_s = sj.maxCoeff();
+        if (max_s == NEG_INF) {
+          // All keys are masked.
+          sj.setZero();
+          plse[j0 + j] = NEG_INF;
+          continue;
+        }
+        sj = (sj - max_s).exp();
+        const float z = sj.sum();
+        sj /= z;
+        plse[j0 + j] = max_s + std::log(z);
+      }
+      EMap<EMatrixXf>(py + e * j0, e, bm).noalias() = vv * sb;
+    }
+    pq += skip_q;
+    pk += skip_k;
+    pv += skip_v;
+    if (pmask) pmask += skip_mask;
+    py += e * m;
+    plse += m;
+  }
+}
+
+void Eigen::attention_bw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    const Tensor &y, const Tensor &lse,
+    const Tensor &gy, const Tensor &glse, float scale,
+    Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask) {
+  const std::uint32_t d = q.shape()[0];
+  const std::uint32_t m = q.shape()[1];
+  const std::uint32_t n = k.shape()[1];
+  const std::uint32_t e = v.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_q = q.shape().has_batch() * d * m;
+  const std::uint32_t skip_k = k.shape().has_batch() * d * n;
+  const std::uint32_t skip_v = v.shape().has_batch() * e * n;
+  const std::uint32_t skip_mask = mask ? mask->shape().has_batch() * n * m : 0;
+  const float *pq = CDATA(q);
+  const float *pk = CDATA(k);
+  const float *pv = CDATA(v);
+  const float *pmask = mask ? CDATA(*mask) : nullptr;
+  const float *py = CDATA(y);
+  const float *plse = CDATA(lse);
+  const float *pgy = CDATA(gy);
+  const float *pglse = CDATA(glse);
+  float *pgq = MDATA(gq);
+  float *pgk = MDATA(gk);
+  float *pgv = MDATA(gv);
+  float *pgmask = gmask ? MDATA(*gmask) : nullptr;
+
+  // `p` holds probabilities, and `gs` holds gradients of scores.
+  EMatrixXf p(n, std::min(m, BLOCK_SIZE));
+  EMatrixXf gs(n, std::min(m, BLOCK_SIZE));
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EMatrixXf> kk(pk, d, n);
+    const EMap<const EMatrixXf> vv(pv, e, n);
+    EMap<EMatrixXf> gkk(pgk, d, n);
+    EMap<EMatrixXf> gvv(pgv, e, n);
+    for (std::uint32_t j0 = 0; j0 < m; j0 += BLOCK_SIZE) {
+      const std::uint32_t bm = std::min(BLOCK_SIZE, m - j0);
+      const EMap<const EMatrixXf> qb(pq + d * j0, d, bm);
+      const EMap<const EMatrixXf> yb(py + e * j0, e, bm);
+      const EMap<const EMatrixXf> gyb(pgy + e * j0, e, bm);
+      auto pb = p.leftCols(bm);
+      auto gsb = gs.leftCols(bm);
+
+      // Recalculates probabilities from stored log-sum-exp values.
+      pb.noalias() = scale * kk.transpose() * qb;
+      if (pmask) pb += EMap<const EMatrixXf>(pmask + n * j0, n, bm);
+      for (std::uint32_t j = 0; j < bm; ++j) {
+        const float lse_j = plse[j0 + j];
+        if (lse_j == NEG_INF) pb.col(j).setZero();
+        else pb.col(j) = (pb.col(j).array() - lse_j).exp().matrix();
+      }
+
+      // gs = p * (v^T . gy - sum(gy * y) + glse)
+      gsb.noalias() = vv.transpose() * gyb;
+      for (std::uint32_t j = 0; j < bm; ++j) {
+        const float dj = gyb.col(j).dot(yb.col(j)) - pglse[j0 + j];
+        gsb.col(j) = (
+            pb.col(j).array() * (gsb.col(j).array() - dj)).matrix();
+      }
+
+      EMap<EMatrixXf>(pgq + d * j0, d, bm).noalias() += scale * kk * gsb;
+      gkk.noalias() += scale * qb * gsb.transpose();
+      gvv.noalias() += gyb * pb.transpose();
+      if (pgmask) EMap<EMatrixXf>(pgmask + n * j0, n, bm) += gsb;
+    }
+    pq += skip_q;
+    pk += skip_k;
+    pv += skip_v;
+    if (pmask) pmask += skip_mask;
+    py += e * m;
+    plse += m;
+    pgy += e * m;
+    pglse += m;
+    pgq += skip_q;
+    pgk += skip_k;
+    pgv += skip_v;
+    if (pgmask) pgmask += skip_mask;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -12,6 +12,9 @@
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Eigen>
 
+#include <cstddef>
+#include <cstdint>
+
 template<typename T>
 using EMap = ::Eigen::Map<T>;
 
@@ -26,28 +29,73 @@ using EMatrixXf = ::Eigen::MatrixXf;
 #define REPEAT_OP(i, n, op) \
   for (std::uint32_t i = 0; i < (n); ++i) { (op); }
 
+namespace primitiv {
+namespace devices {
+
+// Minimum number of elements processed by each thread. Operations on smaller
+// tensors are executed by the calling thread.
+constexpr std::size_t PARALLEL_GRAIN_SIZE = 1 << 16;
+
+// Splits [begin, end) of a batched tensor into parts belonging to each
+// minibatch, and calls `fn(batch, begin_in_batch, end_in_batch)` for each
+// part.
+template<typename Fn>
+inline void split_by_batch(
+    std::size_t begin, std::size_t end, std::uint32_t size, Fn fn) {
+  while (begin < end) {
+    const std::uint32_t batch = begin / size;
+    const std::size_t offset = static_cast<std::size_t>(batch) * size;
+    const std::size_t batch_end = end < offset + size ? end : offset + size;
+    fn(batch, begin - offset, batch_end - offset);
+    begin = batch_end;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
+
+// Following macros split large tensors into chunks and execute them by
+// multiple threads.
+
 #define EIGEN_DEV_FW_X(name, op) \
 void Eigen::name##_fw_impl(const Tensor &x_, Tensor &y_) { \
-  const std::size_t size = x_.shape().size(); \
-  EMap<const EArrayXf> x(CDATA(x_), size); \
-  EMap<EArrayXf>(MDATA(y_), size) = (op); \
+  const float *px = CDATA(x_); \
+  float *py = MDATA(y_); \
+  parallel_for( \
+      x_.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    EMap<const EArrayXf> x(px + begin, end - begin); \
+    EMap<EArrayXf>(py + begin, end - begin) = (op); \
+  }); \
 }
 
 #define EIGEN_DEV_BW_X(name, op) \
 void Eigen::name##_bw_impl( \
     const Tensor &x_, const Tensor &y_, const Tensor &gy_, Tensor &gx_) { \
-  const std::size_t size = x_.shape().size(); \
-  EMap<const EArrayXf> x(CDATA(x_), size); MAYBE_USED(x); \
-  EMap<const EArrayXf> y(CDATA(y_), size); MAYBE_USED(y); \
-  EMap<const EArrayXf> gy(CDATA(gy_), size); \
-  EMap<EArrayXf>(MDATA(gx_), size) += (op); \
+  const float *px = CDATA(x_); \
+  const float *py = CDATA(y_); \
+  const float *pgy = CDATA(gy_); \
+  float *pgx = MDATA(gx_); \
+  parallel_for( \
+      x_.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    EMap<const EArrayXf> x(px + begin, end - begin); MAYBE_USED(x); \
+    EMap<const EArrayXf> y(py + begin, end - begin); MAYBE_USED(y); \
+    EMap<const EArrayXf> gy(pgy + begin, end - begin); \
+    EMap<EArrayXf>(pgx + begin, end - begin) += (op); \
+  }); \
 }
 
 #define EIGEN_DEV_FW_X_CONST(name, op) \
 void Eigen::name##_fw_impl(const Tensor &x_, float k, Tensor &y_) { \
-  const std::size_t size = x_.shape().size(); \
-  EMap<const EArrayXf> x(CDATA(x_), size); \
-  EMap<EArrayXf>(MDATA(y_), size) = (op); \
+  const float *px = CDATA(x_); \
+  float *py = MDATA(y_); \
+  parallel_for( \
+      x_.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    EMap<const EArrayXf> x(px + begin, end - begin); \
+    EMap<EArrayXf>(py + begin, end - begin) = (op); \
+  }); \
 }
 
 #define EIGEN_DEV_BW_X_CONST(name, op) \
@@ -55,11 +103,18 @@ void Eigen::name##_bw_impl( \
     const Tensor &x_, const Tensor &y_, const Tensor &gy_, float k, \
     Tensor &gx_) { \
   MAYBE_USED(k); \
-  const std::size_t size = x_.shape().size(); \
-  EMap<const EArrayXf> x(CDATA(x_), size); MAYBE_USED(x); \
-  EMap<const EArrayXf> y(CDATA(y_), size); MAYBE_USED(y); \
-  EMap<const EArrayXf> gy(CDATA(gy_), size); \
-  EMap<EArrayXf>(MDATA(gx_), size) += (op); \
+  const float *px = CDATA(x_); \
+  const float *py = CDATA(y_); \
+  const float *pgy = CDATA(gy_); \
+  float *pgx = MDATA(gx_); \
+  parallel_for( \
+      x_.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    EMap<const EArrayXf> x(px + begin, end - begin); MAYBE_USED(x); \
+    EMap<const EArrayXf> y(py + begin, end - begin); MAYBE_USED(y); \
+    EMap<const EArrayXf> gy(pgy + begin, end - begin); \
+    EMap<EArrayXf>(pgx + begin, end - begin) += (op); \
+  }); \
 }
 
 #define EIGEN_DEV_FW_X_SCALAR(name, op) \
@@ -68,17 +123,22 @@ void Eigen::name##_fw_impl(const Tensor &x_, const Tensor &k_, Tensor &y_) { \
   const std::uint32_t bs = y_.shape().batch(); \
   const std::uint32_t skip_x = x_.shape().has_batch() * size; \
   const std::uint32_t skip_k = k_.shape().has_batch(); \
-  const float *src_x = CDATA(x_); \
-  const float *src_k = CDATA(k_); \
-  float *dest = MDATA(y_); \
-  for (std::uint32_t batch = 0; batch < bs; ++batch) { \
-    EMap<const EArrayXf> x(src_x, size); \
-    const float k = *src_k; \
-    EMap<EArrayXf>(dest, size) = (op); \
-    dest += size; \
-    src_x += skip_x; \
-    src_k += skip_k; \
-  } \
+  const float *px = CDATA(x_); \
+  const float *pk = CDATA(k_); \
+  float *py = MDATA(y_); \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      const std::size_t len = last - first; \
+      EMap<const EArrayXf> x( \
+          px + static_cast<std::size_t>(batch) * skip_x + first, len); \
+      const float k = pk[batch * skip_k]; \
+      EMap<EArrayXf>( \
+          py + static_cast<std::size_t>(batch) * size + first, len) = (op); \
+    }); \
+  }); \
 }
 
 #define EIGEN_DEV_FW_AB(name, op) \
@@ -87,17 +147,23 @@ void Eigen::name##_fw_impl(const Tensor &a_, const Tensor &b_, Tensor &y_) { \
   const std::uint32_t bs = y_.shape().batch(); \
   const std::uint32_t skip_a = a_.shape().has_batch() * size; \
   const std::uint32_t skip_b = b_.shape().has_batch() * size; \
-  const float *src_a = CDATA(a_); \
-  const float *src_b = CDATA(b_); \
-  float *dest = MDATA(y_); \
-  for (std::uint32_t batch = 0; batch < bs; ++batch) { \
-    EMap<const EArrayXf> a(src_a, size); \
-    EMap<const EArrayXf> b(src_b, size); \
-    EMap<EArrayXf>(dest, size) = (op); \
-    dest += size; \
-    src_a += skip_a; \
-    src_b += skip_b; \
-  } \
+  const float *pa = CDATA(a_); \
+  const float *pb = CDATA(b_); \
+  float *py = MDATA(y_); \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      const std::size_t len = last - first; \
+      EMap<const EArrayXf> a( \
+          pa + static_cast<std::size_t>(batch) * skip_a + first, len); \
+      EMap<const EArrayXf> b( \
+          pb + static_cast<std::size_t>(batch) * skip_b + first, len); \
+      EMap<EArrayXf>( \
+          py + static_cast<std::size_t>(batch) * size + first, len) = (op); \
+    }); \
+  }); \
 }
 
 #endif  // PRIMITIV_DEVICES_EIGEN_OPS_COMMON_H_
@@ -1,15 +1,279 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <primitiv/devices/eigen/device.h>
 #include <primitiv/devices/eigen/ops/common.h>
 
+namespace {
+
+// Maximum number of elements of the column matrix allocated by each thread.
+// Output positions are processed in chunks to keep the workspace within this
+// size.
+constexpr std::size_t MAX_WORKSPACE_SIZE = 1 << 20;
+
+// Minimum number of multiply-adds processed by each thread.
+constexpr std::size_t MIN_PARALLEL_COST = 1 << 18;
+
+// Calculates the number of chunks processed by each thread, where each chunk
+// requires `cost` multiply-adds.
+std::size_t parallel_grain_size(std::size_t cost) {
+  return std::max<std::size_t>(
+      1, MIN_PARALLEL_COST / std::max<std::size_t>(1, cost));
+}
+
+// Calculates the size of chunks not larger than `max_chunk_size`, which splits
+// `size` items into `min_num_chunks` or more chunks if possible.
+std::uint32_t make_chunk_size(
+    std::uint32_t size, std::size_t max_chunk_size,
+    std::uint32_t min_num_chunks) {
+  const std::uint32_t balanced = (size + min_num_chunks - 1) / min_num_chunks;
+  return std::max<std::size_t>(
+      1, std::min<std::size_t>(balanced, max_chunk_size));
+}
+
+// Geometry of the convolution.
+struct Conv2DParams {
+  std::uint32_t x_height, x_width, x_channels;
+  std::uint32_t w_height, w_width;
+  std::uint32_t y_height, y_width;
+  std::uint32_t padding0, padding1;
+  std::uint32_t stride0, stride1;
+  std::uint32_t dilation0, dilation1;
+};
+
+// Iterates over pairs of (column offset, input offset) of one row of the
+// column matrix.
+//
+// The column matrix has (number of output positions) rows and
+// (x_channels * w_width * w_height) columns. Its columns are ordered in the
+// same way as the memory of one output channel of the (flipped) filter, so
+// that the filter can be used as a matrix without any copy.
+// `fn(i, x_addr)` is called for each output position `p0 + i` inside the
+// input, and `fn_pad(i)` is called for each position in the padding area.
+template<typename Fn, typename FnPad>
+void scan_column(
+    const Conv2DParams &c,
+    std::uint32_t r, std::uint32_t p0, std::uint32_t len,
+    Fn fn, FnPad fn_pad) {
+  const std::uint32_t w_y_inv = r % c.w_height;
+  const std::uint32_t w_x_inv = (r / c.w_height) % c.w_width;
+  const std::uint32_t x_c = r / (c.w_height * c.w_width);
+  const std::int32_t w_y = c.w_height - 1 - w_y_inv;
+  const std::int32_t w_x = c.w_width - 1 - w_x_inv;
+  const std::int32_t x_h = c.x_height;
+  const std::int32_t x_w = c.x_width;
+
+  std::uint32_t y_y = p0 % c.y_height;
+  std::uint32_t y_x = p0 / c.y_height;
+  for (std::uint32_t i = 0; i < len; ++i) {
+    const std::int32_t x_y =
+      -static_cast<std::int32_t>(c.padding0) + y_y * c.stride0
+      + w_y * c.dilation0;
+    const std::int32_t x_x =
+      -static_cast<std::int32_t>(c.padding1) + y_x * c.stride1
+      + w_x * c.dilation1;
+    if (x_y >= 0 && x_y < x_h && x_x >= 0 && x_x < x_w) {
+      fn(i, (x_c * c.x_width + x_x) * c.x_height + x_y);
+    } else {
+      fn_pad(i);
+    }
+    if (++y_y == c.y_height) {
+      y_y = 0;
+      ++y_x;
+    }
+  }
+}
+
+// Copies rows [p0, p0 + len) of the column matrix of one sample.
+void im2col(
+    const Conv2DParams &c, const float *px,
+    std::uint32_t p0, std::uint32_t len, EMatrixXf &col) {
+  const std::uint32_t col_size = col.cols();
+  for (std::uint32_t r = 0; r < col_size; ++r) {
+    float *pcol = col.data() + static_cast<std::size_t>(r) * len;
+    ::scan_column(
+        c, r, p0, len,
+        [&](std::uint32_t i, std::uint32_t x_addr) { pcol[i] = px[x_addr]; },
+        [&](std::uint32_t i) { pcol[i] = 0; });
+  }
+}
+
+// Accumulates rows [p0, p0 + len) of the column matrix into one sample.
+void col2im(
+    const Conv2DParams &c, const EMatrixXf &col,
+    std::uint32_t p0, std::uint32_t len, float *px) {
+  const std::uint32_t col_size = col.cols();
+  for (std::uint32_t r = 0; r < col_size; ++r) {
+    const float *pcol = col.data() + static_cast<std::size_t>(r) * len;
+    ::scan_column(
+        c, r, p0, len,
+        [&](std::uint32_t i, std::uint32_t x_addr) { px[x_addr] += pcol[i]; },
+        [](std::uint32_t) {});
+  }
+}
+
+// Winograd F(2x2, 3x3) convolution for 3x3 filters with stride 1 and no
+// dilation.
+//
+// Each 2x2 tile of outputs is calculated from a 4x4 tile of inputs using 16
+// multiplications per channel pair instead of 36. Multiplications of all tiles
+// and channels are gathered into 16 GEMMs between transformed inputs
+// (tiles x input channels) and transformed filters
+// (input channels x output channels).
+// With few input channels, the transforms dominate and im2col is faster.
+constexpr std::uint32_t MIN_WINOGRAD_CHANNELS = 8;
+
+bool can_use_winograd(
+    const primitiv::Shape &w_shape,
+    std::uint32_t stride0, std::uint32_t stride1,
+    std::uint32_t dilation0, std::uint32_t dilation1) {
+  return w_shape[0] == 3 && w_shape[1] == 3
+    && w_shape[2] >= MIN_WINOGRAD_CHANNELS
+    && stride0 == 1 && stride1 == 1 && dilation0 == 1 && dilation1 == 1;
+}
+
+// Calculates G * g * G^T for each pair of channels.
+// The filter is flipped here because conv2d calculates true convolutions.
+void winograd_filter_transform(
+    const Conv2DParams &c, std::uint32_t y_channels,
+    const float *pw, EMatrixXf &u) {
+  u.resize(c.x_channels, 16 * y_channels);
+  for (std::uint32_t y_c = 0; y_c < y_channels; ++y_c) {
+    for (std::uint32_t x_c = 0; x_c < c.x_channels; ++x_c) {
+      const float *pwc = pw + (y_c * c.x_channels + x_c) * 9;
+      float g[3][3];
+      for (std::uint32_t i = 0; i < 3; ++i) {
+        for (std::uint32_t j = 0; j < 3; ++j) {
+          g[i][j] = pwc[(2 - j) * 3 + (2 - i)];
+        }
+      }
+      float t[4][3];
+      for (std::uint32_t j = 0; j < 3; ++j) {
+        t[0][j] = g[0][j];
+        t[1][j] = .5f * (g[0][j] + g[1][j] + g[2][j]);
+        t[2][j] = .5f * (g[0][j] - g[1][j] + g[2][j]);
+        t[3][j] = g[2][j];
+      }
+      for (std::uint32_t i = 0; i < 4; ++i) {
+        const float v[4] {
+          t[i][0],
+          .5f * (t[i][0] + t[i][1] + t[i][2]),
+          .5f * (t[i][0] - t[i][1] + t[i][2]),
+          t[i][2],
+        };
+        for (std::uint32_t j = 0; j < 4; ++j) {
+          u(x_c, (i * 4 + j) * y_channels + y_c) = v[j];
+        }
+      }
+    }
+  }
+}
+
+// Calculates B^T * d * B for tiles [t0, t0 + len) of one sample.
+void winograd_input_transform(
+    const Conv2DParams &c, std::uint32_t y_tiles, const float *px,
+    std::uint32_t t0, std::uint32_t len, EMatrixXf &v) {
+  const std::int32_t x_h = c.x_height;
+  const std::int32_t x_w = c.x_width;
+  for (std::uint32_t x_c = 0; x_c < c.x_channels; ++x_c) {
+    const float *pxc = px + static_cast<std::size_t>(x_c) * x_h * x_w;
+    for (std::uint32_t i = 0; i < len; ++i) {
+      const std::uint32_t t = t0 + i;
+      const std::int32_t y0 =
+        2 * static_cast<std::int32_t>(t % y_tiles)
+        - static_cast<std::int32_t>(c.padding0);
+      const std::int32_t x0 =
+        2 * static_cast<std::int32_t>(t / y_tiles)
+        - static_cast<std::int32_t>(c.padding1);
+      float d[4][4];
+      if (y0 >= 0 && y0 + 4 <= x_h && x0 >= 0 && x0 + 4 <= x_w) {
+        for (std::uint32_t b = 0; b < 4; ++b) {
+          const float *col = pxc + (x0 + b) * x_h + y0;
+          for (std::uint32_t a = 0; a < 4; ++a) d[a][b] = col[a];
+        }
+      } else {
+        for (std::int32_t b = 0; b < 4; ++b) {
+          const std::int32_t x_x = x0 + b;
+          for (std::int32_t a = 0; a < 4; ++a) {
+            const std::int32_t x_y = y0 + a;
+            d[a][b] = x_y >= 0 && x_y < x_h && x_x >= 0 && x_x < x_w
+              ? pxc[x_x * x_h + x_y] : 0;
+          }
+        }
+      }
+      float bd[4][4];
+      for (std::uint32_t b = 0; b < 4; ++b) {
+        bd[0][b] = d[0][b] - d[2][b];
+        bd[1][b] = d[1][b] + d[2][b];
+        bd[2][b] = d[2][b] - d[1][b];
+        bd[3][b] = d[1][b] - d[3][b];
+      }
+      for (std::uint32_t a = 0; a < 4; ++a) {
+        const std::uint32_t k = a * 4;
+        v(i, (k + 0) * c.x_channels + x_c) = bd[a][0] - bd[a][2];
+        v(i, (k + 1) * c.x_channels + x_c) = bd[a][1] + bd[a][2];
+        v(i, (k + 2) * c.x_channels + x_c) = bd[a][2] - bd[a][1];
+        v(i, (k + 3) * c.x_channels + x_c) = bd[a][1] - bd[a][3];
+      }
+    }
+  }
+}
+
+// Calculates A^T * m * A and writes outputs of tiles [t0, t0 + len).
+void winograd_output_transform(
+    const Conv2DParams &c, std::uint32_t y_channels, std::uint32_t y_tiles,
+    const EMatrixXf &m, std::uint32_t t0, std::uint32_t len, float *py) {
+  for (std::uint32_t y_c = 0; y_c < y_channels; ++y_c) {
+    float *pyc = py + static_cast<std::size_t>(y_c) * c.y_height * c.y_width;
+    for (std::uint32_t i = 0; i < len; ++i) {
+      const std::uint32_t t = t0 + i;
+      const std::uint32_t y0 = 2 * (t % y_tiles);
+      const std::uint32_t x0 = 2 * (t / y_tiles);
+      float s[2][4];
+      for (std::uint32_t b = 0; b < 4; ++b) {
+        const float m0 = m(i, (0 * 4 + b) * y_channels + y_c);
+        const float m1 = m(i, (1 * 4 + b) * y_channels + y_c);
+        const float m2 = m(i, (2 * 4 + b) * y_channels + y_c);
+        const float m3 = m(i, (3 * 4 + b) * y_channels + y_c);
+        s[0][b] = m0 + m1 + m2;
+        s[1][b] = m1 - m2 - m3;
+      }
+      for (std::uint32_t a = 0; a < 2 && y0 + a < c.y_height; ++a) {
+        pyc[x0 * c.y_height + y0 + a] = s[a][0] + s[a][1] + s[a][2];
+        if (x0 + 1 < c.y_width) {
+          pyc[(x0 + 1) * c.y_height + y0 + a] = s[a][1] - s[a][2] - s[a][3];
+        }
+      }
+    }
+  }
+}
+
+Conv2DParams make_params(
+    const primitiv::Shape &x_shape, const primitiv::Shape &w_shape,
+    const primitiv::Shape &y_shape,
+    std::uint32_t padding0, std::uint32_t padding1,
+    std::uint32_t stride0, std::uint32_t stride1,
+    std::uint32_t dilation0, std::uint32_t dilation1) {
+  return Conv2DParams {
+    x_shape[0], x_shape[1], x_shape[2],
+    w_shape[0], w_shape[1],
+    y_shape[0], y_shape[1],
+    padding0, padding1,
+    stride0, stride1,
+    dilation0, dilation1,
+  };
+}
+
+}  // namespace
+
 namespace primitiv {
 namespace devices {
 
-// TODO(odashi):
-// Implove implementation of conv2d.
-// These functions are identical with the Naive implementations and extremely
-// slow.
+// Convolutions are calculated by GEMMs between column matrices of inputs and
+// filters. Forward passes of 3x3 filters with stride 1 and no dilation use the
+// Winograd algorithm instead if the filter has enough input channels.
 
 void Eigen::conv2d_fw_impl(
     const Tensor &x, const Tensor &w,
@@ -20,65 +284,90 @@ void Eigen::conv2d_fw_impl(
   const Shape x_shape = x.shape();
   const Shape w_shape = w.shape();
   const Shape y_shape = y.shape();
+  const ::Conv2DParams c = ::make_params(
+      x_shape, w_shape, y_shape,
+      padding0, padding1, stride0, stride1, dilation0, dilation1);
 
-  const std::uint32_t x_height = x_shape[0];
-  const std::uint32_t x_width = x_shape[1];
-  const std::uint32_t x_channels = x_shape[2];
-  const std::uint32_t w_height = w_shape[0];
-  const std::uint32_t w_width = w_shape[1];
-  const std::uint32_t y_height = y_shape[0];
-  const std::uint32_t y_width = y_shape[1];
   const std::uint32_t y_channels = y_shape[2];
+  const std::uint32_t num_positions = c.y_height * c.y_width;
+  const std::uint32_t col_size = c.x_channels * c.w_width * c.w_height;
 
   const std::uint32_t batch_size = y_shape.batch();
-
   const std::size_t x_shift = x_shape.has_batch() * x_shape.volume();
   const std::size_t w_shift = w_shape.has_batch() * w_shape.volume();
   const std::size_t y_shift = y_shape.volume();
 
+  // Chunks of all samples are independent and distributed to threads.
+  // Small minibatches are split into more chunks to use all threads.
+  const std::uint32_t min_num_chunks =
+    (num_threads() + batch_size - 1) / batch_size;
+
   const float *px = CDATA(x);
   const float *pw = CDATA(w);
   float *py = MDATA(y);
 
-  for (std::uint32_t bn = 0; bn < batch_size; ++bn) {
-    for (std::uint32_t y_c = 0; y_c < y_channels; ++y_c) {
-      for (std::uint32_t y_x = 0; y_x < y_width; ++y_x) {
-        for (std::uint32_t y_y = 0; y_y < y_height; ++y_y) {
-          const std::uint32_t y_addr = (y_c * y_width + y_x) * y_height + y_y;
-          py[y_addr] = 0;
-
-          for (std::uint32_t x_c = 0; x_c < x_channels; ++x_c) {
-            for (
-                std::uint32_t w_x = 0, w_x_inv = w_width - 1;
-                w_x < w_width; ++w_x, --w_x_inv) {
-              for (
-                  std::uint32_t w_y = 0, w_y_inv = w_height - 1;
-                  w_y < w_height; ++w_y, --w_y_inv) {
-                const std::int32_t x_y
-                  = -padding0 + y_y * stride0 + w_y * dilation0;
-                const std::int32_t x_x
-                  = -padding1 + y_x * stride1 + w_x * dilation1;
-
-                if (x_y >= 0 && x_y < static_cast<std::int32_t>(x_height)
-                    && x_x >= 0 && x_x < static_cast<std::int32_t>(x_width)) {
-                  const std::uint32_t x_addr
-                    = (x_c * x_width + x_x) * x_height + x_y;
-                  const std::uint32_t w_addr
-                    = ((y_c * x_channels + x_c) * w_width + w_x_inv)
-                    * w_height + w_y_inv;
-                  py[y_addr] += px[x_addr] * pw[w_addr];
-                }
-              }
-            }
-          }
-        }
-      }
+  if (::can_use_winograd(w_shape, stride0, stride1, dilation0, dilation1)) {
+    const std::uint32_t y_tiles = (c.y_height + 1) / 2;
+    const std::uint32_t num_tiles = y_tiles * ((c.y_width + 1) / 2);
+    const std::uint32_t chunk_size = ::make_chunk_size(
+        num_tiles,
+        MAX_WORKSPACE_SIZE / (16 * std::max(c.x_channels, y_channels)),
+        min_num_chunks);
+    const std::uint32_t num_chunks = (num_tiles + chunk_size - 1) / chunk_size;
+
+    std::vector<EMatrixXf> us(w_shape.batch());
+    for (std::uint32_t bn = 0; bn < us.size(); ++bn) {
+      ::winograd_filter_transform(c, y_channels, pw + bn * w_shift, us[bn]);
     }
 
-    px += x_shift;
-    pw += w_shift;
-    py += y_shift;
+    parallel_for(
+        batch_size * num_chunks,
+        ::parallel_grain_size(
+          static_cast<std::size_t>(16) * chunk_size * c.x_channels
+          * y_channels),
+        [&](std::size_t begin, std::size_t end) {
+      EMatrixXf v(chunk_size, 16 * c.x_channels);
+      EMatrixXf m(chunk_size, 16 * y_channels);
+      for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t bn = i / num_chunks;
+        const std::uint32_t t0 = (i % num_chunks) * chunk_size;
+        const std::uint32_t len = std::min(chunk_size, num_tiles - t0);
+        const EMatrixXf &u = us[w_shift > 0 ? bn : 0];
+        ::winograd_input_transform(c, y_tiles, px + bn * x_shift, t0, len, v);
+        for (std::uint32_t k = 0; k < 16; ++k) {
+          m.block(0, k * y_channels, len, y_channels).noalias()
+            = v.block(0, k * c.x_channels, len, c.x_channels)
+            * u.middleCols(k * y_channels, y_channels);
+        }
+        ::winograd_output_transform(
+            c, y_channels, y_tiles, m, t0, len, py + bn * y_shift);
+      }
+    });
+    return;
   }
+
+  const std::uint32_t chunk_size = ::make_chunk_size(
+      num_positions, MAX_WORKSPACE_SIZE / col_size, min_num_chunks);
+  const std::uint32_t num_chunks =
+    (num_positions + chunk_size - 1) / chunk_size;
+
+  parallel_for(
+      batch_size * num_chunks,
+      ::parallel_grain_size(
+        static_cast<std::size_t>(chunk_size) * col_size * y_channels),
+      [&](std::size_t begin, std::size_t end) {
+    EMatrixXf col;
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::uint32_t bn = i / num_chunks;
+      const std::uint32_t p0 = (i % num_chunks) * chunk_size;
+      const std::uint32_t len = std::min(chunk_size, num_positions - p0);
+      const EMap<const EMatrixXf> ww(pw + bn * w_shift, col_size, y_channels);
+      EMap<EMatrixXf> yy(py + bn * y_shift, num_positions, y_channels);
+      col.resize(len, col_size);
+      ::im2col(c, px + bn * x_shift, p0, len, col);
+      yy.middleRows(p0, len).noalias() = col * ww;
+    }
+  });
 }
 
 void Eigen::conv2d_bw_impl(
@@ -90,18 +379,17 @@ void Eigen::conv2d_bw_impl(
   const Shape x_shape = x.shape();
   const Shape w_shape = w.shape();
   const Shape y_shape = gy.shape();
+  const ::Conv2DParams c = ::make_params(
+      x_shape, w_shape, y_shape,
+      padding0, padding1, stride0, stride1, dilation0, dilation1);
 
-  const std::uint32_t x_height = x_shape[0];
-  const std::uint32_t x_width = x_shape[1];
-  const std::uint32_t x_channels = x_shape[2];
-  const std::uint32_t w_height = w_shape[0];
-  const std::uint32_t w_width = w_shape[1];
-  const std::uint32_t y_height = y_shape[0];
-  const std::uint32_t y_width = y_shape[1];
   const std::uint32_t y_channels = y_shape[2];
+  const std::uint32_t num_positions = c.y_height * c.y_width;
+  const std::uint32_t col_size = c.x_channels * c.w_width * c.w_height;
+  const std::uint32_t chunk_size = std::max<std::size_t>(
+      1, std::min<std::size_t>(num_positions, MAX_WORKSPACE_SIZE / col_size));
 
   const std::uint32_t batch_size = y_shape.batch();
-
   const std::size_t x_shift = x_shape.has_batch() * x_shape.volume();
   const std::size_t w_shift = w_shape.has_batch() * w_shape.volume();
   const std::size_t y_shift = y_shape.volume();
@@ -112,41 +400,25 @@ void Eigen::conv2d_bw_impl(
   float *pgx = MDATA(gx);
   float *pgw = MDATA(gw);
 
+  EMatrixXf col;
   for (std::uint32_t bn = 0; bn < batch_size; ++bn) {
-    for (std::uint32_t y_c = 0; y_c < y_channels; ++y_c) {
-      for (std::uint32_t y_x = 0; y_x < y_width; ++y_x) {
-        for (std::uint32_t y_y = 0; y_y < y_height; ++y_y) {
-          const std::uint32_t y_addr = (y_c * y_width + y_x) * y_height + y_y;
-
-          for (std::uint32_t x_c = 0; x_c < x_channels; ++x_c) {
-            for (
-                std::uint32_t w_x = 0, w_x_inv = w_width - 1;
-                w_x < w_width; ++w_x, --w_x_inv) {
-              for (
-                  std::uint32_t w_y = 0, w_y_inv = w_height - 1;
-                  w_y < w_height; ++w_y, --w_y_inv) {
-                const std::int32_t x_y
-                  = -padding0 + y_y * stride0 + w_y * dilation0;
-                const std::int32_t x_x
-                  = -padding1 + y_x * stride1 + w_x * dilation1;
-
-                if (x_y >= 0 && x_y < static_cast<std::int32_t>(x_height)
-                    && x_x >= 0 && x_x < static_cast<std::int32_t>(x_width)) {
-                  const std::uint32_t x_addr
-                    = (x_c * x_width + x_x) * x_height + x_y;
-                  const std::uint32_t w_addr
-                    = ((y_c * x_channels + x_c) * w_width + w_x_inv)
-                    * w_height + w_y_inv;
-                  pgx[x_addr] += pgy[y_addr] * pw[w_addr];
-                  pgw[w_addr] += pgy[y_addr] * px[x_addr];
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+    const EMap<const EMatrixXf> ww(pw, col_size, y_channels);
+    const EMap<const EMatrixXf> gyy(pgy, num_positions, y_channels);
+    EMap<EMatrixXf> gww(pgw, col_size, y_channels);
+    for (std::uint32_t p0 = 0; p0 < num_positions; p0 += chunk_size) {
+      const std::uint32_t len = std::min(chunk_size, num_positions - p0);
+      const auto gyc = gyy.middleRows(p0, len);
+      col.resize(len, col_size);
 
+      // Gradient of the filter.
+      ::im2col(c, px, p0, len, col);
+      gww.noalias() += col.transpose() * gyc;
+
+      // Gradient of the input. The workspace is reused for the column
+      // matrix of the gradient.
+      col.noalias() = gyc * ww.transpose();
+      ::col2im(c, col, p0, len, pgx);
+    }
     px += x_shift;
     pw += w_shift;
     pgy += y_shift;
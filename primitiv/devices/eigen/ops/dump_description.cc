@@ -11,6 +11,7 @@ namespace devices {
 void Eigen::dump_description() const {
   std::cerr << "Device " << this << std::endl;
   std::cerr << "  Type: Eigen" << std::endl;
+  std::cerr << "  Threads: " << num_threads() << std::endl;
 }
 
 }  // namespace devices
@@ -0,0 +1,183 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace {
+
+using primitiv::ElementwiseProgram;
+using Opcode = ElementwiseProgram::Opcode;
+
+// Calculates each instruction by array expressions over the whole block.
+class EigenKernels : public ElementwiseProgram::Kernels {
+public:
+  void forward(
+      const ElementwiseProgram::Instruction &inst,
+      const float *a, const float *b, float *y,
+      std::uint32_t n) const override {
+    const float k = inst.k;
+    const EMap<const EArrayXf> x(a, n);
+    const EMap<const EArrayXf> xb(b, n);
+    EMap<EArrayXf> yy(y, n);
+#define FW(op, expr) case Opcode::op: yy = (expr); break;
+    switch (inst.opcode) {
+      FW(COPY, x)
+      FW(NEGATE, -x)
+      FW(ABS, x.abs())
+      FW(SQRT, x.sqrt())
+      FW(EXP, x.exp())
+      FW(LOG, x.log())
+      FW(TANH, x.tanh())
+      FW(SIGMOID, .5 + .5 * (.5 * x).tanh())
+      FW(SOFTPLUS, (x > 0.).select(
+            x + (1. + (-x).exp()).log(),
+            (1. + x.exp()).log()))
+      FW(SIN, x.sin())
+      FW(COS, x.cos())
+      FW(TAN, x.tan())
+      FW(PRELU, (x > 0.).select(x, k * x))
+      FW(ELU, (x > 0.).select(x, k * (x.exp() - 1.)))
+      FW(ADD_CONST, x + k)
+      FW(SUBTRACT_CONST_R, x - k)
+      FW(SUBTRACT_CONST_L, k - x)
+      FW(MULTIPLY_CONST, x * k)
+      FW(DIVIDE_CONST_R, x / k)
+      FW(DIVIDE_CONST_L, k / x)
+      FW(ADD, x + xb)
+      FW(SUBTRACT, x - xb)
+      FW(MULTIPLY, x * xb)
+      FW(DIVIDE, x / xb)
+    }
+#undef FW
+  }
+
+  void backward(
+      const ElementwiseProgram::Instruction &inst,
+      const float *a, const float *b, const float *y, const float *gy,
+      float *ga, float *gb, std::uint32_t n) const override {
+    const float k = inst.k;
+    const EMap<const EArrayXf> x(a, n);
+    const EMap<const EArrayXf> xb(b, n);
+    const EMap<const EArrayXf> yy(y, n);
+    const EMap<const EArrayXf> g(gy, n);
+    // `ga` and `gb` may point the same memory, and they are updated by
+    // separate statements.
+    EMap<EArrayXf> gx(ga, n);
+    EMap<EArrayXf> gxb(gb, n);
+#define BW(op, expr) case Opcode::op: gx += (expr); break;
+    switch (inst.opcode) {
+      BW(COPY, g)
+      BW(NEGATE, -g)
+      BW(ABS, x.sign() * g)
+      BW(SQRT, .5 * g / yy)
+      BW(EXP, g * yy)
+      BW(LOG, g / x)
+      BW(TANH, g * (1. - yy * yy))
+      BW(SIGMOID, g * yy * (1. - yy))
+      BW(SOFTPLUS, g * (.5 + .5 * (.5 * x).tanh()))
+      BW(SIN, g * x.cos())
+      BW(COS, -g * x.sin())
+      BW(TAN, g * (1. + yy * yy))
+      BW(PRELU, (x > 0.).select(g, k * g))
+      BW(ELU, (x > 0.).select(g, (yy + k) * g))
+      BW(ADD_CONST, g)
+      BW(SUBTRACT_CONST_R, g)
+      BW(SUBTRACT_CONST_L, -g)
+      BW(MULTIPLY_CONST, k * g)
+      BW(DIVIDE_CONST_R, g / k)
+      BW(DIVIDE_CONST_L, -g * yy / x)
+      case Opcode::ADD: gx += g; gxb += g; break;
+      case Opcode::SUBTRACT: gx += g; gxb -= g; break;
+      case Opcode::MULTIPLY: gx += g * xb; gxb += g * x; break;
+      case Opcode::DIVIDE: gx += g / xb; gxb -= (g / xb) * yy; break;
+    }
+#undef BW
+  }
+};
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Eigen::elementwise_fw_impl(
+    const ElementwiseProgram &program,
+    const std::vector<const Tensor *> &xs, Tensor &y) {
+  const std::uint32_t volume = y.shape().volume();
+  const std::uint32_t bs = y.shape().batch();
+  std::vector<const float *> px;
+  std::vector<std::uint32_t> skips;
+  px.reserve(xs.size());
+  skips.reserve(xs.size());
+  for (const Tensor *x : xs) {
+    px.emplace_back(CDATA(*x));
+    skips.emplace_back(x->shape().has_batch() * volume);
+  }
+  float *py = MDATA(y);
+  EigenKernels kernels;
+
+  // Each thread evaluates the program over a part of one minibatch.
+  parallel_for(
+      static_cast<std::size_t>(bs) * volume, PARALLEL_GRAIN_SIZE,
+      [&](std::size_t begin, std::size_t end) {
+    std::vector<const float *> px_part(px.size());
+    split_by_batch(begin, end, volume,
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) {
+      for (std::uint32_t i = 0; i < px.size(); ++i) {
+        px_part[i] = px[i] + static_cast<std::size_t>(batch) * skips[i] + first;
+      }
+      program.forward(
+          px_part, skips, last - first, 1,
+          py + static_cast<std::size_t>(batch) * volume + first, kernels);
+    });
+  });
+}
+
+void Eigen::elementwise_bw_impl(
+    const ElementwiseProgram &program,
+    const std::vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+    const std::vector<Tensor *> &gxs) {
+  const std::uint32_t volume = gy.shape().volume();
+  const std::uint32_t bs = gy.shape().batch();
+  std::vector<const float *> px;
+  std::vector<float *> pgx;
+  std::vector<std::uint32_t> skips;
+  px.reserve(xs.size());
+  pgx.reserve(xs.size());
+  skips.reserve(xs.size());
+  bool broadcasted = false;
+  for (std::uint32_t i = 0; i < xs.size(); ++i) {
+    px.emplace_back(CDATA(*xs[i]));
+    pgx.emplace_back(MDATA(*gxs[i]));
+    skips.emplace_back(xs[i]->shape().has_batch() * volume);
+    broadcasted = broadcasted || xs[i]->shape().batch() != bs;
+  }
+  const float *py = CDATA(y);
+  const float *pgy = CDATA(gy);
+  EigenKernels kernels;
+
+  if (broadcasted) {
+    // Gradients of broadcasted inputs are shared by all minibatches.
+    program.backward(px, skips, volume, bs, py, pgy, pgx, kernels);
+    return;
+  }
+
+  // Minibatches are treated as one large minibatch.
+  const std::vector<std::uint32_t> no_skips(xs.size(), 0);
+  parallel_for(
+      static_cast<std::size_t>(bs) * volume, PARALLEL_GRAIN_SIZE,
+      [&](std::size_t begin, std::size_t end) {
+    std::vector<const float *> px_part(px.size());
+    std::vector<float *> pgx_part(px.size());
+    for (std::uint32_t i = 0; i < px.size(); ++i) {
+      px_part[i] = px[i] + begin;
+      pgx_part[i] = pgx[i] + begin;
+    }
+    program.backward(
+        px_part, no_skips, end - begin, 1, py + begin, pgy + begin,
+        pgx_part, kernels);
+  });
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -0,0 +1,83 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+void Eigen::gru_cell_fw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y) {
+  const std::uint32_t n = h.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_ux = ux.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_uh = uh.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_h = h.shape().has_batch() * n;
+  const float *pux = CDATA(ux);
+  const float *puh = CDATA(uh);
+  const float *ph = CDATA(h);
+  float *py = MDATA(y);
+
+  EArrayXf s(2 * n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EArrayXf> vx(pux, 3 * n);
+    const EMap<const EArrayXf> vh(puh, 3 * n);
+    s = .5 + .5 * (.5 * (vx.head(2 * n) + vh.head(2 * n))).tanh();
+    const auto z = s.tail(n);
+    EMap<EArrayXf>(py, n) =
+      (1 - z) * (vx.tail(n) + s.head(n) * vh.tail(n)).tanh()
+      + z * EMap<const EArrayXf>(ph, n);
+    pux += skip_ux;
+    puh += skip_uh;
+    ph += skip_h;
+    py += n;
+  }
+}
+
+void Eigen::gru_cell_bw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+    Tensor &gux, Tensor &guh, Tensor &gh) {
+  const std::uint32_t n = h.shape()[0];
+  const std::uint32_t bs = gy.shape().batch();
+  const std::uint32_t skip_ux = ux.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_uh = uh.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_h = h.shape().has_batch() * n;
+  const float *pux = CDATA(ux);
+  const float *puh = CDATA(uh);
+  const float *ph = CDATA(h);
+  const float *pgy = CDATA(gy);
+  float *pgux = MDATA(gux);
+  float *pguh = MDATA(guh);
+  float *pgh = MDATA(gh);
+
+  EArrayXf s(2 * n);
+  EArrayXf j(n);
+  EArrayXf ga(3 * n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EArrayXf> vx(pux, 3 * n);
+    const EMap<const EArrayXf> vh(puh, 3 * n);
+    const EMap<const EArrayXf> g(pgy, n);
+    s = .5 + .5 * (.5 * (vx.head(2 * n) + vh.head(2 * n))).tanh();
+    const auto r = s.head(n);
+    const auto z = s.tail(n);
+    j = (vx.tail(n) + r * vh.tail(n)).tanh();
+    ga.tail(n) = g * (1 - z) * (1 - j.square());
+    ga.head(n) = ga.tail(n) * vh.tail(n) * r * (1 - r);
+    ga.segment(n, n) = g * (EMap<const EArrayXf>(ph, n) - j) * z * (1 - z);
+    EMap<EArrayXf>(pgux, 3 * n) += ga;
+    EMap<EArrayXf> gvh(pguh, 3 * n);
+    gvh.head(2 * n) += ga.head(2 * n);
+    gvh.tail(n) += ga.tail(n) * r;
+    EMap<EArrayXf>(pgh, n) += g * z;
+    pux += skip_ux;
+    puh += skip_uh;
+    ph += skip_h;
+    pgy += n;
+    pgux += skip_ux;
+    pguh += skip_uh;
+    pgh += skip_h;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
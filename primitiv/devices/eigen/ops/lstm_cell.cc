@@ -0,0 +1,96 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+void Eigen::lstm_cell_fw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c,
+    Tensor &h, Tensor &c_new) {
+  const std::uint32_t n = c.shape()[0];
+  const std::uint32_t bs = h.shape().batch();
+  const std::uint32_t skip_u = u.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_b = b.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_c = c.shape().has_batch() * n;
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  float *ph = MDATA(h);
+  float *pc_new = MDATA(c_new);
+
+  // Gate activations are stored in buffers allocated only once.
+  EArrayXf a(4 * n);
+  EArrayXf s(3 * n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    a = EMap<const EArrayXf>(pu, 4 * n) + EMap<const EArrayXf>(pb, 4 * n);
+    s = .5 + .5 * (.5 * a.head(3 * n)).tanh();
+    EMap<EArrayXf> cy(pc_new, n);
+    cy = s.segment(0, n) * a.tail(n).tanh()
+      + s.segment(n, n) * EMap<const EArrayXf>(pc, n);
+    EMap<EArrayXf>(ph, n) = s.segment(2 * n, n) * cy.tanh();
+    pu += skip_u;
+    pb += skip_b;
+    pc += skip_c;
+    ph += n;
+    pc_new += n;
+  }
+}
+
+void Eigen::lstm_cell_bw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+    const Tensor &gh, const Tensor &gc_new,
+    Tensor &gu, Tensor &gb, Tensor &gc) {
+  const std::uint32_t n = c.shape()[0];
+  const std::uint32_t bs = gh.shape().batch();
+  const std::uint32_t skip_u = u.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_b = b.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_c = c.shape().has_batch() * n;
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  const float *pc_new = CDATA(c_new);
+  const float *pgh = CDATA(gh);
+  const float *pgc_new = CDATA(gc_new);
+  float *pgu = MDATA(gu);
+  float *pgb = MDATA(gb);
+  float *pgc = MDATA(gc);
+
+  EArrayXf a(4 * n);
+  EArrayXf s(3 * n);
+  EArrayXf j(n);
+  EArrayXf t(n);
+  EArrayXf gcy(n);
+  EArrayXf ga(4 * n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    a = EMap<const EArrayXf>(pu, 4 * n) + EMap<const EArrayXf>(pb, 4 * n);
+    s = .5 + .5 * (.5 * a.head(3 * n)).tanh();
+    j = a.tail(n).tanh();
+    t = EMap<const EArrayXf>(pc_new, n).tanh();
+    const auto i = s.segment(0, n);
+    const auto f = s.segment(n, n);
+    const auto o = s.segment(2 * n, n);
+    const EMap<const EArrayXf> gy(pgh, n);
+    gcy = EMap<const EArrayXf>(pgc_new, n) + gy * o * (1 - t.square());
+    ga.segment(0, n) = gcy * j * i * (1 - i);
+    ga.segment(n, n) = gcy * EMap<const EArrayXf>(pc, n) * f * (1 - f);
+    ga.segment(2 * n, n) = gy * t * o * (1 - o);
+    ga.segment(3 * n, n) = gcy * i * (1 - j.square());
+    EMap<EArrayXf>(pgu, 4 * n) += ga;
+    EMap<EArrayXf>(pgb, 4 * n) += ga;
+    EMap<EArrayXf>(pgc, n) += gcy * f;
+    pu += skip_u;
+    pb += skip_b;
+    pc += skip_c;
+    pc_new += n;
+    pgh += n;
+    pgc_new += n;
+    pgu += skip_u;
+    pgb += skip_b;
+    pgc += skip_c;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -1,8 +1,25 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <primitiv/devices/eigen/device.h>
 #include <primitiv/devices/eigen/ops/common.h>
 
+namespace {
+
+// Minimum number of multiply-adds processed by each thread.
+constexpr std::size_t MATMUL_GRAIN_SIZE = 1 << 18;
+
+// Calculates the grain size in columns, where each column requires `cost`
+// multiply-adds.
+std::size_t matmul_grain_size(std::size_t cost) {
+  cost = std::max<std::size_t>(1, cost);
+  return std::max<std::size_t>(1, MATMUL_GRAIN_SIZE / cost);
+}
+
+}  // namespace
+
 namespace primitiv {
 namespace devices {
 
@@ -21,19 +38,46 @@ void Eigen::matmul_fw_impl(const Tensor &a, const Tensor &b, Tensor &y) {
     const std::uint32_t b_skip = b.shape().has_batch() * dj * dk;
     const std::uint32_t y_skip = di * dk;
     const std::uint32_t bs = a.shape().batch();
-    for (std::uint32_t n = 0; n < bs; ++n) {
-      EMap<const EMatrixXf> aa(src_a + n * a_skip, di, dj);
-      EMap<const EMatrixXf> bb(src_b + n * b_skip, dj, dk);
-      EMap<EMatrixXf> yy(dest + n * y_skip, di, dk);
-      yy.noalias() = aa * bb;
+    const std::size_t cost = static_cast<std::size_t>(di) * dj * dk;
+    if (cost < MATMUL_GRAIN_SIZE) {
+      // Small matrices: whole minibatches are distributed to threads so that
+      // each product is calculated by one GEMM call.
+      parallel_for(
+          bs, ::matmul_grain_size(cost),
+          [&](std::size_t begin, std::size_t end) {
+        for (std::size_t n = begin; n < end; ++n) {
+          EMap<const EMatrixXf> aa(src_a + n * a_skip, di, dj);
+          EMap<const EMatrixXf> bb(src_b + n * b_skip, dj, dk);
+          EMap<EMatrixXf>(dest + n * y_skip, di, dk).noalias() = aa * bb;
+        }
+      });
+      return;
     }
+    // Large matrices: columns of all results are distributed to threads.
+    parallel_for(
+        static_cast<std::size_t>(bs) * dk, ::matmul_grain_size(di * dj),
+        [&](std::size_t begin, std::size_t end) {
+      split_by_batch(begin, end, dk,
+          [&](std::uint32_t n, std::size_t first, std::size_t last) {
+        EMap<const EMatrixXf> aa(src_a + n * a_skip, di, dj);
+        EMap<const EMatrixXf> bb(src_b + n * b_skip, dj, dk);
+        EMap<EMatrixXf> yy(dest + n * y_skip, di, dk);
+        yy.middleCols(first, last - first).noalias()
+          = aa * bb.middleCols(first, last - first);
+      });
+    });
   } else {
     // Do multiplication only once using a combined matrix.
     const std::uint32_t dk_batch = dk * b.shape().batch();
     EMap<const EMatrixXf> aa(src_a, di, dj);
     EMap<const EMatrixXf> bb(src_b, dj, dk_batch);
     EMap<EMatrixXf> yy(dest, di, dk_batch);
-    yy.noalias() = aa * bb;
+    parallel_for(
+        dk_batch, ::matmul_grain_size(di * dj),
+        [&](std::size_t begin, std::size_t end) {
+      yy.middleCols(begin, end - begin).noalias()
+        = aa * bb.middleCols(begin, end - begin);
+    });
   }
 }
 
@@ -56,25 +100,71 @@ void Eigen::matmul_bw_impl(
     const std::uint32_t b_skip = b.shape().has_batch() * dj * dk;
     const std::uint32_t y_skip = di * dk;
     const std::uint32_t bs = a.shape().batch();
-    for (std::uint32_t n = 0; n < bs; ++n) {
+    const auto calculate = [&](std::uint32_t n, float *gb_n) {
       EMap<const EMatrixXf> aa(src_a + n * a_skip, di, dj);
       EMap<const EMatrixXf> bb(src_b + n * b_skip, dj, dk);
       EMap<const EMatrixXf> gyy(src_gy + n * y_skip, di, dk);
-      EMap<EMatrixXf> gaa(dest_ga + n * a_skip, di, dj);
-      EMap<EMatrixXf> gbb(dest_gb + n * b_skip, dj, dk);
-      gaa.noalias() += gyy * bb.transpose();
-      gbb.noalias() += aa.transpose() * gyy;
+      EMap<EMatrixXf>(dest_ga + n * a_skip, di, dj).noalias()
+        += gyy * bb.transpose();
+      EMap<EMatrixXf>(gb_n, dj, dk).noalias() += aa.transpose() * gyy;
+    };
+    const std::size_t cost = 2 * static_cast<std::size_t>(di) * dj * dk;
+    if (b.shape().has_batch()) {
+      parallel_for(
+          bs, ::matmul_grain_size(cost),
+          [&](std::size_t begin, std::size_t end) {
+        for (std::size_t n = begin; n < end; ++n) {
+          calculate(n, dest_gb + n * b_skip);
+        }
+      });
+      return;
+    }
+    // Gradients of a shared `b` are accumulated into a separate buffer for
+    // each chunk of minibatches, and reduced after all chunks to avoid races.
+    const std::size_t num_chunks = std::min<std::size_t>(
+        num_threads(), (bs * cost + MATMUL_GRAIN_SIZE - 1) / MATMUL_GRAIN_SIZE);
+    if (num_chunks <= 1) {
+      for (std::uint32_t n = 0; n < bs; ++n) calculate(n, dest_gb);
+      return;
+    }
+    const std::size_t gb_size = static_cast<std::size_t>(dj) * dk;
+    std::vector<float> partial_gb((num_chunks - 1) * gb_size, 0);
+    parallel_for(
+        num_chunks, 1,
+        [&](std::size_t begin, std::size_t end) {
+      for (std::size_t c = begin; c < end; ++c) {
+        float *gb_c = c ? &partial_gb[(c - 1) * gb_size] : dest_gb;
+        for (std::size_t n = c * bs / num_chunks;
+            n < (c + 1) * bs / num_chunks; ++n) {
+          calculate(n, gb_c);
+        }
+      }
+    });
+    EMap<EArrayXf> gbb(dest_gb, gb_size);
+    for (std::size_t c = 1; c < num_chunks; ++c) {
+      gbb += EMap<const EArrayXf>(&partial_gb[(c - 1) * gb_size], gb_size);
     }
   } else {
     // Do multiplication only once using a combined matrix.
+    // Columns of each gradient are distributed to threads.
     const std::uint32_t dk_batch = dk * b.shape().batch();
     EMap<const EMatrixXf> aa(src_a, di, dj);
     EMap<const EMatrixXf> bb(src_b, dj, dk_batch);
     EMap<const EMatrixXf> gyy(src_gy, di, dk_batch);
     EMap<EMatrixXf> gaa(dest_ga, di, dj);
     EMap<EMatrixXf> gbb(dest_gb, dj, dk_batch);
-    gaa.noalias() += gyy * bb.transpose();
-    gbb.noalias() += aa.transpose() * gyy;
+    parallel_for(
+        dj, ::matmul_grain_size(di * dk_batch),
+        [&](std::size_t begin, std::size_t end) {
+      gaa.middleCols(begin, end - begin).noalias()
+        += gyy * bb.middleRows(begin, end - begin).transpose();
+    });
+    parallel_for(
+        dk_batch, ::matmul_grain_size(di * dj),
+        [&](std::size_t begin, std::size_t end) {
+      gbb.middleCols(begin, end - begin).noalias()
+        += aa.transpose() * gyy.middleCols(begin, end - begin);
+    });
   }
 }
 
@@ -1,5 +1,7 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+
 #include <primitiv/devices/eigen/device.h>
 #include <primitiv/devices/eigen/ops/common.h>
 
@@ -15,17 +17,22 @@ void Eigen::max_fw_impl(const Tensor &x, std::uint32_t dim, Tensor &y) {
   const std::uint32_t skip2 = skip1 * n;
   const float *px = CDATA(x);
   float *py = MDATA(y);
-  for (std::uint32_t i = 0; i < repeat; ++i) {
-    std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
-    float tmp = px[offset];
-    for (std::uint32_t j = 0; j < n; ++j) {
-      if (px[offset] > tmp) {
-        tmp = px[offset];
+  // Each output requires `n` operations.
+  parallel_for(
+      repeat, std::max<std::size_t>(1, PARALLEL_GRAIN_SIZE / n),
+      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
+      float tmp = px[offset];
+      for (std::uint32_t j = 0; j < n; ++j) {
+        if (px[offset] > tmp) {
+          tmp = px[offset];
+        }
+        offset += skip1;
       }
-      offset += skip1;
+      py[i] = tmp;
     }
-    py[i] = tmp;
-  }
+  });
 }
 
 void Eigen::max_bw_impl(const Tensor &x, const Tensor &y, const Tensor &gy, std::uint32_t dim, Tensor &gx) {
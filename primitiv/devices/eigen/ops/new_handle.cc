@@ -1,7 +1,6 @@
 #include <primitiv/config.h>
 
-#include <cstdlib>
-
+#include <primitiv/core/aligned_memory.h>
 #include <primitiv/devices/eigen/device.h>
 #include <primitiv/devices/eigen/ops/common.h>
 
@@ -9,12 +8,13 @@ namespace primitiv {
 namespace devices {
 
 std::shared_ptr<void> Eigen::new_handle(const Shape &shape) {
-  const std::uint32_t mem_size = sizeof(float) * shape.size();
-  void *data = std::malloc(mem_size);
+  const std::size_t mem_size = sizeof(float) * shape.size();
+  if (pool_) return pool_->allocate(mem_size);
+  void *data = aligned_memory::allocate(mem_size);
   if (!data) {
     PRIMITIV_THROW_ERROR("Memory allocation failed. Requested size: " << mem_size);
   }
-  return std::shared_ptr<void>(data, std::free);
+  return std::shared_ptr<void>(data, aligned_memory::free);
 }
 
 }  // namespace devices
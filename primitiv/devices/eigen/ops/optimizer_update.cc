@@ -0,0 +1,135 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+namespace {
+
+// Each update is applied to small blocks so that the statistics written by
+// the first expression are still in the cache when the parameter is updated.
+constexpr std::uint32_t BLOCK_SIZE = 1024;
+
+template<typename Fn>
+void foreach_block(std::uint32_t size, Fn fn) {
+  for (std::uint32_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+    fn(begin, std::min(BLOCK_SIZE, size - begin));
+  }
+}
+
+}  // namespace
+
+void Eigen::sgd_update_impl(
+    const std::vector<const Tensor *> &gs, float eta,
+    const std::vector<Tensor *> &xs) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const std::uint32_t size = gs[i]->shape().size();
+    EMap<EArrayXf>(MDATA(*xs[i]), size)
+      -= eta * EMap<const EArrayXf>(CDATA(*gs[i]), size);
+  }
+}
+
+void Eigen::momentum_sgd_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float momentum,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    foreach_block(gs[i]->shape().size(), [&](
+          std::uint32_t begin, std::uint32_t n) {
+      const EMap<const EArrayXf> g(pg + begin, n);
+      EMap<EArrayXf> x(px + begin, n), m(pm + begin, n);
+      m = momentum * m - eta * g;
+      x += m;
+    });
+  }
+}
+
+void Eigen::adagrad_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float eps,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    foreach_block(gs[i]->shape().size(), [&](
+          std::uint32_t begin, std::uint32_t n) {
+      const EMap<const EArrayXf> g(pg + begin, n);
+      EMap<EArrayXf> x(px + begin, n), m(pm + begin, n);
+      m += g.square();
+      x -= eta * g / (m.sqrt() + eps);
+    });
+  }
+}
+
+void Eigen::rmsprop_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float alpha, float eps,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    foreach_block(gs[i]->shape().size(), [&](
+          std::uint32_t begin, std::uint32_t n) {
+      const EMap<const EArrayXf> g(pg + begin, n);
+      EMap<EArrayXf> x(px + begin, n), m(pm + begin, n);
+      m = alpha * m + (1 - alpha) * g.square();
+      x -= eta * g / (m.sqrt() + eps);
+    });
+  }
+}
+
+void Eigen::adadelta_update_impl(
+    const std::vector<const Tensor *> &gs, float scale, float rho, float eps,
+    const std::vector<Tensor *> &xs,
+    const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s) {
+  EArrayXf dx(BLOCK_SIZE);
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm1 = MDATA(*m1s[i]);
+    float *pm2 = MDATA(*m2s[i]);
+    foreach_block(gs[i]->shape().size(), [&](
+          std::uint32_t begin, std::uint32_t n) {
+      const EMap<const EArrayXf> g(pg + begin, n);
+      EMap<EArrayXf> x(px + begin, n), m1(pm1 + begin, n), m2(pm2 + begin, n);
+      auto d = dx.head(n);
+      m2 = rho * m2 + (1 - rho) * g.square();
+      d = ((m1 + eps) / (m2 + eps)).sqrt() * g;
+      m1 = rho * m1 + (1 - rho) * d.square();
+      x -= scale * d;
+    });
+  }
+}
+
+void Eigen::adam_update_impl(
+    const std::vector<const Tensor *> &gs,
+    float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+    const std::vector<Tensor *> &xs,
+    const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s) {
+  const float bias1 = 1 - std::pow(beta1, epoch);
+  const float bias2 = 1 - std::pow(beta2, epoch);
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm1 = MDATA(*m1s[i]);
+    float *pm2 = MDATA(*m2s[i]);
+    foreach_block(gs[i]->shape().size(), [&](
+          std::uint32_t begin, std::uint32_t n) {
+      const EMap<const EArrayXf> g(pg + begin, n);
+      EMap<EArrayXf> x(px + begin, n), m1(pm1 + begin, n), m2(pm2 + begin, n);
+      m1 = beta1 * m1 + (1 - beta1) * g;
+      m2 = beta2 * m2 + (1 - beta2) * g.square();
+      x -= alpha * (m1 / bias1) / ((m2 / bias2).sqrt() + eps);
+    });
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -0,0 +1,43 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+float Eigen::squared_norm_impl(const std::vector<const Tensor *> &xs) {
+  // Elements are divided into fixed-size blocks so that the result does not
+  // depend on the number of threads. Partial sums are calculated in double
+  // to keep the precision over many elements.
+  struct Block {
+    const float *src;
+    std::size_t size;
+  };
+  std::vector<Block> blocks;
+  for (const Tensor *x : xs) {
+    const float *src = CDATA(*x);
+    const std::size_t size = x->shape().size();
+    for (std::size_t i = 0; i < size; i += PARALLEL_GRAIN_SIZE) {
+      blocks.emplace_back(
+          Block {src + i, std::min(PARALLEL_GRAIN_SIZE, size - i)});
+    }
+  }
+  std::vector<double> partials(blocks.size());
+  parallel_for(
+      blocks.size(), 1, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      partials[i] = EMap<const EArrayXf>(blocks[i].src, blocks[i].size)
+        .cast<double>().square().sum();
+    }
+  });
+  double total = 0;
+  for (const double partial : partials) total += partial;
+  return total;
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -0,0 +1,113 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/eigen/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+void Eigen::sru_fw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b,
+    Tensor &h, Tensor &c) {
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const std::uint32_t bs = h.shape().batch();
+  const std::uint32_t skip_x = x.shape().has_batch() * n * len;
+  const std::uint32_t skip_u = u.shape().has_batch() * 3 * n * len;
+  const std::uint32_t skip_b = b.shape().has_batch() * 2 * n;
+  const float *px = CDATA(x);
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  float *ph = MDATA(h);
+  float *pc = MDATA(c);
+
+  // Each step is calculated over all units at once, and the sequence is
+  // scanned without any intermediate tensors.
+  EArrayXf s(2 * n);
+  const EArrayXf zeros = EArrayXf::Zero(n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EArrayXf> vb(pb, 2 * n);
+    for (std::uint32_t t = 0; t < len; ++t) {
+      const EMap<const EArrayXf> ut(pu + 3 * n * t, 3 * n);
+      s = .5 + .5 * (.5 * (ut.tail(2 * n) + vb)).tanh();
+      const auto f = s.head(n);
+      const auto r = s.tail(n);
+      const float *pc_prev = t > 0 ? pc + n * (t - 1) : zeros.data();
+      EMap<EArrayXf> ct(pc + n * t, n);
+      ct = f * EMap<const EArrayXf>(pc_prev, n) + (1 - f) * ut.head(n);
+      EMap<EArrayXf>(ph + n * t, n) =
+        r * ct.tanh() + (1 - r) * EMap<const EArrayXf>(px + n * t, n);
+    }
+    px += skip_x;
+    pu += skip_u;
+    pb += skip_b;
+    ph += n * len;
+    pc += n * len;
+  }
+}
+
+void Eigen::sru_bw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+    const Tensor &gh, const Tensor &gc,
+    Tensor &gx, Tensor &gu, Tensor &gb) {
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const std::uint32_t bs = gh.shape().batch();
+  const std::uint32_t skip_x = x.shape().has_batch() * n * len;
+  const std::uint32_t skip_u = u.shape().has_batch() * 3 * n * len;
+  const std::uint32_t skip_b = b.shape().has_batch() * 2 * n;
+  const float *px = CDATA(x);
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  const float *pgh = CDATA(gh);
+  const float *pgc = CDATA(gc);
+  float *pgx = MDATA(gx);
+  float *pgu = MDATA(gu);
+  float *pgb = MDATA(gb);
+
+  EArrayXf s(2 * n);
+  EArrayXf tc(n);
+  EArrayXf gcy(n);
+  EArrayXf ga(3 * n);
+  const EArrayXf zeros = EArrayXf::Zero(n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    const EMap<const EArrayXf> vb(pb, 2 * n);
+    EMap<EArrayXf> gvb(pgb, 2 * n);
+    // `gcy` holds the gradient of the cell state propagated from the next
+    // step.
+    gcy.setZero();
+    for (std::uint32_t t = len; t > 0; ) {
+      --t;
+      const EMap<const EArrayXf> ut(pu + 3 * n * t, 3 * n);
+      const EMap<const EArrayXf> g(pgh + n * t, n);
+      s = .5 + .5 * (.5 * (ut.tail(2 * n) + vb)).tanh();
+      const auto f = s.head(n);
+      const auto r = s.tail(n);
+      const float *pc_prev = t > 0 ? pc + n * (t - 1) : zeros.data();
+      tc = EMap<const EArrayXf>(pc + n * t, n).tanh();
+      gcy += EMap<const EArrayXf>(pgc + n * t, n) + g * r * (1 - tc.square());
+      ga.head(n) = gcy * (1 - f);
+      ga.segment(n, n) =
+        gcy * (EMap<const EArrayXf>(pc_prev, n) - ut.head(n)) * f * (1 - f);
+      ga.tail(n) =
+        g * (tc - EMap<const EArrayXf>(px + n * t, n)) * r * (1 - r);
+      EMap<EArrayXf>(pgx + n * t, n) += g * (1 - r);
+      EMap<EArrayXf>(pgu + 3 * n * t, 3 * n) += ga;
+      gvb += ga.tail(2 * n);
+      gcy *= f;
+    }
+    px += skip_x;
+    pu += skip_u;
+    pb += skip_b;
+    pc += n * len;
+    pgh += n * len;
+    pgc += n * len;
+    pgx += skip_x;
+    pgu += skip_u;
+    pgb += skip_b;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
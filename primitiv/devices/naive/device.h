@@ -1,8 +1,14 @@
 #ifndef PRIMITIV_DEVICES_NAIVE_DEVICE_H_
 #define PRIMITIV_DEVICES_NAIVE_DEVICE_H_
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 #include <primitiv/core/device.h>
+#include <primitiv/core/memory_pool.h>
 #include <primitiv/core/random.h>
+#include <primitiv/core/thread_pool.h>
 
 namespace primitiv {
 namespace devices {
@@ -14,24 +20,87 @@ class Naive : public Device {
 public:
   /**
    * Creates a Naive object.
+   * @remarks The device uses the internal memory pool.
+   */
+  Naive();
+
+  /**
+   * Creates a Naive object.
+   * @param seed The seed value of internal random number generator.
+   * @remarks The device uses the internal memory pool.
    */
-  Naive() = default;
+  explicit Naive(std::uint32_t seed);
 
   /**
    * Creates a Naive object.
    * @param seed The seed value of internal random number generator.
+   * @param use_memory_pool Whether or not to use the internal memory pool.
+   *        If `false`, every tensor is allocated/released directly through
+   *        the system allocator.
    */
-  explicit Naive(std::uint32_t seed) : randomizer_(seed) {}
+  Naive(std::uint32_t seed, bool use_memory_pool);
+
+  /**
+   * Creates a Naive object.
+   * @param seed The seed value of internal random number generator.
+   * @param use_memory_pool Whether or not to use the internal memory pool.
+   * @param num_threads Number of threads used to execute each operation.
+   *        Large operations are split into chunks and executed by an
+   *        internal thread pool. If `1`, all operations are executed by the
+   *        calling thread.
+   * @throw primitiv::Error `num_threads` is 0.
+   */
+  Naive(std::uint32_t seed, bool use_memory_pool, std::uint32_t num_threads);
 
   ~Naive() override = default;
 
   void dump_description() const override;
   DeviceType type() const override { return DeviceType::NAIVE; }
+  bool supports_memory_arena() const override { return true; }
+  bool supports_concurrent_execution() const override { return true; }
+  bool supports_elementwise_fusion() const override { return true; }
+  bool supports_tensor_views() const override { return true; }
+  bool supports_external_memory() const override { return true; }
+
+  /**
+   * Checks whether the device uses the internal memory pool or not.
+   * @return true if the memory pool is enabled, false otherwise.
+   */
+  bool uses_memory_pool() const { return !!pool_; }
+
+  /**
+   * Retrieves the number of threads used to execute each operation.
+   * @return Number of threads, including the calling thread.
+   */
+  std::uint32_t num_threads() const {
+    return thread_pool_ ? thread_pool_->num_threads() : 1;
+  }
+
+  /**
+   * Releases all memory blocks reserved by the internal memory pool.
+   * @remarks Memory blocks used by living tensors are not affected. This
+   *          function does nothing if the memory pool is disabled.
+   */
+  void trim();
 
 private:
+  /**
+   * Splits a range into chunks and processes them using the internal thread
+   * pool.
+   * @param size Size of the range [0, size).
+   * @param grain_size Minimum size of each chunk. Ranges not larger than this
+   *                   value are processed by the calling thread.
+   * @param fn Function to process a chunk, which takes the beginning and the
+   *           end of the chunk.
+   */
+  void parallel_for(
+      std::size_t size, std::size_t grain_size,
+      const std::function<void(std::size_t, std::size_t)> &fn);
+
   std::shared_ptr<void> new_handle(const Shape &shape) override;
 
   std::vector<float> tensor_to_vector_impl(const Tensor &x) override;
+  void tensor_to_array_impl(const Tensor &x, float values[]) override;
   std::vector<std::uint32_t> argmax_impl(const Tensor &x, std::uint32_t dim) override;
   std::vector<std::uint32_t> argmin_impl(const Tensor &x, std::uint32_t dim) override;
 
@@ -190,13 +259,93 @@ private:
       std::uint32_t stride0, std::uint32_t stride1,
       Tensor &gx) override;
 
+  void lstm_cell_fw_impl(
+      const Tensor &u, const Tensor &b, const Tensor &c,
+      Tensor &h, Tensor &c_new) override;
+
+  void lstm_cell_bw_impl(
+      const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+      const Tensor &gh, const Tensor &gc_new,
+      Tensor &gu, Tensor &gb, Tensor &gc) override;
+
+  void gru_cell_fw_impl(
+      const Tensor &ux, const Tensor &uh, const Tensor &h,
+      Tensor &y) override;
+
+  void gru_cell_bw_impl(
+      const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+      Tensor &gux, Tensor &guh, Tensor &gh) override;
+
+  void sru_fw_impl(
+      const Tensor &x, const Tensor &u, const Tensor &b,
+      Tensor &h, Tensor &c) override;
+
+  void sru_bw_impl(
+      const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+      const Tensor &gh, const Tensor &gc,
+      Tensor &gx, Tensor &gu, Tensor &gb) override;
+
+  void attention_fw_impl(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      float scale, Tensor &y, Tensor &lse) override;
+
+  void attention_bw_impl(
+      const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+      const Tensor &y, const Tensor &lse,
+      const Tensor &gy, const Tensor &glse, float scale,
+      Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask) override;
+
+  void elementwise_fw_impl(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs, Tensor &y) override;
+
+  void elementwise_bw_impl(
+      const ElementwiseProgram &program,
+      const std::vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+      const std::vector<Tensor *> &gxs) override;
+
+  float squared_norm_impl(const std::vector<const Tensor *> &xs) override;
+
+  void sgd_update_impl(
+      const std::vector<const Tensor *> &gs, float eta,
+      const std::vector<Tensor *> &xs) override;
+  void momentum_sgd_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float momentum,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &ms) override;
+  void adagrad_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float eps,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &ms) override;
+  void rmsprop_update_impl(
+      const std::vector<const Tensor *> &gs, float eta, float alpha, float eps,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &ms) override;
+  void adadelta_update_impl(
+      const std::vector<const Tensor *> &gs, float scale, float rho, float eps,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s,
+      const std::vector<Tensor *> &m2s) override;
+  void adam_update_impl(
+      const std::vector<const Tensor *> &gs,
+      float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+      const std::vector<Tensor *> &xs,
+      const std::vector<Tensor *> &m1s,
+      const std::vector<Tensor *> &m2s) override;
+
   void inplace_multiply_const_impl(float k, Tensor &x) override;
 
   void inplace_add_impl(const Tensor &x, Tensor &y) override;
   void inplace_subtract_impl(const Tensor &x, Tensor &y) override;
 
+  void pick_assign_impl(
+      const Tensor &x, const std::vector<std::uint32_t> &ids,
+      std::uint32_t dim, Tensor &y) override;
+
 private:
   DefaultRandomizer randomizer_;
+  std::unique_ptr<MemoryPool> pool_;
+  std::unique_ptr<ThreadPool> thread_pool_;
 };
 
 }  // namespace devices
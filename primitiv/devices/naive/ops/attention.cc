@@ -0,0 +1,165 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace {
+
+// Calculates scores of one query and returns their maximum.
+float calculate_scores(
+    const float *pq, const float *pk, const float *pmask,
+    std::uint32_t d, std::uint32_t n, float scale, float *ps) {
+  float max_s = -std::numeric_limits<float>::infinity();
+  for (std::uint32_t i = 0; i < n; ++i) {
+    const float *pki = pk + d * i;
+    float dot = 0;
+    for (std::uint32_t l = 0; l < d; ++l) dot += pki[l] * pq[l];
+    ps[i] = scale * dot + (pmask ? pmask[i] : 0);
+    max_s = std::max(max_s, ps[i]);
+  }
+  return max_s;
+}
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Naive::attention_fw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    float scale, Tensor &y, Tensor &lse) {
+  const std::uint32_t d = q.shape()[0];
+  const std::uint32_t m = q.shape()[1];
+  const std::uint32_t n = k.shape()[1];
+  const std::uint32_t e = v.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_q = q.shape().has_batch() * d * m;
+  const std::uint32_t skip_k = k.shape().has_batch() * d * n;
+  const std::uint32_t skip_v = v.shape().has_batch() * e * n;
+  const std::uint32_t skip_mask = mask ? mask->shape().has_batch() * n * m : 0;
+  const float *pq = CDATA(q);
+  const float *pk = CDATA(k);
+  const float *pv = CDATA(v);
+  const float *pmask = mask ? CDATA(*mask) : nullptr;
+  float *py = MDATA(y);
+  float *plse = MDATA(lse);
+
+  // Only scores of one query are kept at once.
+  std::vector<float> s(n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t j = 0; j < m; ++j) {
+      const float max_s = ::calculate_scores(
+          pq + d * j, pk, pmask ? pmask + n * j : nullptr, d, n, scale, &s[0]);
+      float *pyj = py + e * j;
+      std::fill(pyj, pyj + e, 0);
+      if (max_s == -std::numeric_limits<float>::infinity()) {
+        // All keys are masked.
+        plse[j] = max_s;
+        continue;
+      }
+      float z = 0;
+      for (std::uint32_t i = 0; i < n; ++i) {
+        s[i] = std::exp(s[i] - max_s);
+        z += s[i];
+      }
+      for (std::uint32_t i = 0; i < n; ++i) {
+        const float p = s[i] / z;
+        const float *pvi = pv + e * i;
+        for (std::uint32_t l = 0; l < e; ++l) pyj[l] += p * pvi[l];
+      }
+      plse[j] = max_s + std::log(z);
+    }
+    pq += skip_q;
+    pk += skip_k;
+    pv += skip_v;
+    if (pmask) pmask += skip_mask;
+    py += e * m;
+    plse += m;
+  }
+}
+
+void Naive::attention_bw_impl(
+    const Tensor &q, const Tensor &k, const Tensor &v, const Tensor *mask,
+    const Tensor &y, const Tensor &lse,
+    const Tensor &gy, const Tensor &glse, float scale,
+    Tensor &gq, Tensor &gk, Tensor &gv, Tensor *gmask) {
+  const std::uint32_t d = q.shape()[0];
+  const std::uint32_t m = q.shape()[1];
+  const std::uint32_t n = k.shape()[1];
+  const std::uint32_t e = v.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_q = q.shape().has_batch() * d * m;
+  const std::uint32_t skip_k = k.shape().has_batch() * d * n;
+  const std::uint32_t skip_v = v.shape().has_batch() * e * n;
+  const std::uint32_t skip_mask = mask ? mask->shape().has_batch() * n * m : 0;
+  const float *pq = CDATA(q);
+  const float *pk = CDATA(k);
+  const float *pv = CDATA(v);
+  const float *pmask = mask ? CDATA(*mask) : nullptr;
+  const float *py = CDATA(y);
+  const float *plse = CDATA(lse);
+  const float *pgy = CDATA(gy);
+  const float *pglse = CDATA(glse);
+  float *pgq = MDATA(gq);
+  float *pgk = MDATA(gk);
+  float *pgv = MDATA(gv);
+  float *pgmask = gmask ? MDATA(*gmask) : nullptr;
+
+  std::vector<float> s(n);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t j = 0; j < m; ++j) {
+      if (plse[j] == -std::numeric_limits<float>::infinity()) {
+        // All keys are masked and no gradient is propagated.
+        continue;
+      }
+      const float *pqj = pq + d * j;
+      const float *pgyj = pgy + e * j;
+      ::calculate_scores(
+          pqj, pk, pmask ? pmask + n * j : nullptr, d, n, scale, &s[0]);
+
+      // sum_i p_i * (v_i . gy) is equal to y . gy.
+      float dot_y = 0;
+      for (std::uint32_t l = 0; l < e; ++l) dot_y += py[e * j + l] * pgyj[l];
+
+      for (std::uint32_t i = 0; i < n; ++i) {
+        const float p = std::exp(s[i] - plse[j]);
+        const float *pvi = pv + e * i;
+        float *pgvi = pgv + e * i;
+        float gp = 0;
+        for (std::uint32_t l = 0; l < e; ++l) {
+          gp += pvi[l] * pgyj[l];
+          pgvi[l] += p * pgyj[l];
+        }
+        const float gs = p * (gp - dot_y + pglse[j]);
+        const float *pki = pk + d * i;
+        float *pgki = pgk + d * i;
+        float *pgqj = pgq + d * j;
+        for (std::uint32_t l = 0; l < d; ++l) {
+          pgqj[l] += scale * gs * pki[l];
+          pgki[l] += scale * gs * pqj[l];
+        }
+        if (pgmask) pgmask[n * j + i] += gs;
+      }
+    }
+    pq += skip_q;
+    pk += skip_k;
+    pv += skip_v;
+    if (pmask) pmask += skip_mask;
+    py += e * m;
+    plse += m;
+    pgy += e * m;
+    pglse += m;
+    pgq += skip_q;
+    pgk += skip_k;
+    pgv += skip_v;
+    if (pgmask) pgmask += skip_mask;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
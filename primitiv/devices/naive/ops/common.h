@@ -1,6 +1,36 @@
 #ifndef PRIMITIV_DEVICES_NAIVE_OPS_COMMON_H_
 #define PRIMITIV_DEVICES_NAIVE_OPS_COMMON_H_
 
+#include <cstddef>
+#include <cstdint>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+namespace primitiv {
+namespace devices {
+
+// Minimum number of elements processed by each thread. Operations on smaller
+// tensors are executed by the calling thread.
+constexpr std::size_t PARALLEL_GRAIN_SIZE = 1 << 16;
+
+// Splits [begin, end) of a batched tensor into parts belonging to each
+// minibatch, and calls `fn(batch, begin_in_batch, end_in_batch)` for each
+// part.
+template<typename Fn>
+inline void split_by_batch(
+    std::size_t begin, std::size_t end, std::uint32_t size, Fn fn) {
+  while (begin < end) {
+    const std::uint32_t batch = begin / size;
+    const std::size_t offset = static_cast<std::size_t>(batch) * size;
+    const std::size_t batch_end = end < offset + size ? end : offset + size;
+    fn(batch, begin - offset, batch_end - offset);
+    begin = batch_end;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
+
 #define MAYBE_USED(x) static_cast<void>(x)
 
 #define CDATA(x) static_cast<const float *>(get_handle(x))
@@ -9,12 +39,20 @@
 #define REPEAT_OP(i, n, op) \
   for (std::uint32_t i = 0; i < (n); ++i) { (op); }
 
+// Same as REPEAT_OP, but large loops are split into chunks and executed by
+// multiple threads. Can be used only in member functions of Naive.
+#define PARALLEL_REPEAT_OP(i, n, op) \
+  parallel_for((n), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin_, std::size_t end_) { \
+    for (std::size_t i = begin_; i < end_; ++i) { (op); } \
+  })
+
 #define CPUDEV_FW_X(name, op) \
 void Naive::name##_fw_impl(const Tensor &x, Tensor &y) { \
   float *dest = MDATA(y); \
   const float *src = CDATA(x); \
   const std::uint32_t size = x.shape().size(); \
-  REPEAT_OP(i, size, dest[i] = (op)); \
+  PARALLEL_REPEAT_OP(i, size, dest[i] = (op)); \
 }
 
 #define CPUDEV_BW_X(name, op) \
@@ -25,7 +63,7 @@ void Naive::name##_bw_impl( \
   const float *pgy = CDATA(gy); \
   float *pgx = MDATA(gx); \
   const std::uint32_t size = x.shape().size(); \
-  REPEAT_OP(i, size, pgx[i] += (op)); \
+  PARALLEL_REPEAT_OP(i, size, pgx[i] += (op)); \
 }
 
 #define CPUDEV_FW_X_CONST(name, op) \
@@ -33,7 +71,7 @@ void Naive::name##_fw_impl(const Tensor &x, float k, Tensor &y) { \
   float *dest = MDATA(y); \
   const float *src = CDATA(x); \
   const std::uint32_t size = x.shape().size(); \
-  REPEAT_OP(i, size, dest[i] = (op)); \
+  PARALLEL_REPEAT_OP(i, size, dest[i] = (op)); \
 }
 
 #define CPUDEV_BW_X_CONST(name, op) \
@@ -45,7 +83,7 @@ void Naive::name##_bw_impl( \
   const float *pgy = CDATA(gy); \
   float *pgx = MDATA(gx); \
   const std::uint32_t size = x.shape().size(); \
-  REPEAT_OP(i, size, pgx[i] += (op)); \
+  PARALLEL_REPEAT_OP(i, size, pgx[i] += (op)); \
 }
 
 #define CPUDEV_FW_X_SCALAR(name, op) \
@@ -54,15 +92,20 @@ void Naive::name##_fw_impl(const Tensor &x, const Tensor &k, Tensor &y) { \
   const std::uint32_t bs = y.shape().batch(); \
   const std::uint32_t skip_x = x.shape().has_batch() * size; \
   const std::uint32_t skip_k = k.shape().has_batch(); \
-  float *dest = MDATA(y); \
-  const float *src_x = CDATA(x); \
-  const float *src_k = CDATA(k); \
-  for (std::uint32_t batch = 0; batch < bs; ++batch) { \
-    REPEAT_OP(i, size, dest[i] = (op)); \
-    dest += size; \
-    src_x += skip_x; \
-    src_k += skip_k; \
-  } \
+  float *py = MDATA(y); \
+  const float *px = CDATA(x); \
+  const float *pk = CDATA(k); \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      float *dest = py + static_cast<std::size_t>(batch) * size; \
+      const float *src_x = px + static_cast<std::size_t>(batch) * skip_x; \
+      const float *src_k = pk + batch * skip_k; \
+      for (std::size_t i = first; i < last; ++i) { dest[i] = (op); } \
+    }); \
+  }); \
 }
 
 #define CPUDEV_FW_AB(name, op) \
@@ -71,14 +114,163 @@ void Naive::name##_fw_impl(const Tensor &a, const Tensor &b, Tensor &y) { \
   const std::uint32_t bs = y.shape().batch(); \
   const std::uint32_t skip_a = a.shape().has_batch() * size; \
   const std::uint32_t skip_b = b.shape().has_batch() * size; \
+  float *py = MDATA(y); \
+  const float *pa = CDATA(a); \
+  const float *pb = CDATA(b); \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      float *dest = py + static_cast<std::size_t>(batch) * size; \
+      const float *src_a = pa + static_cast<std::size_t>(batch) * skip_a; \
+      const float *src_b = pb + static_cast<std::size_t>(batch) * skip_b; \
+      for (std::size_t i = first; i < last; ++i) { dest[i] = (op); } \
+    }); \
+  }); \
+}
+
+// Variants of above macros which use vectorized kernels in simd.h.
+
+#define CPUDEV_FW_X_SIMD(name) \
+void Naive::name##_fw_impl(const Tensor &x, Tensor &y) { \
+  float *dest = MDATA(y); \
+  const float *src = CDATA(x); \
+  const auto fn = simd::kernels().name##_fw; \
+  parallel_for( \
+      x.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    fn(src + begin, dest + begin, end - begin); \
+  }); \
+}
+
+#define CPUDEV_BW_X_SIMD(name) \
+void Naive::name##_bw_impl( \
+    const Tensor &x, const Tensor &y, const Tensor &gy, Tensor &gx) { \
+  const float *px = CDATA(x); \
+  const float *py = CDATA(y); \
+  const float *pgy = CDATA(gy); \
+  float *pgx = MDATA(gx); \
+  const auto fn = simd::kernels().name##_bw; \
+  parallel_for( \
+      x.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    fn(px + begin, py + begin, pgy + begin, pgx + begin, end - begin); \
+  }); \
+}
+
+#define CPUDEV_FW_X_CONST_SIMD(name) \
+void Naive::name##_fw_impl(const Tensor &x, float k, Tensor &y) { \
   float *dest = MDATA(y); \
-  const float *src_a = CDATA(a); \
-  const float *src_b = CDATA(b); \
+  const float *src = CDATA(x); \
+  const auto fn = simd::kernels().name##_fw; \
+  parallel_for( \
+      x.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    fn(src + begin, k, dest + begin, end - begin); \
+  }); \
+}
+
+#define CPUDEV_BW_X_CONST_SIMD(name) \
+void Naive::name##_bw_impl( \
+    const Tensor &x, const Tensor &y, const Tensor &gy, float k, Tensor &gx) { \
+  const float *px = CDATA(x); \
+  const float *py = CDATA(y); \
+  const float *pgy = CDATA(gy); \
+  float *pgx = MDATA(gx); \
+  const auto fn = simd::kernels().name##_bw; \
+  parallel_for( \
+      x.shape().size(), PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    fn(px + begin, py + begin, pgy + begin, k, pgx + begin, end - begin); \
+  }); \
+}
+
+// `const_name` is the operation with a constant which calculates the same
+// function.
+#define CPUDEV_FW_X_SCALAR_SIMD(name, const_name) \
+void Naive::name##_fw_impl(const Tensor &x, const Tensor &k, Tensor &y) { \
+  const std::uint32_t size = y.shape().volume(); \
+  const std::uint32_t bs = y.shape().batch(); \
+  const std::uint32_t skip_x = x.shape().has_batch() * size; \
+  const std::uint32_t skip_k = k.shape().has_batch(); \
+  float *py = MDATA(y); \
+  const float *px = CDATA(x); \
+  const float *pk = CDATA(k); \
+  const auto fn = simd::kernels().const_name##_fw; \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      const std::size_t offset = static_cast<std::size_t>(batch) * size; \
+      fn( \
+          px + static_cast<std::size_t>(batch) * skip_x + first, \
+          pk[batch * skip_k], py + offset + first, last - first); \
+    }); \
+  }); \
+}
+
+#define CPUDEV_FW_AB_SIMD(name) \
+void Naive::name##_fw_impl(const Tensor &a, const Tensor &b, Tensor &y) { \
+  const std::uint32_t size = y.shape().volume(); \
+  const std::uint32_t bs = y.shape().batch(); \
+  const std::uint32_t skip_a = a.shape().has_batch() * size; \
+  const std::uint32_t skip_b = b.shape().has_batch() * size; \
+  float *py = MDATA(y); \
+  const float *pa = CDATA(a); \
+  const float *pb = CDATA(b); \
+  const auto fn = simd::kernels().name##_fw; \
+  parallel_for( \
+      static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+      [&](std::size_t begin, std::size_t end) { \
+    split_by_batch(begin, end, size, \
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) { \
+      fn( \
+          pa + static_cast<std::size_t>(batch) * skip_a + first, \
+          pb + static_cast<std::size_t>(batch) * skip_b + first, \
+          py + static_cast<std::size_t>(batch) * size + first, \
+          last - first); \
+    }); \
+  }); \
+}
+
+// Backward of binary operations. If ga or gb is shared by all minibatches,
+// the kernel is called for each minibatch serially to accumulate gradients
+// in the same memory. Otherwise, elements are split into chunks.
+#define CPUDEV_BW_AB_SIMD(name) \
+void Naive::name##_bw_impl( \
+    const Tensor &a, const Tensor &b, const Tensor &y, const Tensor &gy, \
+    Tensor &ga, Tensor &gb) { \
+  const std::uint32_t size = gy.shape().volume(); \
+  const std::uint32_t bs = gy.shape().batch(); \
+  const std::uint32_t skip_a = ga.shape().has_batch() * size; \
+  const std::uint32_t skip_b = gb.shape().has_batch() * size; \
+  const float *pa = CDATA(a); \
+  const float *pb = CDATA(b); \
+  const float *py = CDATA(y); \
+  const float *pgy = CDATA(gy); \
+  float *pga = MDATA(ga); \
+  float *pgb = MDATA(gb); \
+  const auto fn = simd::kernels().name##_bw; \
+  if (bs == 1 || (skip_a == size && skip_b == size)) { \
+    parallel_for( \
+        static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE, \
+        [&](std::size_t begin, std::size_t end) { \
+      fn( \
+          pa + begin, pb + begin, py + begin, pgy + begin, \
+          pga + begin, pgb + begin, end - begin); \
+    }); \
+    return; \
+  } \
   for (std::uint32_t batch = 0; batch < bs; ++batch) { \
-    REPEAT_OP(i, size, dest[i] = (op)); \
-    dest += size; \
-    src_a += skip_a; \
-    src_b += skip_b; \
+    fn(pa, pb, py, pgy, pga, pgb, size); \
+    pa += skip_a; \
+    pb += skip_b; \
+    py += size; \
+    pgy += size; \
+    pga += skip_a; \
+    pgb += skip_b; \
   } \
 }
 
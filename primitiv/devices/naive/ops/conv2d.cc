@@ -1,8 +1,81 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
+namespace {
+
+// Minimum number of multiply-adds processed by each thread.
+constexpr std::size_t MIN_PARALLEL_COST = 1 << 18;
+
+// Direct convolution of one pair of channels for 3x3 filters with stride 1
+// and no dilation.
+//
+// All 9 filter values are kept in registers, and each output is accumulated
+// from 3 input columns at once. Columns outside the input are replaced by
+// `zeros`, and bound checks are required only at the top and bottom rows.
+void conv2d_3x3_fw(
+    const float *px, const float *pw, const float *zeros,
+    std::uint32_t x_height, std::uint32_t x_width,
+    std::uint32_t y_height, std::uint32_t y_width,
+    std::uint32_t padding0, std::uint32_t padding1,
+    float *py) {
+  // k[i][j] is multiplied by the input at offset (i, j) from the top-left
+  // corner of the window, i.e., the filter is flipped.
+  float k[3][3];
+  for (std::uint32_t i = 0; i < 3; ++i) {
+    for (std::uint32_t j = 0; j < 3; ++j) {
+      k[i][j] = pw[(2 - j) * 3 + (2 - i)];
+    }
+  }
+
+  // Outputs in [y_begin, y_end) do not touch the vertical padding.
+  const std::uint32_t y_begin = std::min(padding0, y_height);
+  const std::uint32_t y_end = std::max(
+      y_begin, std::min(y_height, x_height + padding0 - 2));
+  const std::int32_t x_h = x_height;
+  const std::int32_t x_w = x_width;
+  const std::int32_t pad0 = padding0;
+  const std::int32_t pad1 = padding1;
+
+  for (std::uint32_t y_x = 0; y_x < y_width; ++y_x) {
+    const float *col[3];
+    for (std::uint32_t j = 0; j < 3; ++j) {
+      const std::int32_t x_x = static_cast<std::int32_t>(y_x + j) - pad1;
+      col[j] = x_x >= 0 && x_x < x_w ? px + x_x * x_height : zeros;
+    }
+    float *pyx = py + y_x * y_height;
+
+    const auto edge = [&](std::uint32_t y_y) {
+      float acc = 0;
+      for (std::uint32_t i = 0; i < 3; ++i) {
+        const std::int32_t x_y = static_cast<std::int32_t>(y_y + i) - pad0;
+        if (x_y < 0 || x_y >= x_h) continue;
+        for (std::uint32_t j = 0; j < 3; ++j) acc += k[i][j] * col[j][x_y];
+      }
+      pyx[y_y] += acc;
+    };
+
+    for (std::uint32_t y_y = 0; y_y < y_begin; ++y_y) edge(y_y);
+    for (std::uint32_t y_y = y_begin; y_y < y_end; ++y_y) {
+      const std::uint32_t x_y = y_y - padding0;
+      const float *c0 = col[0] + x_y;
+      const float *c1 = col[1] + x_y;
+      const float *c2 = col[2] + x_y;
+      pyx[y_y] +=
+        k[0][0] * c0[0] + k[0][1] * c1[0] + k[0][2] * c2[0] +
+        k[1][0] * c0[1] + k[1][1] * c1[1] + k[1][2] * c2[1] +
+        k[2][0] * c0[2] + k[2][1] * c1[2] + k[2][2] * c2[2];
+    }
+    for (std::uint32_t y_y = y_end; y_y < y_height; ++y_y) edge(y_y);
+  }
+}
+
+}  // namespace
+
 namespace primitiv {
 namespace devices {
 
@@ -35,12 +108,50 @@ void Naive::conv2d_fw_impl(
   const float *pw = CDATA(w);
   float *py = MDATA(y);
 
-  for (std::uint32_t bn = 0; bn < batch_size; ++bn) {
-    for (std::uint32_t y_c = 0; y_c < y_channels; ++y_c) {
+  // Output channels of all samples are distributed to threads.
+  const std::size_t y_size = y_height * y_width;
+  const std::size_t cost = y_size * x_channels * w_height * w_width;
+  const std::size_t grain_size = std::max<std::size_t>(
+      1, MIN_PARALLEL_COST / std::max<std::size_t>(1, cost));
+
+  if (w_height == 3 && w_width == 3
+      && stride0 == 1 && stride1 == 1 && dilation0 == 1 && dilation1 == 1) {
+    const std::vector<float> zeros(x_height, 0);
+    const std::uint32_t x_size = x_height * x_width;
+    parallel_for(
+        batch_size * y_channels, grain_size,
+        [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t bn = i / y_channels;
+        const std::uint32_t y_c = i % y_channels;
+        const float *pxb = px + bn * x_shift;
+        const float *pwb = pw + bn * w_shift;
+        float *pyc = py + bn * y_shift + y_c * y_size;
+        std::fill(pyc, pyc + y_size, 0);
+        for (std::uint32_t x_c = 0; x_c < x_channels; ++x_c) {
+          ::conv2d_3x3_fw(
+              pxb + x_c * x_size, pwb + (y_c * x_channels + x_c) * 9,
+              &zeros[0], x_height, x_width, y_height, y_width,
+              padding0, padding1, pyc);
+        }
+      }
+    });
+    return;
+  }
+
+  parallel_for(
+      batch_size * y_channels, grain_size,
+      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::uint32_t bn = i / y_channels;
+      const std::uint32_t y_c = i % y_channels;
+      const float *pxb = px + bn * x_shift;
+      const float *pwb = pw + bn * w_shift;
+      float *pyb = py + bn * y_shift;
       for (std::uint32_t y_x = 0; y_x < y_width; ++y_x) {
         for (std::uint32_t y_y = 0; y_y < y_height; ++y_y) {
           const std::uint32_t y_addr = (y_c * y_width + y_x) * y_height + y_y;
-          py[y_addr] = 0;
+          pyb[y_addr] = 0;
 
           for (std::uint32_t x_c = 0; x_c < x_channels; ++x_c) {
             for (
@@ -61,7 +172,7 @@ void Naive::conv2d_fw_impl(
                   const std::uint32_t w_addr
                     = ((y_c * x_channels + x_c) * w_width + w_x_inv)
                     * w_height + w_y_inv;
-                  py[y_addr] += px[x_addr] * pw[w_addr];
+                  pyb[y_addr] += pxb[x_addr] * pwb[w_addr];
                 }
               }
             }
@@ -69,11 +180,7 @@ void Naive::conv2d_fw_impl(
         }
       }
     }
-
-    px += x_shift;
-    pw += w_shift;
-    py += y_shift;
-  }
+  });
 }
 
 void Naive::conv2d_bw_impl(
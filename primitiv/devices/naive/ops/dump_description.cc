@@ -11,6 +11,8 @@ namespace devices {
 void Naive::dump_description() const {
   std::cerr << "Device " << this << std::endl;
   std::cerr << "  Type: Naive" << std::endl;
+  std::cerr << "  Threads: " << num_threads() << std::endl;
+  std::cerr << "  SIMD: " << simd::kernels().name << std::endl;
 }
 
 }  // namespace devices
@@ -0,0 +1,179 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace {
+
+using primitiv::ElementwiseProgram;
+using Opcode = ElementwiseProgram::Opcode;
+
+// Instructions calculated by the vectorized kernels. Others fall back to the
+// default loops.
+class SimdKernels : public ElementwiseProgram::Kernels {
+public:
+  SimdKernels() : ks_(primitiv::devices::simd::kernels()) {}
+
+  void forward(
+      const ElementwiseProgram::Instruction &inst,
+      const float *a, const float *b, float *y,
+      std::uint32_t n) const override {
+    const float k = inst.k;
+    switch (inst.opcode) {
+#define FW_X(op, fn) case Opcode::op: ks_.fn##_fw(a, y, n); return;
+#define FW_X_CONST(op, fn) case Opcode::op: ks_.fn##_fw(a, k, y, n); return;
+#define FW_AB(op, fn) case Opcode::op: ks_.fn##_fw(a, b, y, n); return;
+      FW_X(NEGATE, negate)
+      FW_X(ABS, abs)
+      FW_X(SQRT, sqrt)
+      FW_X(EXP, exp)
+      FW_X(LOG, log)
+      FW_X(TANH, tanh)
+      FW_X(SIGMOID, sigmoid)
+      FW_X(SOFTPLUS, softplus)
+      FW_X_CONST(PRELU, prelu)
+      FW_X_CONST(ELU, elu)
+      FW_X_CONST(ADD_CONST, add_const)
+      FW_X_CONST(SUBTRACT_CONST_R, subtract_const_r)
+      FW_X_CONST(SUBTRACT_CONST_L, subtract_const_l)
+      FW_X_CONST(MULTIPLY_CONST, multiply_const)
+      FW_X_CONST(DIVIDE_CONST_R, divide_const_r)
+      FW_X_CONST(DIVIDE_CONST_L, divide_const_l)
+      FW_AB(ADD, add)
+      FW_AB(SUBTRACT, subtract)
+      FW_AB(MULTIPLY, multiply)
+      FW_AB(DIVIDE, divide)
+#undef FW_X
+#undef FW_X_CONST
+#undef FW_AB
+      default: Kernels::forward(inst, a, b, y, n);
+    }
+  }
+
+  void backward(
+      const ElementwiseProgram::Instruction &inst,
+      const float *a, const float *b, const float *y, const float *gy,
+      float *ga, float *gb, std::uint32_t n) const override {
+    const float k = inst.k;
+    switch (inst.opcode) {
+#define BW_X(op, fn) case Opcode::op: ks_.fn##_bw(a, y, gy, ga, n); return;
+#define BW_X_CONST(op, fn) \
+  case Opcode::op: ks_.fn##_bw(a, y, gy, k, ga, n); return;
+#define BW_AB(op, fn) \
+  case Opcode::op: ks_.fn##_bw(a, b, y, gy, ga, gb, n); return;
+      BW_X(ABS, abs)
+      BW_X(SQRT, sqrt)
+      BW_X(EXP, exp)
+      BW_X(LOG, log)
+      BW_X(TANH, tanh)
+      BW_X(SIGMOID, sigmoid)
+      BW_X(SOFTPLUS, softplus)
+      BW_X_CONST(PRELU, prelu)
+      BW_X_CONST(ELU, elu)
+      BW_X_CONST(ADD_CONST, add_const)
+      BW_X_CONST(SUBTRACT_CONST_R, subtract_const_r)
+      BW_X_CONST(SUBTRACT_CONST_L, subtract_const_l)
+      BW_X_CONST(MULTIPLY_CONST, multiply_const)
+      BW_X_CONST(DIVIDE_CONST_R, divide_const_r)
+      BW_X_CONST(DIVIDE_CONST_L, divide_const_l)
+      BW_AB(ADD, add)
+      BW_AB(SUBTRACT, subtract)
+      BW_AB(MULTIPLY, multiply)
+      BW_AB(DIVIDE, divide)
+#undef BW_X
+#undef BW_X_CONST
+#undef BW_AB
+      default: Kernels::backward(inst, a, b, y, gy, ga, gb, n);
+    }
+  }
+
+private:
+  const primitiv::devices::simd::Kernels &ks_;
+};
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Naive::elementwise_fw_impl(
+    const ElementwiseProgram &program,
+    const std::vector<const Tensor *> &xs, Tensor &y) {
+  const std::uint32_t volume = y.shape().volume();
+  const std::uint32_t bs = y.shape().batch();
+  std::vector<const float *> px;
+  std::vector<std::uint32_t> skips;
+  px.reserve(xs.size());
+  skips.reserve(xs.size());
+  for (const Tensor *x : xs) {
+    px.emplace_back(CDATA(*x));
+    skips.emplace_back(x->shape().has_batch() * volume);
+  }
+  float *py = MDATA(y);
+  SimdKernels kernels;
+
+  // Each thread evaluates the program over a part of one minibatch.
+  parallel_for(
+      static_cast<std::size_t>(bs) * volume, PARALLEL_GRAIN_SIZE,
+      [&](std::size_t begin, std::size_t end) {
+    std::vector<const float *> px_part(px.size());
+    split_by_batch(begin, end, volume,
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) {
+      for (std::uint32_t i = 0; i < px.size(); ++i) {
+        px_part[i] = px[i] + static_cast<std::size_t>(batch) * skips[i] + first;
+      }
+      program.forward(
+          px_part, skips, last - first, 1,
+          py + static_cast<std::size_t>(batch) * volume + first, kernels);
+    });
+  });
+}
+
+void Naive::elementwise_bw_impl(
+    const ElementwiseProgram &program,
+    const std::vector<const Tensor *> &xs, const Tensor &y, const Tensor &gy,
+    const std::vector<Tensor *> &gxs) {
+  const std::uint32_t volume = gy.shape().volume();
+  const std::uint32_t bs = gy.shape().batch();
+  std::vector<const float *> px;
+  std::vector<float *> pgx;
+  std::vector<std::uint32_t> skips;
+  px.reserve(xs.size());
+  pgx.reserve(xs.size());
+  skips.reserve(xs.size());
+  bool broadcasted = false;
+  for (std::uint32_t i = 0; i < xs.size(); ++i) {
+    px.emplace_back(CDATA(*xs[i]));
+    pgx.emplace_back(MDATA(*gxs[i]));
+    skips.emplace_back(xs[i]->shape().has_batch() * volume);
+    broadcasted = broadcasted || xs[i]->shape().batch() != bs;
+  }
+  const float *py = CDATA(y);
+  const float *pgy = CDATA(gy);
+  SimdKernels kernels;
+
+  if (broadcasted) {
+    // Gradients of broadcasted inputs are shared by all minibatches.
+    program.backward(px, skips, volume, bs, py, pgy, pgx, kernels);
+    return;
+  }
+
+  // Minibatches are treated as one large minibatch.
+  const std::vector<std::uint32_t> no_skips(xs.size(), 0);
+  parallel_for(
+      static_cast<std::size_t>(bs) * volume, PARALLEL_GRAIN_SIZE,
+      [&](std::size_t begin, std::size_t end) {
+    std::vector<const float *> px_part(px.size());
+    std::vector<float *> pgx_part(px.size());
+    for (std::uint32_t i = 0; i < px.size(); ++i) {
+      px_part[i] = px[i] + begin;
+      pgx_part[i] = pgx[i] + begin;
+    }
+    program.backward(
+        px_part, no_skips, end - begin, 1, py + begin, pgy + begin,
+        pgx_part, kernels);
+  });
+}
+
+}  // namespace devices
+}  // namespace primitiv
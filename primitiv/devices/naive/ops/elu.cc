@@ -6,9 +6,8 @@
 namespace primitiv {
 namespace devices {
 
-CPUDEV_FW_X_CONST(
-    elu, src[i] * (src[i] > 0) + k * (std::exp(src[i] * (src[i] <= 0)) - 1));
-CPUDEV_BW_X_CONST(elu, pgy[i] * ((px[i] > 0) + (py[i] + k) * (px[i] <= 0)));
+CPUDEV_FW_X_CONST_SIMD(elu);
+CPUDEV_BW_X_CONST_SIMD(elu);
 
 }  // namespace devices
 }  // namespace primitiv
@@ -0,0 +1,86 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace {
+
+inline float sigmoid(float x) { return .5 + .5 * std::tanh(.5 * x); }
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Naive::gru_cell_fw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, Tensor &y) {
+  const std::uint32_t n = h.shape()[0];
+  const std::uint32_t bs = y.shape().batch();
+  const std::uint32_t skip_ux = ux.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_uh = uh.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_h = h.shape().has_batch() * n;
+  const float *pux = CDATA(ux);
+  const float *puh = CDATA(uh);
+  const float *ph = CDATA(h);
+  float *py = MDATA(y);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const float r = ::sigmoid(pux[k] + puh[k]);
+      const float z = ::sigmoid(pux[n + k] + puh[n + k]);
+      const float j = std::tanh(pux[2 * n + k] + r * puh[2 * n + k]);
+      py[k] = (1 - z) * j + z * ph[k];
+    }
+    pux += skip_ux;
+    puh += skip_uh;
+    ph += skip_h;
+    py += n;
+  }
+}
+
+void Naive::gru_cell_bw_impl(
+    const Tensor &ux, const Tensor &uh, const Tensor &h, const Tensor &gy,
+    Tensor &gux, Tensor &guh, Tensor &gh) {
+  const std::uint32_t n = h.shape()[0];
+  const std::uint32_t bs = gy.shape().batch();
+  const std::uint32_t skip_ux = ux.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_uh = uh.shape().has_batch() * 3 * n;
+  const std::uint32_t skip_h = h.shape().has_batch() * n;
+  const float *pux = CDATA(ux);
+  const float *puh = CDATA(uh);
+  const float *ph = CDATA(h);
+  const float *pgy = CDATA(gy);
+  float *pgux = MDATA(gux);
+  float *pguh = MDATA(guh);
+  float *pgh = MDATA(gh);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const float r = ::sigmoid(pux[k] + puh[k]);
+      const float z = ::sigmoid(pux[n + k] + puh[n + k]);
+      const float j = std::tanh(pux[2 * n + k] + r * puh[2 * n + k]);
+      const float gj = pgy[k] * (1 - z) * (1 - j * j);
+      const float gz = pgy[k] * (ph[k] - j) * z * (1 - z);
+      const float gr = gj * puh[2 * n + k] * r * (1 - r);
+      pgux[k] += gr;
+      pgux[n + k] += gz;
+      pgux[2 * n + k] += gj;
+      pguh[k] += gr;
+      pguh[n + k] += gz;
+      pguh[2 * n + k] += gj * r;
+      pgh[k] += pgy[k] * z;
+    }
+    pux += skip_ux;
+    puh += skip_uh;
+    ph += skip_h;
+    pgy += n;
+    pgux += skip_ux;
+    pguh += skip_uh;
+    pgh += skip_h;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -1,15 +1,13 @@
 #include <primitiv/config.h>
 
-#include <cmath>
-
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
 namespace primitiv {
 namespace devices {
 
-CPUDEV_FW_X(log, std::log(src[i]));
-CPUDEV_BW_X(log, pgy[i] / px[i]);
+CPUDEV_FW_X_SIMD(log);
+CPUDEV_BW_X_SIMD(log);
 
 }  // namespace devices
 }  // namespace primitiv
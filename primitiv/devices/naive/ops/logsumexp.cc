@@ -1,5 +1,6 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <primitiv/devices/naive/device.h>
@@ -15,19 +16,24 @@ void Naive::logsumexp_fw_impl(const Tensor &x, std::uint32_t dim, Tensor &y) {
   const std::uint32_t skip2 = skip1 * n;
   float *dest = MDATA(y);
   const float *src = CDATA(x);
-  for (std::uint32_t i = 0; i < repeat; ++i) {
-    // TODO(odashi): This calculation might generate large errors.
-    std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
-    float tmp = src[offset];
-    for (std::uint32_t j = 1; j < n; ++j) {
-      offset += skip1;
-      float arg = src[offset];
-      tmp = tmp > arg
-        ? tmp + std::log(1. + std::exp(arg - tmp))
-        : arg + std::log(1. + std::exp(tmp - arg));
+  // Each output requires `n` operations.
+  parallel_for(
+      repeat, std::max<std::size_t>(1, PARALLEL_GRAIN_SIZE / n),
+      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      // TODO(odashi): This calculation might generate large errors.
+      std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
+      float tmp = src[offset];
+      for (std::uint32_t j = 1; j < n; ++j) {
+        offset += skip1;
+        float arg = src[offset];
+        tmp = tmp > arg
+          ? tmp + std::log(1. + std::exp(arg - tmp))
+          : arg + std::log(1. + std::exp(tmp - arg));
+      }
+      dest[i] = tmp;
     }
-    dest[i] = tmp;
-  }
+  });
 }
 
 }  // namespace devices
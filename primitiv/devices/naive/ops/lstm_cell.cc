@@ -0,0 +1,103 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace {
+
+inline float sigmoid(float x) { return .5 + .5 * std::tanh(.5 * x); }
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Naive::lstm_cell_fw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c,
+    Tensor &h, Tensor &c_new) {
+  const std::uint32_t n = c.shape()[0];
+  const std::uint32_t bs = h.shape().batch();
+  const std::uint32_t skip_u = u.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_b = b.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_c = c.shape().has_batch() * n;
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  float *ph = MDATA(h);
+  float *pc_new = MDATA(c_new);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const float i = ::sigmoid(pu[k] + pb[k]);
+      const float f = ::sigmoid(pu[n + k] + pb[n + k]);
+      const float o = ::sigmoid(pu[2 * n + k] + pb[2 * n + k]);
+      const float j = std::tanh(pu[3 * n + k] + pb[3 * n + k]);
+      const float cy = i * j + f * pc[k];
+      pc_new[k] = cy;
+      ph[k] = o * std::tanh(cy);
+    }
+    pu += skip_u;
+    pb += skip_b;
+    pc += skip_c;
+    ph += n;
+    pc_new += n;
+  }
+}
+
+void Naive::lstm_cell_bw_impl(
+    const Tensor &u, const Tensor &b, const Tensor &c, const Tensor &c_new,
+    const Tensor &gh, const Tensor &gc_new,
+    Tensor &gu, Tensor &gb, Tensor &gc) {
+  const std::uint32_t n = c.shape()[0];
+  const std::uint32_t bs = gh.shape().batch();
+  const std::uint32_t skip_u = u.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_b = b.shape().has_batch() * 4 * n;
+  const std::uint32_t skip_c = c.shape().has_batch() * n;
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  const float *pc_new = CDATA(c_new);
+  const float *pgh = CDATA(gh);
+  const float *pgc_new = CDATA(gc_new);
+  float *pgu = MDATA(gu);
+  float *pgb = MDATA(gb);
+  float *pgc = MDATA(gc);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const float i = ::sigmoid(pu[k] + pb[k]);
+      const float f = ::sigmoid(pu[n + k] + pb[n + k]);
+      const float o = ::sigmoid(pu[2 * n + k] + pb[2 * n + k]);
+      const float j = std::tanh(pu[3 * n + k] + pb[3 * n + k]);
+      const float t = std::tanh(pc_new[k]);
+      const float gcy = pgc_new[k] + pgh[k] * o * (1 - t * t);
+      const float gi = gcy * j * i * (1 - i);
+      const float gf = gcy * pc[k] * f * (1 - f);
+      const float go = pgh[k] * t * o * (1 - o);
+      const float gj = gcy * i * (1 - j * j);
+      pgu[k] += gi;
+      pgu[n + k] += gf;
+      pgu[2 * n + k] += go;
+      pgu[3 * n + k] += gj;
+      pgb[k] += gi;
+      pgb[n + k] += gf;
+      pgb[2 * n + k] += go;
+      pgb[3 * n + k] += gj;
+      pgc[k] += gcy * f;
+    }
+    pu += skip_u;
+    pb += skip_b;
+    pc += skip_c;
+    pc_new += n;
+    pgh += n;
+    pgc_new += n;
+    pgu += skip_u;
+    pgb += skip_b;
+    pgc += skip_c;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -1,8 +1,17 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
+namespace {
+
+// Minimum number of multiply-adds processed by each thread.
+constexpr std::size_t MATMUL_GRAIN_SIZE = 1 << 18;
+
+}  // namespace
+
 namespace primitiv {
 namespace devices {
 
@@ -15,46 +24,125 @@ void Naive::matmul_fw_impl(const Tensor &a, const Tensor &b, Tensor &y) {
   const std::uint32_t src_a_shift = a.shape().has_batch() * d1 * d2;
   const std::uint32_t src_b_shift = b.shape().has_batch() * d2 * d3;
 
-  float *dest = MDATA(y);
-  const float *src_a = CDATA(a);
-  const float *src_b = CDATA(b);
-
-  for (std::uint32_t batch = 0; batch < bs; ++batch) {
-    for (std::uint32_t n = 0; n < dest_shift; ++n) {
-      dest[n] = 0;
-    }
-    for (std::uint32_t k = 0; k < d3; k += 8) {
-      const std::uint32_t ek = std::min(k + 8, d3);
-      for (std::uint32_t i = 0; i < d1; i += 8) {
-        const std::uint32_t ei = std::min(i + 8, d1);
-        for (std::uint32_t j = 0; j < d2; j += 8) {
-          const std::uint32_t ej = std::min(j + 8, d2);
-          for (std::uint32_t kk = k; kk < ek; ++kk) {
-            const std::uint32_t kk_d1 = kk * d1;
-            const std::uint32_t kk_d2 = kk * d2;
-            for (std::uint32_t ii = i; ii < ei; ++ii) {
-              float tmp = 0;
-              for (std::uint32_t jj = j; jj < ej; ++jj) {
-                tmp += src_a[ii + jj * d1] * src_b[jj + kk_d2];
+  float *py = MDATA(y);
+  const float *pa = CDATA(a);
+  const float *pb = CDATA(b);
+
+  // Columns of all results are distributed to threads, and each column
+  // requires d1 * d2 multiply-adds.
+  parallel_for(
+      static_cast<std::size_t>(bs) * d3,
+      std::max<std::size_t>(1, MATMUL_GRAIN_SIZE / std::max(1u, d1 * d2)),
+      [&](std::size_t begin, std::size_t end) {
+    split_by_batch(begin, end, d3,
+        [&](std::uint32_t batch, std::size_t first, std::size_t last) {
+      float *dest = py + batch * dest_shift;
+      const float *src_a = pa + batch * src_a_shift;
+      const float *src_b = pb + batch * src_b_shift;
+      std::fill(dest + first * d1, dest + last * d1, 0);
+      for (std::uint32_t k = first; k < last; k += 8) {
+        const std::uint32_t ek = std::min<std::uint32_t>(k + 8, last);
+        for (std::uint32_t i = 0; i < d1; i += 8) {
+          const std::uint32_t ei = std::min(i + 8, d1);
+          for (std::uint32_t j = 0; j < d2; j += 8) {
+            const std::uint32_t ej = std::min(j + 8, d2);
+            for (std::uint32_t kk = k; kk < ek; ++kk) {
+              const std::uint32_t kk_d1 = kk * d1;
+              const std::uint32_t kk_d2 = kk * d2;
+              for (std::uint32_t ii = i; ii < ei; ++ii) {
+                float tmp = 0;
+                for (std::uint32_t jj = j; jj < ej; ++jj) {
+                  tmp += src_a[ii + jj * d1] * src_b[jj + kk_d2];
+                }
+                dest[ii + kk_d1] += tmp;
               }
-              dest[ii + kk_d1] += tmp;
             }
           }
         }
       }
-    }
-    dest += dest_shift;
-    src_a += src_a_shift;
-    src_b += src_b_shift;
-  }
+    });
+  });
 }
 
 void Naive::matmul_bw_impl(
     const Tensor &a, const Tensor &b, const Tensor &, const Tensor &gy,
     Tensor &ga, Tensor &gb) {
-  // TODO(odashi): This code could be slow and requires memory. Fix this.
-  inplace_add_impl(matmul_fw(gy, transpose_fw(b)), ga);
-  inplace_add_impl(matmul_fw(transpose_fw(a), gy), gb);
+  // ga += gy . b^T and gb += a^T . gy are calculated directly without
+  // transposed copies.
+  const std::uint32_t d1 = a.shape()[0];
+  const std::uint32_t d2 = a.shape()[1];
+  const std::uint32_t d3 = b.shape()[1];
+  const std::uint32_t bs = gy.shape().batch();
+  const std::uint32_t gy_shift = d1 * d3;
+  const std::uint32_t a_bs = a.shape().batch();
+  const std::uint32_t b_bs = b.shape().batch();
+  const std::uint32_t a_shift = a.shape().has_batch() * d1 * d2;
+  const std::uint32_t b_shift = b.shape().has_batch() * d2 * d3;
+
+  const float *pa = CDATA(a);
+  const float *pb = CDATA(b);
+  const float *pgy = CDATA(gy);
+  float *pga = MDATA(ga);
+  float *pgb = MDATA(gb);
+
+  // Each column of ga is calculated by one thread. If ga has no minibatch,
+  // the column accumulates products of all minibatches.
+  parallel_for(
+      static_cast<std::size_t>(a_bs) * d2,
+      std::max<std::size_t>(
+        1, MATMUL_GRAIN_SIZE / std::max(1u, (bs / a_bs) * d1 * d3)),
+      [&](std::size_t begin, std::size_t end) {
+    split_by_batch(begin, end, d2,
+        [&](std::uint32_t a_batch, std::size_t first, std::size_t last) {
+      float *dest = pga + a_batch * a_shift;
+      const std::uint32_t batch_begin = a_shift ? a_batch : 0;
+      const std::uint32_t batch_end = a_shift ? a_batch + 1 : bs;
+      for (std::uint32_t batch = batch_begin; batch < batch_end; ++batch) {
+        const float *src_gy = pgy + batch * gy_shift;
+        const float *src_b = pb + batch * b_shift;
+        for (std::uint32_t j = first; j < last; ++j) {
+          float *dest_j = dest + j * d1;
+          for (std::uint32_t k = 0; k < d3; ++k) {
+            const float w = src_b[j + k * d2];
+            const float *src_gy_k = src_gy + k * d1;
+            for (std::uint32_t i = 0; i < d1; ++i) {
+              dest_j[i] += src_gy_k[i] * w;
+            }
+          }
+        }
+      }
+    });
+  });
+
+  // Same as above for each column of gb.
+  parallel_for(
+      static_cast<std::size_t>(b_bs) * d3,
+      std::max<std::size_t>(
+        1, MATMUL_GRAIN_SIZE / std::max(1u, (bs / b_bs) * d1 * d2)),
+      [&](std::size_t begin, std::size_t end) {
+    split_by_batch(begin, end, d3,
+        [&](std::uint32_t b_batch, std::size_t first, std::size_t last) {
+      float *dest = pgb + b_batch * b_shift;
+      const std::uint32_t batch_begin = b_shift ? b_batch : 0;
+      const std::uint32_t batch_end = b_shift ? b_batch + 1 : bs;
+      for (std::uint32_t batch = batch_begin; batch < batch_end; ++batch) {
+        const float *src_a = pa + batch * a_shift;
+        const float *src_gy = pgy + batch * gy_shift;
+        for (std::uint32_t k = first; k < last; ++k) {
+          const float *src_gy_k = src_gy + k * d1;
+          float *dest_k = dest + k * d2;
+          for (std::uint32_t j = 0; j < d2; ++j) {
+            const float *src_a_j = src_a + j * d1;
+            float tmp = 0;
+            for (std::uint32_t i = 0; i < d1; ++i) {
+              tmp += src_a_j[i] * src_gy_k[i];
+            }
+            dest_k[j] += tmp;
+          }
+        }
+      }
+    });
+  });
 }
 
 }  // namespace devices
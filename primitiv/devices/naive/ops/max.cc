@@ -1,5 +1,7 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
@@ -13,17 +15,22 @@ void Naive::max_fw_impl(const Tensor &x, std::uint32_t dim, Tensor &y) {
   const std::uint32_t skip2 = skip1 * n;
   const float *px = CDATA(x);
   float *py = MDATA(y);
-  for (std::uint32_t i = 0; i < repeat; ++i) {
-    std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
-    float tmp = px[offset];
-    for (std::uint32_t j = 0; j < n; ++j) {
-      if (px[offset] > tmp) {
-        tmp = px[offset];
+  // Each output requires `n` operations.
+  parallel_for(
+      repeat, std::max<std::size_t>(1, PARALLEL_GRAIN_SIZE / n),
+      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
+      float tmp = px[offset];
+      for (std::uint32_t j = 0; j < n; ++j) {
+        if (px[offset] > tmp) {
+          tmp = px[offset];
+        }
+        offset += skip1;
       }
-      offset += skip1;
+      py[i] = tmp;
     }
-    py[i] = tmp;
-  }
+  });
 }
 
 void Naive::max_bw_impl(const Tensor &x, const Tensor &y, const Tensor &gy, std::uint32_t dim, Tensor &gx) {
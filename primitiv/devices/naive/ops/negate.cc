@@ -6,7 +6,7 @@
 namespace primitiv {
 namespace devices {
 
-CPUDEV_FW_X(negate, -src[i]);
+CPUDEV_FW_X_SIMD(negate);
 
 }  // namespace devices
 }  // namespace primitiv
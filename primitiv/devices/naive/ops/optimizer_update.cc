@@ -0,0 +1,112 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+void Naive::sgd_update_impl(
+    const std::vector<const Tensor *> &gs, float eta,
+    const std::vector<Tensor *> &xs) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    REPEAT_OP(j, size, px[j] -= eta * pg[j]);
+  }
+}
+
+void Naive::momentum_sgd_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float momentum,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    for (std::uint32_t j = 0; j < size; ++j) {
+      pm[j] = momentum * pm[j] - eta * pg[j];
+      px[j] += pm[j];
+    }
+  }
+}
+
+void Naive::adagrad_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float eps,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    for (std::uint32_t j = 0; j < size; ++j) {
+      const float g = pg[j];
+      pm[j] += g * g;
+      px[j] -= eta * g / (std::sqrt(pm[j]) + eps);
+    }
+  }
+}
+
+void Naive::rmsprop_update_impl(
+    const std::vector<const Tensor *> &gs, float eta, float alpha, float eps,
+    const std::vector<Tensor *> &xs, const std::vector<Tensor *> &ms) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm = MDATA(*ms[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    for (std::uint32_t j = 0; j < size; ++j) {
+      const float g = pg[j];
+      pm[j] = alpha * pm[j] + (1 - alpha) * g * g;
+      px[j] -= eta * g / (std::sqrt(pm[j]) + eps);
+    }
+  }
+}
+
+void Naive::adadelta_update_impl(
+    const std::vector<const Tensor *> &gs, float scale, float rho, float eps,
+    const std::vector<Tensor *> &xs,
+    const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s) {
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm1 = MDATA(*m1s[i]);
+    float *pm2 = MDATA(*m2s[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    for (std::uint32_t j = 0; j < size; ++j) {
+      const float g = pg[j];
+      pm2[j] = rho * pm2[j] + (1 - rho) * g * g;
+      const float dx = std::sqrt((pm1[j] + eps) / (pm2[j] + eps)) * g;
+      pm1[j] = rho * pm1[j] + (1 - rho) * dx * dx;
+      px[j] -= scale * dx;
+    }
+  }
+}
+
+void Naive::adam_update_impl(
+    const std::vector<const Tensor *> &gs,
+    float alpha, float beta1, float beta2, float eps, std::uint32_t epoch,
+    const std::vector<Tensor *> &xs,
+    const std::vector<Tensor *> &m1s, const std::vector<Tensor *> &m2s) {
+  const float bias1 = 1 - std::pow(beta1, epoch);
+  const float bias2 = 1 - std::pow(beta2, epoch);
+  for (std::uint32_t i = 0; i < gs.size(); ++i) {
+    const float *pg = CDATA(*gs[i]);
+    float *px = MDATA(*xs[i]);
+    float *pm1 = MDATA(*m1s[i]);
+    float *pm2 = MDATA(*m2s[i]);
+    const std::uint32_t size = gs[i]->shape().size();
+    for (std::uint32_t j = 0; j < size; ++j) {
+      const float g = pg[j];
+      pm1[j] = beta1 * pm1[j] + (1 - beta1) * g;
+      pm2[j] = beta2 * pm2[j] + (1 - beta2) * g * g;
+      px[j] -= alpha * (pm1[j] / bias1) / (std::sqrt(pm2[j] / bias2) + eps);
+    }
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -1,5 +1,7 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
@@ -47,5 +49,25 @@ void Naive::pick_bw_impl(
   }
 }
 
+void Naive::pick_assign_impl(
+    const Tensor &x, const std::vector<std::uint32_t>& ids, std::uint32_t dim,
+    Tensor &y) {
+  const std::uint32_t bs = x.shape().batch();
+  const std::uint32_t skip_y = y.shape().has_batch() * y.shape().volume();
+  const std::uint32_t skip_i = ids.size() > 1;
+  const std::uint32_t base = x.shape().lower_volume(dim);
+  const std::uint32_t skip = base * y.shape()[dim];
+  const std::uint32_t repeat = x.shape().volume() / base;
+  const float *src = CDATA(x);
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    float *dest = MDATA(y) + batch * skip_y + base * ids[batch * skip_i];
+    for (std::uint32_t i = 0; i < repeat; ++i) {
+      std::copy(src, src + base, dest);
+      src += base;
+      dest += skip;
+    }
+  }
+}
+
 }  // namespace devices
 }  // namespace primitiv
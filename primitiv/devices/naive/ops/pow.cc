@@ -31,6 +31,19 @@ void Naive::pow_bw_impl(
   const float *pgy = CDATA(gy);
   float *pga = MDATA(ga);
   float *pgb = MDATA(gb);
+  if (bs == 1 || (skip_a == size && skip_b == size)) {
+    // No gradients are shared by minibatches.
+    parallel_for(
+        static_cast<std::size_t>(bs) * size, PARALLEL_GRAIN_SIZE,
+        [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        const float a = pgy[i] * py[i];
+        pga[i] += a * pb[i] / pa[i];
+        pgb[i] += a * std::log(pa[i]);
+      }
+    });
+    return;
+  }
   for (std::uint32_t batch = 0; batch < bs; ++batch) {
     for (std::uint32_t i = 0; i < size; ++i) {
       const float a = pgy[i] * py[i];
@@ -6,8 +6,8 @@
 namespace primitiv {
 namespace devices {
 
-CPUDEV_FW_X_CONST(prelu, src[i] * ((src[i] > 0) + k * (src[i] <= 0)));
-CPUDEV_BW_X_CONST(prelu, pgy[i] * ((px[i] > 0) + k * (px[i] <= 0)));
+CPUDEV_FW_X_CONST_SIMD(prelu);
+CPUDEV_BW_X_CONST_SIMD(prelu);
 
 }  // namespace devices
 }  // namespace primitiv
@@ -1,15 +1,13 @@
 #include <primitiv/config.h>
 
-#include <cmath>
-
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
 namespace primitiv {
 namespace devices {
 
-CPUDEV_FW_X(sigmoid, .5 + .5 * std::tanh(.5 * src[i]));
-CPUDEV_BW_X(sigmoid, py[i] * (1. - py[i]) * pgy[i]);
+CPUDEV_FW_X_SIMD(sigmoid);
+CPUDEV_BW_X_SIMD(sigmoid);
 
 }  // namespace devices
 }  // namespace primitiv
@@ -0,0 +1,208 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+#include <initializer_list>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+namespace {
+
+// Scalar kernels. These are also the references of vectorized kernels.
+
+#define SCALAR_FW_X(name, op) \
+void name##_fw(const float *px, float *py, std::size_t n) { \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float x = px[i]; \
+    py[i] = (op); \
+  } \
+}
+
+#define SCALAR_BW_X(name, op) \
+void name##_bw( \
+    const float *px, const float *py, const float *pgy, float *pgx, \
+    std::size_t n) { \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float x = px[i]; static_cast<void>(x); \
+    const float y = py[i]; static_cast<void>(y); \
+    const float gy = pgy[i]; \
+    pgx[i] += (op); \
+  } \
+}
+
+#define SCALAR_X_CONST(name, fw_op, bw_op) \
+void name##_fw(const float *px, float k, float *py, std::size_t n) { \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float x = px[i]; \
+    py[i] = (fw_op); \
+  } \
+} \
+void name##_bw( \
+    const float *px, const float *py, const float *pgy, float k, \
+    float *pgx, std::size_t n) { \
+  static_cast<void>(k); \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float x = px[i]; static_cast<void>(x); \
+    const float y = py[i]; static_cast<void>(y); \
+    const float gy = pgy[i]; \
+    pgx[i] += (bw_op); \
+  } \
+}
+
+#define SCALAR_AB(name, fw_op, ga_op, gb_op) \
+void name##_fw(const float *pa, const float *pb, float *py, std::size_t n) { \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float a = pa[i]; \
+    const float b = pb[i]; \
+    py[i] = (fw_op); \
+  } \
+} \
+void name##_bw( \
+    const float *pa, const float *pb, const float *py, const float *pgy, \
+    float *pga, float *pgb, std::size_t n) { \
+  for (std::size_t i = 0; i < n; ++i) { \
+    const float a = pa[i]; static_cast<void>(a); \
+    const float b = pb[i]; static_cast<void>(b); \
+    const float y = py[i]; static_cast<void>(y); \
+    const float gy = pgy[i]; \
+    pga[i] += (ga_op); \
+    pgb[i] += (gb_op); \
+  } \
+}
+
+SCALAR_FW_X(negate, -x);
+
+SCALAR_FW_X(abs, std::abs(x));
+SCALAR_BW_X(abs, ((x > 0) - (x < 0)) * gy);
+
+SCALAR_FW_X(sqrt, std::sqrt(x));
+SCALAR_BW_X(sqrt, .5 * gy / y);
+
+SCALAR_FW_X(exp, std::exp(x));
+SCALAR_BW_X(exp, y * gy);
+
+SCALAR_FW_X(log, std::log(x));
+SCALAR_BW_X(log, gy / x);
+
+SCALAR_FW_X(tanh, std::tanh(x));
+SCALAR_BW_X(tanh, (1. - y * y) * gy);
+
+SCALAR_FW_X(sigmoid, .5 + .5 * std::tanh(.5 * x));
+SCALAR_BW_X(sigmoid, y * (1. - y) * gy);
+
+SCALAR_FW_X(
+    softplus, x > 0
+      ? x + std::log(1 + std::exp(-x))
+      : std::log(1 + std::exp(x)));
+SCALAR_BW_X(softplus, (.5 + .5 * std::tanh(.5 * x)) * gy);
+
+SCALAR_X_CONST(add_const, x + k, gy);
+SCALAR_X_CONST(subtract_const_r, x - k, gy);
+SCALAR_X_CONST(subtract_const_l, k - x, -gy);
+SCALAR_X_CONST(multiply_const, x * k, k * gy);
+SCALAR_X_CONST(divide_const_r, x / k, gy / k);
+SCALAR_X_CONST(divide_const_l, k / x, -y * gy / x);
+SCALAR_X_CONST(
+    prelu, x * ((x > 0) + k * (x <= 0)), gy * ((x > 0) + k * (x <= 0)));
+SCALAR_X_CONST(
+    elu, x * (x > 0) + k * (std::exp(x * (x <= 0)) - 1),
+    gy * ((x > 0) + (y + k) * (x <= 0)));
+
+SCALAR_AB(add, a + b, gy, gy);
+SCALAR_AB(subtract, a - b, gy, -gy);
+SCALAR_AB(multiply, a * b, gy * b, gy * a);
+SCALAR_AB(divide, a / b, gy / b, -gy / b * y);
+
+#undef SCALAR_FW_X
+#undef SCALAR_BW_X
+#undef SCALAR_X_CONST
+#undef SCALAR_AB
+
+primitiv::devices::simd::Kernels make_scalar_kernels() {
+  primitiv::devices::simd::Kernels ks;
+  ks.isa = primitiv::devices::simd::InstructionSet::SCALAR;
+  ks.name = "Scalar";
+#define SET_FW_X(name) ks.name##_fw = ::name##_fw;
+#define SET_BW_X(name) ks.name##_bw = ::name##_bw;
+#define SET_FW_BW(name) SET_FW_X(name) SET_BW_X(name)
+  PRIMITIV_NAIVE_SIMD_FW_X_OPS(SET_FW_X)
+  PRIMITIV_NAIVE_SIMD_BW_X_OPS(SET_BW_X)
+  PRIMITIV_NAIVE_SIMD_X_CONST_OPS(SET_FW_BW)
+  PRIMITIV_NAIVE_SIMD_AB_OPS(SET_FW_BW)
+#undef SET_FW_X
+#undef SET_BW_X
+#undef SET_FW_BW
+  return ks;
+}
+
+// Checks whether the running CPU supports the instruction set.
+bool cpu_supports(primitiv::devices::simd::InstructionSet isa) {
+  using primitiv::devices::simd::InstructionSet;
+  switch (isa) {
+    case InstructionSet::SCALAR:
+      return true;
+    case InstructionSet::NEON:
+      // NEON is mandatory on AArch64.
+#if defined(__aarch64__)
+      return true;
+#else
+      return false;
+#endif
+    case InstructionSet::AVX2:
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+      return false;
+#endif
+    case InstructionSet::AVX512:
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+      return __builtin_cpu_supports("avx512f");
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_scalar_kernels() {
+  static const Kernels ks = ::make_scalar_kernels();
+  return &ks;
+}
+
+const Kernels *get_kernels(InstructionSet isa) {
+  if (!::cpu_supports(isa)) return nullptr;
+  switch (isa) {
+    case InstructionSet::SCALAR: return get_scalar_kernels();
+    case InstructionSet::NEON: return get_neon_kernels();
+    case InstructionSet::AVX2: return get_avx2_kernels();
+    case InstructionSet::AVX512: return get_avx512_kernels();
+  }
+  return nullptr;
+}
+
+const Kernels &kernels() {
+  static const Kernels &ks = [] () -> const Kernels & {
+    // Instruction sets are tried in the descending order of their widths.
+    for (const InstructionSet isa : {
+        InstructionSet::AVX512,
+        InstructionSet::AVX2,
+        InstructionSet::NEON,
+    }) {
+      const Kernels *ks = get_kernels(isa);
+      if (ks) return *ks;
+    }
+    return *get_scalar_kernels();
+  }();
+  return ks;
+}
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
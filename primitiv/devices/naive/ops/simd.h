@@ -0,0 +1,102 @@
+#ifndef PRIMITIV_DEVICES_NAIVE_OPS_SIMD_H_
+#define PRIMITIV_DEVICES_NAIVE_OPS_SIMD_H_
+
+#include <cstddef>
+
+// Lists of elementwise operations which have vectorized kernels.
+// Other operations (sin, cos, tan, pow, etc.) are always calculated by the
+// standard library.
+#define PRIMITIV_NAIVE_SIMD_FW_X_OPS(F) \
+  F(negate) F(abs) F(sqrt) F(exp) F(log) F(tanh) F(sigmoid) F(softplus)
+
+#define PRIMITIV_NAIVE_SIMD_BW_X_OPS(F) \
+  F(abs) F(sqrt) F(exp) F(log) F(tanh) F(sigmoid) F(softplus)
+
+#define PRIMITIV_NAIVE_SIMD_X_CONST_OPS(F) \
+  F(add_const) F(subtract_const_r) F(subtract_const_l) \
+  F(multiply_const) F(divide_const_r) F(divide_const_l) \
+  F(prelu) F(elu)
+
+#define PRIMITIV_NAIVE_SIMD_AB_OPS(F) \
+  F(add) F(subtract) F(multiply) F(divide)
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+/**
+ * Instruction sets used by vectorized kernels.
+ */
+enum class InstructionSet {
+  SCALAR,
+  NEON,
+  AVX2,
+  AVX512,
+};
+
+/**
+ * Table of elementwise kernels specialized for an instruction set.
+ * Each kernel processes `n` contiguous elements, and backward kernels
+ * accumulate gradients into their destinations.
+ */
+struct Kernels {
+  InstructionSet isa;
+  const char *name;
+
+#define PRIMITIV_NAIVE_SIMD_DECL_FW_X(op) \
+  void (*op##_fw)(const float *px, float *py, std::size_t n);
+#define PRIMITIV_NAIVE_SIMD_DECL_BW_X(op) \
+  void (*op##_bw)( \
+      const float *px, const float *py, const float *pgy, float *pgx, \
+      std::size_t n);
+#define PRIMITIV_NAIVE_SIMD_DECL_X_CONST(op) \
+  void (*op##_fw)(const float *px, float k, float *py, std::size_t n); \
+  void (*op##_bw)( \
+      const float *px, const float *py, const float *pgy, float k, \
+      float *pgx, std::size_t n);
+#define PRIMITIV_NAIVE_SIMD_DECL_AB(op) \
+  void (*op##_fw)(const float *pa, const float *pb, float *py, std::size_t n); \
+  void (*op##_bw)( \
+      const float *pa, const float *pb, const float *py, const float *pgy, \
+      float *pga, float *pgb, std::size_t n);
+
+  PRIMITIV_NAIVE_SIMD_FW_X_OPS(PRIMITIV_NAIVE_SIMD_DECL_FW_X)
+  PRIMITIV_NAIVE_SIMD_BW_X_OPS(PRIMITIV_NAIVE_SIMD_DECL_BW_X)
+  PRIMITIV_NAIVE_SIMD_X_CONST_OPS(PRIMITIV_NAIVE_SIMD_DECL_X_CONST)
+  PRIMITIV_NAIVE_SIMD_AB_OPS(PRIMITIV_NAIVE_SIMD_DECL_AB)
+
+#undef PRIMITIV_NAIVE_SIMD_DECL_FW_X
+#undef PRIMITIV_NAIVE_SIMD_DECL_BW_X
+#undef PRIMITIV_NAIVE_SIMD_DECL_X_CONST
+#undef PRIMITIV_NAIVE_SIMD_DECL_AB
+};
+
+/**
+ * Retrieves the kernels for the best instruction set supported by both the
+ * build and the running CPU.
+ * The CPU is examined only at the first call.
+ * @return Kernels.
+ */
+const Kernels &kernels();
+
+/**
+ * Retrieves the kernels for a specific instruction set.
+ * @param isa Instruction set.
+ * @return Kernels, or nullptr if the instruction set is not supported by the
+ *         build or the running CPU.
+ */
+const Kernels *get_kernels(InstructionSet isa);
+
+// Kernels of each instruction set. Each function returns nullptr if the
+// corresponding translation unit was compiled without the instruction set.
+// The CPU is not examined by these functions.
+const Kernels *get_scalar_kernels();
+const Kernels *get_neon_kernels();
+const Kernels *get_avx2_kernels();
+const Kernels *get_avx512_kernels();
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#endif  // PRIMITIV_DEVICES_NAIVE_OPS_SIMD_H_
@@ -0,0 +1,85 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+#include <immintrin.h>
+
+#include <primitiv/devices/naive/ops/simd_kernels.h>
+
+namespace {
+
+struct VecAVX2 {
+  using T = __m256;
+  using M = __m256;
+  static constexpr std::size_t WIDTH = 8;
+
+  static T load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, T x) { _mm256_storeu_ps(p, x); }
+  static T set1(float k) { return _mm256_set1_ps(k); }
+
+  static T add(T a, T b) { return _mm256_add_ps(a, b); }
+  static T sub(T a, T b) { return _mm256_sub_ps(a, b); }
+  static T mul(T a, T b) { return _mm256_mul_ps(a, b); }
+  static T div(T a, T b) { return _mm256_div_ps(a, b); }
+  static T fma(T a, T b, T c) { return _mm256_fmadd_ps(a, b, c); }
+  static T min(T a, T b) { return _mm256_min_ps(a, b); }
+  static T max(T a, T b) { return _mm256_max_ps(a, b); }
+  static T abs(T x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), x); }
+  static T neg(T x) { return _mm256_xor_ps(_mm256_set1_ps(-0.f), x); }
+  static T sqrt(T x) { return _mm256_sqrt_ps(x); }
+
+  static T round(T x) {
+    return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  static T pow2(T n) {
+    const __m256i e = _mm256_add_epi32(
+        _mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+  }
+  static T frexp(T x, T &e) {
+    const __m256i bits = _mm256_castps_si256(x);
+    e = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+          _mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    return _mm256_castsi256_ps(_mm256_or_si256(
+          _mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+          _mm256_set1_epi32(0x3f000000)));
+  }
+
+  static M lt(T a, T b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static M gt(T a, T b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+  static M eq(T a, T b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+  static M nge(T a, T b) { return _mm256_cmp_ps(a, b, _CMP_NGE_UQ); }
+  static T select(M m, T a, T b) { return _mm256_blendv_ps(b, a, m); }
+};
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_avx2_kernels() {
+  static const Kernels ks = ::simd_kernels::make_kernels<::VecAVX2>(
+      InstructionSet::AVX2, "AVX2");
+  return &ks;
+}
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#else  // defined(__AVX2__) && defined(__FMA__)
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_avx2_kernels() { return nullptr; }
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#endif  // defined(__AVX2__) && defined(__FMA__)
@@ -0,0 +1,92 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#include <primitiv/devices/naive/ops/simd_kernels.h>
+
+namespace {
+
+struct VecAVX512 {
+  using T = __m512;
+  using M = __mmask16;
+  static constexpr std::size_t WIDTH = 16;
+
+  static T load(const float *p) { return _mm512_loadu_ps(p); }
+  static void store(float *p, T x) { _mm512_storeu_ps(p, x); }
+  static T set1(float k) { return _mm512_set1_ps(k); }
+
+  static T add(T a, T b) { return _mm512_add_ps(a, b); }
+  static T sub(T a, T b) { return _mm512_sub_ps(a, b); }
+  static T mul(T a, T b) { return _mm512_mul_ps(a, b); }
+  static T div(T a, T b) { return _mm512_div_ps(a, b); }
+  static T fma(T a, T b, T c) { return _mm512_fmadd_ps(a, b, c); }
+  static T min(T a, T b) { return _mm512_min_ps(a, b); }
+  static T max(T a, T b) { return _mm512_max_ps(a, b); }
+  static T abs(T x) {
+    return _mm512_castsi512_ps(_mm512_and_si512(
+          _mm512_castps_si512(x), _mm512_set1_epi32(0x7fffffff)));
+  }
+  static T neg(T x) {
+    return _mm512_castsi512_ps(_mm512_xor_si512(
+          _mm512_castps_si512(x), _mm512_set1_epi32(0x80000000)));
+  }
+  static T sqrt(T x) { return _mm512_sqrt_ps(x); }
+
+  static T round(T x) {
+    return _mm512_roundscale_ps(
+        x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  static T pow2(T n) {
+    const __m512i e = _mm512_add_epi32(
+        _mm512_cvtps_epi32(n), _mm512_set1_epi32(127));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(e, 23));
+  }
+  static T frexp(T x, T &e) {
+    const __m512i bits = _mm512_castps_si512(x);
+    e = _mm512_cvtepi32_ps(_mm512_sub_epi32(
+          _mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+    return _mm512_castsi512_ps(_mm512_or_si512(
+          _mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)),
+          _mm512_set1_epi32(0x3f000000)));
+  }
+
+  static M lt(T a, T b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  static M gt(T a, T b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+  static M eq(T a, T b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+  static M nge(T a, T b) { return _mm512_cmp_ps_mask(a, b, _CMP_NGE_UQ); }
+  static T select(M m, T a, T b) { return _mm512_mask_blend_ps(m, b, a); }
+};
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_avx512_kernels() {
+  static const Kernels ks = ::simd_kernels::make_kernels<::VecAVX512>(
+      InstructionSet::AVX512, "AVX-512");
+  return &ks;
+}
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#else  // defined(__AVX512F__)
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_avx512_kernels() { return nullptr; }
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#endif  // defined(__AVX512F__)
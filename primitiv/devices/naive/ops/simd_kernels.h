@@ -0,0 +1,359 @@
+#ifndef PRIMITIV_DEVICES_NAIVE_OPS_SIMD_KERNELS_H_
+#define PRIMITIV_DEVICES_NAIVE_OPS_SIMD_KERNELS_H_
+
+// Generic implementation of vectorized kernels.
+//
+// This file is included only by the translation units of each instruction
+// set, which are compiled with their own machine options.
+// Everything is defined in an unnamed namespace so that code generated for
+// some instruction set never be shared with other translation units by the
+// linker. For the same reason, functions in the standard library should not
+// be used here.
+//
+// The vector type `V` should provide following members:
+//   T, M: Types of a float vector and a mask.
+//   WIDTH: Number of elements in T.
+//   load(p), store(p, x), set1(k)
+//   add(a, b), sub(a, b), mul(a, b), div(a, b), fma(a, b, c) = a * b + c
+//   min(a, b), max(a, b): Return NaN if b is NaN.
+//   abs(x), neg(x), sqrt(x)
+//   round(x): Rounds to the nearest integer.
+//   pow2(n): Calculates 2^n for integral n in [-126, 127].
+//   frexp(x, e): Splits positive normal x into the mantissa in [0.5, 1) and
+//                the exponent.
+//   lt(a, b), gt(a, b), eq(a, b): Ordered comparisons.
+//   nge(a, b): Unordered !(a >= b).
+//   select(m, a, b): m ? a : b
+
+#include <cstddef>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+namespace {
+
+namespace simd_kernels {
+
+namespace math {
+
+constexpr float INF = __builtin_huge_valf();
+constexpr float NAN_ = __builtin_nanf("");
+
+// exp(x) based on the Cephes library.
+// 2^n is multiplied in two steps to treat overflows and subnormals correctly.
+template<typename V>
+inline typename V::T exp(typename V::T x) {
+  using T = typename V::T;
+  x = V::min(V::set1(89.f), V::max(V::set1(-104.f), x));
+  const T n = V::round(V::mul(x, V::set1(1.44269504088896341f)));
+  T r = V::fma(n, V::set1(-0.693359375f), x);
+  r = V::fma(n, V::set1(2.12194440e-4f), r);
+  T p = V::set1(1.9875691500e-4f);
+  p = V::fma(p, r, V::set1(1.3981999507e-3f));
+  p = V::fma(p, r, V::set1(8.3334519073e-3f));
+  p = V::fma(p, r, V::set1(4.1665795894e-2f));
+  p = V::fma(p, r, V::set1(1.6666665459e-1f));
+  p = V::fma(p, r, V::set1(5.0000001201e-1f));
+  p = V::fma(p, V::mul(r, r), V::add(r, V::set1(1.f)));
+  const T n1 = V::round(V::mul(n, V::set1(.5f)));
+  return V::mul(V::mul(p, V::pow2(n1)), V::pow2(V::sub(n, n1)));
+}
+
+// log(x) based on the Cephes library.
+template<typename V>
+inline typename V::T log(typename V::T x) {
+  using T = typename V::T;
+  using M = typename V::M;
+  const T zero = V::set1(0.f);
+  const M subnormal = V::lt(x, V::set1(1.17549435e-38f));
+  T e;
+  T m = V::frexp(V::select(subnormal, V::mul(x, V::set1(8388608.f)), x), e);
+  e = V::select(subnormal, V::sub(e, V::set1(23.f)), e);
+  const M small = V::lt(m, V::set1(0.707106781186547524f));
+  e = V::select(small, V::sub(e, V::set1(1.f)), e);
+  m = V::sub(V::select(small, V::add(m, m), m), V::set1(1.f));
+  const T z = V::mul(m, m);
+  T p = V::set1(7.0376836292e-2f);
+  p = V::fma(p, m, V::set1(-1.1514610310e-1f));
+  p = V::fma(p, m, V::set1(1.1676998740e-1f));
+  p = V::fma(p, m, V::set1(-1.2420140846e-1f));
+  p = V::fma(p, m, V::set1(1.4249322787e-1f));
+  p = V::fma(p, m, V::set1(-1.6668057665e-1f));
+  p = V::fma(p, m, V::set1(2.0000714765e-1f));
+  p = V::fma(p, m, V::set1(-2.4999993993e-1f));
+  p = V::fma(p, m, V::set1(3.3333331174e-1f));
+  p = V::mul(V::mul(p, m), z);
+  p = V::fma(e, V::set1(-2.12194440e-4f), p);
+  p = V::fma(z, V::set1(-.5f), p);
+  T y = V::fma(e, V::set1(0.693359375f), V::add(m, p));
+  y = V::select(V::eq(x, zero), V::set1(-INF), y);
+  y = V::select(V::eq(x, V::set1(INF)), x, y);
+  return V::select(V::nge(x, zero), V::set1(NAN_), y);
+}
+
+// tanh(x) based on the Cephes library.
+template<typename V>
+inline typename V::T tanh(typename V::T x) {
+  using T = typename V::T;
+  const T one = V::set1(1.f);
+  const T ax = V::abs(x);
+  const T z = V::mul(x, x);
+  T p = V::set1(-5.70498872745e-3f);
+  p = V::fma(p, z, V::set1(2.06390887954e-2f));
+  p = V::fma(p, z, V::set1(-5.37397155531e-2f));
+  p = V::fma(p, z, V::set1(1.33314422036e-1f));
+  p = V::fma(p, z, V::set1(-3.33332819422e-1f));
+  const T y_small = V::fma(V::mul(p, z), x, x);
+  T y_large = V::sub(
+      one, V::div(V::set1(2.f), V::add(exp<V>(V::add(ax, ax)), one)));
+  y_large = V::select(V::lt(x, V::set1(0.f)), V::neg(y_large), y_large);
+  return V::select(V::lt(ax, V::set1(.625f)), y_small, y_large);
+}
+
+template<typename V>
+inline typename V::T sigmoid(typename V::T x) {
+  const typename V::T one = V::set1(1.f);
+  return V::div(one, V::add(one, exp<V>(V::neg(x))));
+}
+
+}  // namespace math
+
+namespace op {
+
+// Unary operations.
+// fw(x) returns y, and bw(x, y, gy) returns the gradient added to gx.
+
+#define PRIMITIV_NAIVE_SIMD_UNARY(name, fw_op, bw_op) \
+struct name { \
+  template<typename V> \
+  static inline typename V::T fw(typename V::T x) { return (fw_op); } \
+  template<typename V> \
+  static inline typename V::T bw( \
+      typename V::T x, typename V::T y, typename V::T gy) { \
+    static_cast<void>(x); static_cast<void>(y); \
+    return (bw_op); \
+  } \
+};
+
+PRIMITIV_NAIVE_SIMD_UNARY(negate, V::neg(x), V::neg(gy))
+PRIMITIV_NAIVE_SIMD_UNARY(
+    abs, V::abs(x),
+    V::select(
+      V::gt(x, V::set1(0.f)), gy,
+      V::select(V::lt(x, V::set1(0.f)), V::neg(gy), V::set1(0.f))))
+PRIMITIV_NAIVE_SIMD_UNARY(
+    sqrt, V::sqrt(x), V::div(V::mul(V::set1(.5f), gy), y))
+PRIMITIV_NAIVE_SIMD_UNARY(exp, math::exp<V>(x), V::mul(y, gy))
+PRIMITIV_NAIVE_SIMD_UNARY(log, math::log<V>(x), V::div(gy, x))
+PRIMITIV_NAIVE_SIMD_UNARY(
+    tanh, math::tanh<V>(x), V::mul(V::sub(V::set1(1.f), V::mul(y, y)), gy))
+PRIMITIV_NAIVE_SIMD_UNARY(
+    sigmoid, math::sigmoid<V>(x),
+    V::mul(V::mul(y, V::sub(V::set1(1.f), y)), gy))
+PRIMITIV_NAIVE_SIMD_UNARY(
+    softplus,
+    V::add(
+      V::max(V::set1(0.f), x),
+      math::log<V>(V::add(V::set1(1.f), math::exp<V>(V::neg(V::abs(x)))))),
+    V::mul(math::sigmoid<V>(x), gy))
+
+#undef PRIMITIV_NAIVE_SIMD_UNARY
+
+// Operations with a constant.
+// fw(x, k) returns y, and bw(x, y, gy, k) returns the gradient added to gx.
+
+#define PRIMITIV_NAIVE_SIMD_CONST(name, fw_op, bw_op) \
+struct name { \
+  template<typename V> \
+  static inline typename V::T fw(typename V::T x, typename V::T k) { \
+    static_cast<void>(k); \
+    return (fw_op); \
+  } \
+  template<typename V> \
+  static inline typename V::T bw( \
+      typename V::T x, typename V::T y, typename V::T gy, typename V::T k) { \
+    static_cast<void>(x); static_cast<void>(y); static_cast<void>(k); \
+    return (bw_op); \
+  } \
+};
+
+PRIMITIV_NAIVE_SIMD_CONST(add_const, V::add(x, k), gy)
+PRIMITIV_NAIVE_SIMD_CONST(subtract_const_r, V::sub(x, k), gy)
+PRIMITIV_NAIVE_SIMD_CONST(subtract_const_l, V::sub(k, x), V::neg(gy))
+PRIMITIV_NAIVE_SIMD_CONST(multiply_const, V::mul(x, k), V::mul(k, gy))
+PRIMITIV_NAIVE_SIMD_CONST(divide_const_r, V::div(x, k), V::div(gy, k))
+PRIMITIV_NAIVE_SIMD_CONST(
+    divide_const_l, V::div(k, x), V::neg(V::div(V::mul(y, gy), x)))
+PRIMITIV_NAIVE_SIMD_CONST(
+    prelu,
+    V::select(V::gt(x, V::set1(0.f)), x, V::mul(k, x)),
+    V::select(V::gt(x, V::set1(0.f)), gy, V::mul(k, gy)))
+PRIMITIV_NAIVE_SIMD_CONST(
+    elu,
+    V::select(
+      V::gt(x, V::set1(0.f)), x,
+      V::mul(k, V::sub(math::exp<V>(x), V::set1(1.f)))),
+    V::select(V::gt(x, V::set1(0.f)), gy, V::mul(V::add(y, k), gy)))
+
+#undef PRIMITIV_NAIVE_SIMD_CONST
+
+// Binary operations.
+// fw(a, b) returns y, and bw_a(a, b, y, gy) and bw_b(a, b, y, gy) return the
+// gradients added to ga and gb respectively.
+
+#define PRIMITIV_NAIVE_SIMD_BINARY(name, fw_op, ga_op, gb_op) \
+struct name { \
+  template<typename V> \
+  static inline typename V::T fw(typename V::T a, typename V::T b) { \
+    return (fw_op); \
+  } \
+  template<typename V> \
+  static inline typename V::T bw_a( \
+      typename V::T a, typename V::T b, typename V::T y, typename V::T gy) { \
+    static_cast<void>(a); static_cast<void>(b); static_cast<void>(y); \
+    return (ga_op); \
+  } \
+  template<typename V> \
+  static inline typename V::T bw_b( \
+      typename V::T a, typename V::T b, typename V::T y, typename V::T gy) { \
+    static_cast<void>(a); static_cast<void>(b); static_cast<void>(y); \
+    return (gb_op); \
+  } \
+};
+
+PRIMITIV_NAIVE_SIMD_BINARY(add, V::add(a, b), gy, gy)
+PRIMITIV_NAIVE_SIMD_BINARY(subtract, V::sub(a, b), gy, V::neg(gy))
+PRIMITIV_NAIVE_SIMD_BINARY(multiply, V::mul(a, b), V::mul(gy, b), V::mul(gy, a))
+PRIMITIV_NAIVE_SIMD_BINARY(
+    divide, V::div(a, b), V::div(gy, b), V::neg(V::mul(V::div(gy, b), y)))
+
+#undef PRIMITIV_NAIVE_SIMD_BINARY
+
+}  // namespace op
+
+// Loads/stores `m` (<= WIDTH) elements.
+template<typename V>
+inline typename V::T load(const float *p, std::size_t m) {
+  if (m == V::WIDTH) return V::load(p);
+  float buf[V::WIDTH] = {};
+  for (std::size_t j = 0; j < m; ++j) buf[j] = p[j];
+  return V::load(buf);
+}
+
+template<typename V>
+inline void store(float *p, typename V::T x, std::size_t m) {
+  if (m == V::WIDTH) {
+    V::store(p, x);
+    return;
+  }
+  float buf[V::WIDTH];
+  V::store(buf, x);
+  for (std::size_t j = 0; j < m; ++j) p[j] = buf[j];
+}
+
+template<typename V>
+inline std::size_t remaining(std::size_t i, std::size_t n) {
+  return n - i < V::WIDTH ? n - i : V::WIDTH;
+}
+
+template<typename V, typename Op>
+void fw_x(const float *px, float *py, std::size_t n) {
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    store<V>(py + i, Op::template fw<V>(load<V>(px + i, m)), m);
+  }
+}
+
+template<typename V, typename Op>
+void bw_x(
+    const float *px, const float *py, const float *pgy, float *pgx,
+    std::size_t n) {
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    const typename V::T gx = Op::template bw<V>(
+        load<V>(px + i, m), load<V>(py + i, m), load<V>(pgy + i, m));
+    store<V>(pgx + i, V::add(load<V>(pgx + i, m), gx), m);
+  }
+}
+
+template<typename V, typename Op>
+void fw_x_const(const float *px, float k, float *py, std::size_t n) {
+  const typename V::T kk = V::set1(k);
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    store<V>(py + i, Op::template fw<V>(load<V>(px + i, m), kk), m);
+  }
+}
+
+template<typename V, typename Op>
+void bw_x_const(
+    const float *px, const float *py, const float *pgy, float k, float *pgx,
+    std::size_t n) {
+  const typename V::T kk = V::set1(k);
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    const typename V::T gx = Op::template bw<V>(
+        load<V>(px + i, m), load<V>(py + i, m), load<V>(pgy + i, m), kk);
+    store<V>(pgx + i, V::add(load<V>(pgx + i, m), gx), m);
+  }
+}
+
+template<typename V, typename Op>
+void fw_ab(const float *pa, const float *pb, float *py, std::size_t n) {
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    store<V>(
+        py + i, Op::template fw<V>(load<V>(pa + i, m), load<V>(pb + i, m)), m);
+  }
+}
+
+template<typename V, typename Op>
+void bw_ab(
+    const float *pa, const float *pb, const float *py, const float *pgy,
+    float *pga, float *pgb, std::size_t n) {
+  for (std::size_t i = 0; i < n; i += V::WIDTH) {
+    const std::size_t m = remaining<V>(i, n);
+    const typename V::T a = load<V>(pa + i, m);
+    const typename V::T b = load<V>(pb + i, m);
+    const typename V::T y = load<V>(py + i, m);
+    const typename V::T gy = load<V>(pgy + i, m);
+    // pgb is loaded after storing pga because ga and gb may be the same
+    // tensor.
+    store<V>(
+        pga + i,
+        V::add(load<V>(pga + i, m), Op::template bw_a<V>(a, b, y, gy)), m);
+    store<V>(
+        pgb + i,
+        V::add(load<V>(pgb + i, m), Op::template bw_b<V>(a, b, y, gy)), m);
+  }
+}
+
+template<typename V>
+primitiv::devices::simd::Kernels make_kernels(
+    primitiv::devices::simd::InstructionSet isa, const char *isa_name) {
+  primitiv::devices::simd::Kernels ks;
+  ks.isa = isa;
+  ks.name = isa_name;
+#define PRIMITIV_NAIVE_SIMD_SET_FW_X(name) ks.name##_fw = fw_x<V, op::name>;
+#define PRIMITIV_NAIVE_SIMD_SET_BW_X(name) ks.name##_bw = bw_x<V, op::name>;
+#define PRIMITIV_NAIVE_SIMD_SET_X_CONST(name) \
+  ks.name##_fw = fw_x_const<V, op::name>; \
+  ks.name##_bw = bw_x_const<V, op::name>;
+#define PRIMITIV_NAIVE_SIMD_SET_AB(name) \
+  ks.name##_fw = fw_ab<V, op::name>; \
+  ks.name##_bw = bw_ab<V, op::name>;
+  PRIMITIV_NAIVE_SIMD_FW_X_OPS(PRIMITIV_NAIVE_SIMD_SET_FW_X)
+  PRIMITIV_NAIVE_SIMD_BW_X_OPS(PRIMITIV_NAIVE_SIMD_SET_BW_X)
+  PRIMITIV_NAIVE_SIMD_X_CONST_OPS(PRIMITIV_NAIVE_SIMD_SET_X_CONST)
+  PRIMITIV_NAIVE_SIMD_AB_OPS(PRIMITIV_NAIVE_SIMD_SET_AB)
+#undef PRIMITIV_NAIVE_SIMD_SET_FW_X
+#undef PRIMITIV_NAIVE_SIMD_SET_BW_X
+#undef PRIMITIV_NAIVE_SIMD_SET_X_CONST
+#undef PRIMITIV_NAIVE_SIMD_SET_AB
+  return ks;
+}
+
+}  // namespace simd_kernels
+
+}  // namespace
+
+#endif  // PRIMITIV_DEVICES_NAIVE_OPS_SIMD_KERNELS_H_
@@ -0,0 +1,81 @@
+#include <primitiv/config.h>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+#include <primitiv/devices/naive/ops/simd_kernels.h>
+
+namespace {
+
+struct VecNEON {
+  using T = float32x4_t;
+  using M = uint32x4_t;
+  static constexpr std::size_t WIDTH = 4;
+
+  static T load(const float *p) { return vld1q_f32(p); }
+  static void store(float *p, T x) { vst1q_f32(p, x); }
+  static T set1(float k) { return vdupq_n_f32(k); }
+
+  static T add(T a, T b) { return vaddq_f32(a, b); }
+  static T sub(T a, T b) { return vsubq_f32(a, b); }
+  static T mul(T a, T b) { return vmulq_f32(a, b); }
+  static T div(T a, T b) { return vdivq_f32(a, b); }
+  static T fma(T a, T b, T c) { return vfmaq_f32(c, a, b); }
+  static T min(T a, T b) { return vminq_f32(a, b); }
+  static T max(T a, T b) { return vmaxq_f32(a, b); }
+  static T abs(T x) { return vabsq_f32(x); }
+  static T neg(T x) { return vnegq_f32(x); }
+  static T sqrt(T x) { return vsqrtq_f32(x); }
+
+  static T round(T x) { return vrndnq_f32(x); }
+  static T pow2(T n) {
+    const int32x4_t e = vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127));
+    return vreinterpretq_f32_s32(vshlq_n_s32(e, 23));
+  }
+  static T frexp(T x, T &e) {
+    const uint32x4_t bits = vreinterpretq_u32_f32(x);
+    e = vcvtq_f32_s32(vsubq_s32(
+          vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(126)));
+    return vreinterpretq_f32_u32(vorrq_u32(
+          vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f000000)));
+  }
+
+  static M lt(T a, T b) { return vcltq_f32(a, b); }
+  static M gt(T a, T b) { return vcgtq_f32(a, b); }
+  static M eq(T a, T b) { return vceqq_f32(a, b); }
+  static M nge(T a, T b) { return vmvnq_u32(vcgeq_f32(a, b)); }
+  static T select(M m, T a, T b) { return vbslq_f32(m, a, b); }
+};
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_neon_kernels() {
+  static const Kernels ks = ::simd_kernels::make_kernels<::VecNEON>(
+      InstructionSet::NEON, "NEON");
+  return &ks;
+}
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#else  // defined(__aarch64__) && defined(__ARM_NEON)
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+const Kernels *get_neon_kernels() { return nullptr; }
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
+
+#endif  // defined(__aarch64__) && defined(__ARM_NEON)
@@ -0,0 +1,110 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace {
+
+inline float sigmoid(float x) { return .5 + .5 * std::tanh(.5 * x); }
+
+}  // namespace
+
+namespace primitiv {
+namespace devices {
+
+void Naive::sru_fw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b,
+    Tensor &h, Tensor &c) {
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const std::uint32_t bs = h.shape().batch();
+  const std::uint32_t skip_x = x.shape().has_batch() * n * len;
+  const std::uint32_t skip_u = u.shape().has_batch() * 3 * n * len;
+  const std::uint32_t skip_b = b.shape().has_batch() * 2 * n;
+  const float *px = CDATA(x);
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  float *ph = MDATA(h);
+  float *pc = MDATA(c);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      float cy = 0;
+      for (std::uint32_t t = 0; t < len; ++t) {
+        const float *ut = pu + 3 * n * t;
+        const float f = ::sigmoid(ut[n + k] + pb[k]);
+        const float r = ::sigmoid(ut[2 * n + k] + pb[n + k]);
+        cy = f * cy + (1 - f) * ut[k];
+        pc[n * t + k] = cy;
+        ph[n * t + k] = r * std::tanh(cy) + (1 - r) * px[n * t + k];
+      }
+    }
+    px += skip_x;
+    pu += skip_u;
+    pb += skip_b;
+    ph += n * len;
+    pc += n * len;
+  }
+}
+
+void Naive::sru_bw_impl(
+    const Tensor &x, const Tensor &u, const Tensor &b, const Tensor &c,
+    const Tensor &gh, const Tensor &gc,
+    Tensor &gx, Tensor &gu, Tensor &gb) {
+  const std::uint32_t n = x.shape()[0];
+  const std::uint32_t len = x.shape()[1];
+  const std::uint32_t bs = gh.shape().batch();
+  const std::uint32_t skip_x = x.shape().has_batch() * n * len;
+  const std::uint32_t skip_u = u.shape().has_batch() * 3 * n * len;
+  const std::uint32_t skip_b = b.shape().has_batch() * 2 * n;
+  const float *px = CDATA(x);
+  const float *pu = CDATA(u);
+  const float *pb = CDATA(b);
+  const float *pc = CDATA(c);
+  const float *pgh = CDATA(gh);
+  const float *pgc = CDATA(gc);
+  float *pgx = MDATA(gx);
+  float *pgu = MDATA(gu);
+  float *pgb = MDATA(gb);
+
+  for (std::uint32_t batch = 0; batch < bs; ++batch) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      // Gradient of the cell state propagated from the next step.
+      float gcy_next = 0;
+      for (std::uint32_t t = len; t > 0; ) {
+        --t;
+        const std::uint32_t i = n * t + k;
+        const float *ut = pu + 3 * n * t;
+        float *gut = pgu + 3 * n * t;
+        const float f = ::sigmoid(ut[n + k] + pb[k]);
+        const float r = ::sigmoid(ut[2 * n + k] + pb[n + k]);
+        const float c_prev = t > 0 ? pc[i - n] : 0;
+        const float tc = std::tanh(pc[i]);
+        const float gcy = pgc[i] + gcy_next + pgh[i] * r * (1 - tc * tc);
+        const float gf = gcy * (c_prev - ut[k]) * f * (1 - f);
+        const float gr = pgh[i] * (tc - px[i]) * r * (1 - r);
+        pgx[i] += pgh[i] * (1 - r);
+        gut[k] += gcy * (1 - f);
+        gut[n + k] += gf;
+        gut[2 * n + k] += gr;
+        pgb[k] += gf;
+        pgb[n + k] += gr;
+        gcy_next = gcy * f;
+      }
+    }
+    px += skip_x;
+    pu += skip_u;
+    pb += skip_b;
+    pc += n * len;
+    pgh += n * len;
+    pgc += n * len;
+    pgx += skip_x;
+    pgu += skip_u;
+    pgb += skip_b;
+  }
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -1,5 +1,7 @@
 #include <primitiv/config.h>
 
+#include <algorithm>
+
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/devices/naive/ops/common.h>
 
@@ -13,15 +15,20 @@ void Naive::sum_fw_impl(const Tensor &x, std::uint32_t dim, Tensor &y) {
   const std::uint32_t skip2 = skip1 * n;
   float *dest = MDATA(y);
   const float *src = CDATA(x);
-  for (std::uint32_t i = 0; i < repeat; ++i) {
-    std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
-    float tmp = 0;
-    for (std::uint32_t j = 0; j < n; ++j) {
-      tmp += src[offset];
-      offset += skip1;
+  // Each output requires `n` operations.
+  parallel_for(
+      repeat, std::max<std::size_t>(1, PARALLEL_GRAIN_SIZE / n),
+      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      std::uint32_t offset = i % skip1 + (i / skip1) * skip2;
+      float tmp = 0;
+      for (std::uint32_t j = 0; j < n; ++j) {
+        tmp += src[offset];
+        offset += skip1;
+      }
+      dest[i] = tmp;
     }
-    dest[i] = tmp;
-  }
+  });
 }
 
 }  // namespace devices
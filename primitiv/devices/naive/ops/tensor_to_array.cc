@@ -0,0 +1,16 @@
+#include <primitiv/config.h>
+
+#include <cstring>
+
+#include <primitiv/devices/naive/device.h>
+#include <primitiv/devices/naive/ops/common.h>
+
+namespace primitiv {
+namespace devices {
+
+void Naive::tensor_to_array_impl(const Tensor &x, float values[]) {
+  std::memcpy(values, CDATA(x), sizeof(float) * x.shape().size());
+}
+
+}  // namespace devices
+}  // namespace primitiv
@@ -13,6 +13,7 @@
 #include <primitiv/core/parameter.h>
 #include <primitiv/core/shape.h>
 #include <primitiv/core/tensor.h>
+#include <primitiv/core/tensor_expression.h>
 #include <primitiv/core/optimizer_impl.h>
 #include <primitiv/devices/naive/device.h>
 
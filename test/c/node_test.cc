@@ -64,5 +64,35 @@ TEST_F(CNodeTest, CheckCopy) {
   ::primitivDeleteNode(b);
 }
 
+TEST_F(CNodeTest, CheckInputTensorByExternalMemory) {
+  float data[] = {1, 2, 3, 4};
+  const uint32_t dims[] = {2, 2};
+  ::primitivShape_t *shape;
+  ASSERT_EQ(PRIMITIV_C_OK,
+            ::primitivCreateShapeWithDims(dims, 2, 1, &shape));
+  ::primitivTensor_t *x;
+  ASSERT_EQ(PRIMITIV_C_OK, ::primitivCreateTensorByExternalMemory(
+        shape, data, nullptr, nullptr, &x));
+  ::primitivNode_t *a;
+  ASSERT_EQ(PRIMITIV_C_OK, ::primitivApplyNodeInputTensor(x, nullptr, &a));
+
+  // The node reads values from the memory given by the user.
+  data[3] = 5;
+  float values[4];
+  std::size_t size = 4;
+  ASSERT_EQ(PRIMITIV_C_OK, ::primitivEvaluateNodeAsArray(a, values, &size));
+  EXPECT_TRUE(test_utils::vector_match(
+        std::vector<float> {1, 2, 3, 5},
+        std::vector<float>(values, values + 4)));
+
+  ::primitivTensor_t *y;
+  EXPECT_EQ(PRIMITIV_C_ERROR, ::primitivCreateTensorByExternalMemory(
+        shape, nullptr, nullptr, nullptr, &y));
+
+  ::primitivDeleteShape(shape);
+  ::primitivDeleteNode(a);
+  ::primitivDeleteTensor(x);
+}
+
 }  // namespace c
 }  // namespace primitiv
@@ -1,12 +1,14 @@
 #include <primitiv/config.h>
 
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include <primitiv/devices/eigen/device.h>
+#include <primitiv/devices/naive/device.h>
 #include <primitiv/core/error.h>
 #include <primitiv/core/shape.h>
 #include <primitiv/core/tensor.h>
@@ -19,7 +21,15 @@ using test_utils::vector_near;
 
 namespace primitiv {
 
-class EigenDeviceTest : public testing::Test {};
+class EigenDeviceTest : public testing::Test {
+protected:
+  // Helper to observe internal memories of tensors.
+  class EigenWithHandle : public devices::Eigen {
+  public:
+    using devices::Eigen::Eigen;
+    static const void *handle(const Tensor &x) { return get_handle(x); }
+  };
+};
 
 TEST_F(EigenDeviceTest, CheckDeviceType) {
   devices::Eigen dev;
@@ -56,6 +66,45 @@ TEST_F(EigenDeviceTest, CheckDanglingTensor) {
   SUCCEED();
 }
 
+TEST_F(EigenDeviceTest, CheckMemoryPool) {
+  EigenWithHandle dev;
+  EXPECT_TRUE(dev.uses_memory_pool());
+  const void *p1;
+  {
+    const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}), 0);
+    p1 = EigenWithHandle::handle(x);
+  }
+  {
+    // The released block is supplied again for the same size class.
+    const Tensor x = dev.new_tensor_by_constant(Shape({3, 5}), 0);
+    EXPECT_EQ(p1, EigenWithHandle::handle(x));
+  }
+  dev.trim();
+  {
+    const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}), 1);
+    EXPECT_TRUE(vector_match(vector<float>(16, 1), x.to_vector()));
+  }
+}
+
+TEST_F(EigenDeviceTest, CheckWithoutMemoryPool) {
+  EigenWithHandle dev(12345, false);
+  EXPECT_FALSE(dev.uses_memory_pool());
+  dev.trim();  // Does nothing.
+  const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}, 3), 2);
+  EXPECT_TRUE(vector_match(vector<float>(48, 2), x.to_vector()));
+}
+
+TEST_F(EigenDeviceTest, CheckAlignment) {
+  for (const bool use_pool : {true, false}) {
+    EigenWithHandle dev(12345, use_pool);
+    for (const Shape &s : {Shape(), Shape({3}), Shape({5, 7}, 3)}) {
+      const Tensor x = dev.new_tensor_by_constant(s, 0);
+      EXPECT_EQ(0u,
+          reinterpret_cast<std::uintptr_t>(EigenWithHandle::handle(x)) % 64);
+    }
+  }
+}
+
 #ifdef PRIMITIV_BUILD_TESTS_PROBABILISTIC
 TEST_F(EigenDeviceTest, CheckRandomBernoulli) {
   vector<vector<float>> history;
@@ -226,4 +275,148 @@ TEST_F(EigenDeviceTest, CheckRandomLogNormalWithSeed) {
 #endif
 }
 
+TEST_F(EigenDeviceTest, CheckConv2DWithChunkedWorkspace) {
+  struct TestCase {
+    Shape x_shape, w_shape;
+    std::uint32_t pad0, pad1, str0, str1, dil0, dil1;
+  };
+  // Column matrices of these cases are larger than the workspace, and
+  // output positions are processed in several chunks.
+  // 3x3 filters with stride 1 and no dilation use the Winograd algorithm in
+  // the forward pass, and the last case also splits its tiles into chunks.
+  const vector<TestCase> test_cases {
+    {{130, 130, 8}, {3, 3, 8, 2}, 1, 1, 1, 1, 1, 1},
+    {Shape({300, 121, 16}, 2), {3, 5, 16, 3}, 2, 1, 2, 3, 2, 1},
+    {{140, 140, 12}, Shape({3, 3, 12, 2}, 2), 0, 0, 1, 1, 1, 1},
+    {{201, 199, 32}, {3, 3, 32, 4}, 1, 2, 1, 1, 1, 1},
+  };
+  devices::Naive ref_dev(0);
+  devices::Eigen dev;
+  for (const TestCase &tc : test_cases) {
+    const Tensor ref_x = ref_dev.random_uniform(tc.x_shape, -1, 1);
+    const Tensor ref_w = ref_dev.random_uniform(tc.w_shape, -1, 1);
+    const Tensor ref_y = ref_dev.conv2d_fw(
+        ref_x, ref_w, tc.pad0, tc.pad1, tc.str0, tc.str1, tc.dil0, tc.dil1);
+    const Tensor ref_gy = ref_dev.random_uniform(ref_y.shape(), -1, 1);
+    Tensor ref_gx = ref_dev.new_tensor_by_constant(tc.x_shape, 1);
+    Tensor ref_gw = ref_dev.new_tensor_by_constant(tc.w_shape, 1);
+    ref_dev.conv2d_bw(
+        ref_x, ref_w, ref_y, ref_gy,
+        tc.pad0, tc.pad1, tc.str0, tc.str1, tc.dil0, tc.dil1,
+        ref_gx, ref_gw);
+
+    const Tensor x = dev.new_tensor_by_vector(tc.x_shape, ref_x.to_vector());
+    const Tensor w = dev.new_tensor_by_vector(tc.w_shape, ref_w.to_vector());
+    const Tensor y = dev.conv2d_fw(
+        x, w, tc.pad0, tc.pad1, tc.str0, tc.str1, tc.dil0, tc.dil1);
+    const Tensor gy = dev.new_tensor_by_vector(y.shape(), ref_gy.to_vector());
+    Tensor gx = dev.new_tensor_by_constant(tc.x_shape, 1);
+    Tensor gw = dev.new_tensor_by_constant(tc.w_shape, 1);
+    dev.conv2d_bw(
+        x, w, y, gy, tc.pad0, tc.pad1, tc.str0, tc.str1, tc.dil0, tc.dil1,
+        gx, gw);
+
+    EXPECT_EQ(ref_y.shape(), y.shape());
+    EXPECT_TRUE(vector_near(ref_y.to_vector(), y.to_vector(), 1e-4));
+    EXPECT_TRUE(vector_near(ref_gx.to_vector(), gx.to_vector(), 1e-4));
+    EXPECT_TRUE(vector_near(ref_gw.to_vector(), gw.to_vector(), 1e-2));
+  }
+}
+
+TEST_F(EigenDeviceTest, CheckNumThreads) {
+  {
+    devices::Eigen dev;
+    EXPECT_EQ(1u, dev.num_threads());
+  }
+  for (const std::uint32_t n : {1u, 2u, 4u}) {
+    devices::Eigen dev(0, true, n);
+    EXPECT_EQ(n, dev.num_threads());
+  }
+  EXPECT_THROW(devices::Eigen(0, true, 0), Error);
+}
+
+TEST_F(EigenDeviceTest, CheckMultiThreadedOperations) {
+  // Tensors are large enough to be split into several chunks, and results
+  // should be equal to those of the single-threaded device.
+  devices::Eigen dev1(0, true, 1);
+  devices::Eigen dev4(0, true, 4);
+  const Shape shape({256, 255}, 3);
+  const Shape shape_nobatch({256, 255});
+  const vector<float> x_data = dev1.random_uniform(shape, -1, 1).to_vector();
+  const vector<float> a_data =
+    dev1.random_uniform(shape_nobatch, -1, 1).to_vector();
+  const vector<float> c_data =
+    dev1.random_uniform(Shape({3, 3, 16, 8}), -1, 1).to_vector();
+
+  const auto run = [&](Device &dev) {
+    const Tensor x = dev.new_tensor_by_vector(shape, x_data);
+    const Tensor a = dev.new_tensor_by_vector(shape_nobatch, a_data);
+    const Tensor k = dev.new_tensor_by_vector(Shape({}, 3), {1, 2, 3});
+    const Tensor xc = dev.new_tensor_by_vector(
+        Shape({64, 48, 16}, 3), vector<float>(x_data.begin(),
+          x_data.begin() + 64 * 48 * 16 * 3));
+    const Tensor wc = dev.new_tensor_by_vector({3, 3, 16, 8}, c_data);
+    const Tensor wc5 = dev.new_tensor_by_vector(
+        {5, 1, 16, 8}, vector<float>(c_data.begin(), c_data.begin() + 640));
+    vector<Tensor> ys;
+    ys.emplace_back(dev.exp_fw(x));
+    ys.emplace_back(dev.multiply_const_fw(x, 3));
+    ys.emplace_back(dev.add_scalar_fw(x, k));
+    ys.emplace_back(dev.add_fw(x, a));
+    ys.emplace_back(dev.sum_fw(x, 0));
+    ys.emplace_back(dev.sum_fw(x, 1));
+    ys.emplace_back(dev.logsumexp_fw(x, 0));
+    ys.emplace_back(dev.logsumexp_fw(x, 1));
+    ys.emplace_back(dev.max_fw(x, 0));
+    ys.emplace_back(dev.max_fw(x, 1));
+    ys.emplace_back(dev.matmul_fw(dev.transpose_fw(a), x));
+    ys.emplace_back(dev.matmul_fw(x, dev.transpose_fw(a)));
+    ys.emplace_back(dev.conv2d_fw(xc, wc, 1, 1, 1, 1, 1, 1));
+    ys.emplace_back(dev.conv2d_fw(xc, wc5, 2, 0, 1, 1, 1, 1));
+
+    const Tensor y = ys[0];
+    Tensor gx = dev.new_tensor_by_constant(shape, 1);
+    dev.exp_bw(x, y, x, gx);
+    ys.emplace_back(gx);
+
+    const Tensor at = dev.transpose_fw(a);
+    const Tensor xx = dev.matmul_fw(x, at);
+    Tensor gx2 = dev.new_tensor_by_constant(shape, 0);
+    Tensor ga = dev.new_tensor_by_constant(at.shape(), 0);
+    dev.matmul_bw(x, at, xx, xx, gx2, ga);
+    ys.emplace_back(gx2);
+    ys.emplace_back(ga);
+    Tensor ga2 = dev.new_tensor_by_constant(shape_nobatch, 0);
+    Tensor gx3 = dev.new_tensor_by_constant(Shape({255, 256}, 3), 0);
+    const Tensor ax = dev.matmul_fw(a, dev.transpose_fw(x));
+    dev.matmul_bw(a, dev.transpose_fw(x), ax, ax, ga2, gx3);
+    ys.emplace_back(ga2);
+
+    // Many small products with a shared right-hand side.
+    const Tensor xs = dev.new_tensor_by_vector(
+        Shape({16, 32}, 64),
+        vector<float>(x_data.begin(), x_data.begin() + 16 * 32 * 64));
+    const Tensor as = dev.new_tensor_by_vector(
+        {32, 16}, vector<float>(a_data.begin(), a_data.begin() + 32 * 16));
+    const Tensor xas = dev.matmul_fw(xs, as);
+    ys.emplace_back(xas);
+    Tensor gxs = dev.new_tensor_by_constant(xs.shape(), 0);
+    Tensor gas = dev.new_tensor_by_constant(as.shape(), 0);
+    dev.matmul_bw(xs, as, xas, xas, gxs, gas);
+    ys.emplace_back(gxs);
+    ys.emplace_back(gas);
+
+    vector<vector<float>> results;
+    for (const Tensor &t : ys) results.emplace_back(t.to_vector());
+    return results;
+  };
+
+  const vector<vector<float>> expected = run(dev1);
+  const vector<vector<float>> observed = run(dev4);
+  ASSERT_EQ(expected.size(), observed.size());
+  for (std::uint32_t i = 0; i < expected.size(); ++i) {
+    EXPECT_TRUE(vector_near(expected[i], observed[i], 1e-3)) << "i=" << i;
+  }
+}
+
 }  // namespace primitiv
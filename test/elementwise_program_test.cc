@@ -0,0 +1,144 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <primitiv/core/elementwise_program.h>
+#include <primitiv/core/error.h>
+
+#include <test_utils.h>
+
+using std::vector;
+using test_utils::vector_near;
+
+namespace primitiv {
+
+class ElementwiseProgramTest : public testing::Test {};
+
+using Opcode = ElementwiseProgram::Opcode;
+
+TEST_F(ElementwiseProgramTest, CheckNew) {
+  const ElementwiseProgram program(3);
+  EXPECT_EQ(3u, program.num_inputs());
+  EXPECT_EQ(3u, program.num_registers());
+  EXPECT_TRUE(program.instructions().empty());
+
+  EXPECT_THROW(ElementwiseProgram(0), Error);
+  EXPECT_THROW(ElementwiseProgram(ElementwiseProgram::MAX_REGISTERS), Error);
+}
+
+TEST_F(ElementwiseProgramTest, CheckAddInstruction) {
+  ElementwiseProgram program(2);
+  EXPECT_EQ(2u, program.add_instruction(Opcode::ADD, 0, 1));
+  EXPECT_EQ(3u, program.add_instruction(Opcode::EXP, 2));
+  EXPECT_EQ(4u, program.add_instruction(Opcode::MULTIPLY_CONST, 3, 0, 2));
+  EXPECT_EQ(5u, program.num_registers());
+  EXPECT_THROW(program.add_instruction(Opcode::ADD, 0, 5), Error);
+  EXPECT_THROW(program.add_instruction(Opcode::NEGATE, 5), Error);
+  EXPECT_EQ(5u, program.num_registers());
+
+  for (std::uint32_t i = program.num_registers();
+      i < ElementwiseProgram::MAX_REGISTERS; ++i) {
+    EXPECT_EQ(i, program.add_instruction(Opcode::NEGATE, i - 1));
+  }
+  EXPECT_THROW(program.add_instruction(Opcode::NEGATE, 0), Error);
+}
+
+TEST_F(ElementwiseProgramTest, CheckForward) {
+  // y = exp(a * b) - 2 * a, where `b` is broadcasted.
+  ElementwiseProgram program(2);
+  const std::uint32_t ab = program.add_instruction(Opcode::MULTIPLY, 0, 1);
+  const std::uint32_t e = program.add_instruction(Opcode::EXP, ab);
+  const std::uint32_t a2 = program.add_instruction(
+      Opcode::MULTIPLY_CONST, 0, 0, 2);
+  program.add_instruction(Opcode::SUBTRACT, e, a2);
+
+  const vector<float> a {0, 1, 2, 3};
+  const vector<float> b {1, -1};
+  vector<float> y(4);
+  program.forward({a.data(), b.data()}, {2, 0}, 2, 2, y.data());
+
+  const vector<float> expected {
+    1, std::exp(-1.f) - 2, std::exp(2.f) - 4, std::exp(-3.f) - 6,
+  };
+  EXPECT_TRUE(vector_near(expected, y, 1e-6));
+
+  const ElementwiseProgram empty(1);
+  EXPECT_THROW(empty.forward({a.data()}, {2}, 2, 2, y.data()), Error);
+}
+
+TEST_F(ElementwiseProgramTest, CheckBackward) {
+  // y = a * a / b, where `b` is broadcasted.
+  ElementwiseProgram program(2);
+  const std::uint32_t aa = program.add_instruction(Opcode::MULTIPLY, 0, 0);
+  program.add_instruction(Opcode::DIVIDE, aa, 1);
+
+  const vector<float> a {1, 2, 3, 4};
+  const vector<float> b {2, 4};
+  const vector<float> y {.5, 1, 4.5, 4};
+  const vector<float> gy {1, 1, 1, -1};
+  vector<float> ga {1, 1, 1, 1};
+  vector<float> gb {0, 0};
+  program.backward(
+      {a.data(), b.data()}, {2, 0}, 2, 2, y.data(), gy.data(),
+      {ga.data(), gb.data()});
+
+  // ga += 2a/b * gy, gb += -a^2/b^2 * gy (summed over minibatches).
+  const vector<float> expected_ga {2, 2, 4, -1};
+  const vector<float> expected_gb {-.25 - 2.25, -.25 + 1};
+  EXPECT_TRUE(vector_near(expected_ga, ga, 1e-6));
+  EXPECT_TRUE(vector_near(expected_gb, gb, 1e-6));
+}
+
+TEST_F(ElementwiseProgramTest, CheckMultipleBlocks) {
+  // y = tanh(a * b + a), where `b` may be broadcasted.
+  ElementwiseProgram program(2);
+  const std::uint32_t ab = program.add_instruction(Opcode::MULTIPLY, 0, 1);
+  const std::uint32_t aba = program.add_instruction(Opcode::ADD, ab, 0);
+  program.add_instruction(Opcode::TANH, aba);
+
+  // Volumes are larger than the block, and not multiples of it.
+  for (const std::uint32_t volume : {1u, 1000u, 2345u}) {
+    for (const bool broadcast : {false, true}) {
+      const std::uint32_t bs = 3;
+      const std::uint32_t skip_b = broadcast ? 0 : volume;
+      vector<float> a(volume * bs), b(broadcast ? volume : volume * bs);
+      for (std::uint32_t i = 0; i < a.size(); ++i) a[i] = .01 * (i % 201) - 1;
+      for (std::uint32_t i = 0; i < b.size(); ++i) b[i] = .02 * (i % 97) - 1;
+
+      vector<float> y(volume * bs);
+      program.forward(
+          {a.data(), b.data()}, {volume, skip_b}, volume, bs, y.data());
+      vector<float> expected_y(volume * bs);
+      vector<float> expected_ga(volume * bs, 1);
+      vector<float> expected_gb(b.size(), 1);
+      for (std::uint32_t n = 0; n < bs; ++n) {
+        for (std::uint32_t i = 0; i < volume; ++i) {
+          const float aa = a[n * volume + i];
+          const float bb = b[n * skip_b + i];
+          const float yy = std::tanh(aa * bb + aa);
+          const float g = (1 - yy * yy) * -.5;
+          expected_y[n * volume + i] = yy;
+          expected_ga[n * volume + i] += g * (bb + 1);
+          expected_gb[n * skip_b + i] += g * aa;
+        }
+      }
+      EXPECT_TRUE(vector_near(expected_y, y, 1e-6))
+        << "volume: " << volume << ", broadcast: " << broadcast;
+
+      const vector<float> gy(volume * bs, -.5);
+      vector<float> ga(a.size(), 1), gb(b.size(), 1);
+      program.backward(
+          {a.data(), b.data()}, {volume, skip_b}, volume, bs, y.data(),
+          gy.data(), {ga.data(), gb.data()});
+      EXPECT_TRUE(vector_near(expected_ga, ga, 1e-5))
+        << "volume: " << volume << ", broadcast: " << broadcast;
+      EXPECT_TRUE(vector_near(expected_gb, gb, 1e-5))
+        << "volume: " << volume << ", broadcast: " << broadcast;
+    }
+  }
+}
+
+}  // namespace primitiv
@@ -11,6 +11,7 @@
 #include <primitiv/core/initializer_impl.h>
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/core/operator_impl.h>
+#include <primitiv/core/optimizer_impl.h>
 #include <primitiv/core/parameter.h>
 
 #include <test_utils.h>
@@ -21,6 +22,47 @@ using test_utils::vector_near;
 
 namespace primitiv {
 
+namespace {
+
+// Operator to count the number of forward calculations: y = 2x.
+class CountedDouble : public Operator {
+public:
+  explicit CountedDouble(std::uint32_t &count) : count_(count) {}
+  std::string name() const override { return "CountedDouble"; }
+  std::uint32_t num_arguments() const override { return 1; }
+  std::uint32_t num_returns() const override { return 1; }
+  bool has_inner_values() const override { return false; }
+  void forward_shape(
+      const vector<const Shape *> &args,
+      const vector<Shape *> &rets) const override {
+    *rets[0] = *args[0];
+  }
+  void forward(
+      const vector<const Tensor *> &args,
+      const vector<Tensor *> &rets) const override {
+    ++count_;
+    *rets[0] = 2 * *args[0];
+  }
+  void backward(
+      const vector<const Tensor *> &args_v,
+      const vector<const Tensor *> &rets_v,
+      const vector<const Tensor *> &rets_g,
+      const vector<Tensor *> &args_g) const override {
+    static_cast<void>(args_v);
+    static_cast<void>(rets_v);
+    *args_g[0] += 2 * *rets_g[0];
+  }
+private:
+  std::uint32_t &count_;
+};
+
+Node counted_double(const Node &x, std::uint32_t &count) {
+  return x.graph().add_operator(
+      std::unique_ptr<Operator>(new CountedDouble(count)), {x})[0];
+}
+
+}  // namespace
+
 class GraphTest : public testing::Test {
 protected:
   devices::Naive dev;
@@ -359,6 +401,570 @@ TEST_F(GraphTest, CheckMultipleReturnValues) {
   EXPECT_THROW(functions::split(x, 0, 2), Error);
 }
 
+TEST_F(GraphTest, CheckDeepGraph) {
+  Device::set_default(dev);
+
+  Graph g;
+  Graph::set_default(g);
+
+  // The forward calculation should not consume the stack for each operator.
+  const std::uint32_t depth = 100000;
+  const Node x = functions::input<Node>({}, {0});
+  Node y = x;
+  for (std::uint32_t i = 0; i < depth; ++i) {
+    y = y + 1;
+  }
+  EXPECT_EQ(depth + 1, g.num_operators());
+  EXPECT_FLOAT_EQ(depth, y.to_float());
+  EXPECT_NO_THROW(y.backward());
+}
+
+TEST_F(GraphTest, CheckInferenceMode) {
+  Device::set_default(dev);
+
+  Graph g;
+  Graph::set_default(g);
+
+  EXPECT_FALSE(g.inference_mode());
+  g.set_inference_mode(true);
+  EXPECT_TRUE(g.inference_mode());
+
+  std::uint32_t count = 0;
+  const Node x = functions::input<Node>({2}, {1, 2});
+  const Node a = counted_double(x, count);
+  const Node b = a + 1;
+  const Node y = b * a;
+
+  EXPECT_TRUE(vector_match(vector<float> {6, 20}, y.to_vector()));
+  EXPECT_EQ(1u, count);
+
+  // The requested value is retained.
+  EXPECT_TRUE(vector_match(vector<float> {6, 20}, y.to_vector()));
+  EXPECT_EQ(1u, count);
+
+  // The intermediate value was released and is recalculated.
+  EXPECT_TRUE(vector_match(vector<float> {2, 4}, a.to_vector()));
+  EXPECT_EQ(2u, count);
+
+  // Now the value is retained.
+  const Node z = a * 3;
+  EXPECT_TRUE(vector_match(vector<float> {6, 12}, z.to_vector()));
+  EXPECT_EQ(2u, count);
+
+  EXPECT_THROW(y.backward(), Error);
+  EXPECT_THROW(g.set_inference_mode(false), Error);
+  g.clear();
+  EXPECT_NO_THROW(g.set_inference_mode(false));
+  EXPECT_FALSE(g.inference_mode());
+}
+
+TEST_F(GraphTest, CheckInferenceModeMultipleNodes) {
+  Device::set_default(dev);
+
+  Graph g;
+  Graph::set_default(g);
+  g.set_inference_mode(true);
+
+  std::uint32_t count = 0;
+  const Node x = functions::input<Node>({2}, {1, 2});
+  const Node a = counted_double(x, count);
+  const Node b = a + 1;
+  const Node c = a * 2;
+
+  const vector<const Tensor *> ys = g.forward(vector<Node> {b, c});
+  ASSERT_EQ(2u, ys.size());
+  EXPECT_TRUE(vector_match(vector<float> {3, 5}, ys[0]->to_vector()));
+  EXPECT_TRUE(vector_match(vector<float> {4, 8}, ys[1]->to_vector()));
+  EXPECT_EQ(1u, count);
+
+  // Values with uncalculated consumers are retained.
+  const Node d = counted_double(x, count);
+  const Node e = d + 1;
+  const Node f = d * 2;
+  EXPECT_TRUE(vector_match(vector<float> {3, 5}, e.to_vector()));
+  EXPECT_EQ(2u, count);
+  EXPECT_TRUE(vector_match(vector<float> {4, 8}, f.to_vector()));
+  EXPECT_EQ(2u, count);
+
+  // `d` was released after calculating `f`.
+  EXPECT_TRUE(vector_match(vector<float> {2, 4}, d.to_vector()));
+  EXPECT_EQ(3u, count);
+}
+
+TEST_F(GraphTest, CheckMemoryPlanning) {
+  Device::set_default(dev);
+
+  Parameter pw({2, 2}, {1, -1, 2, 3});
+  Parameter pb({2}, {-1, 1});
+  const vector<float> x_data {1, 2, 3, -4};
+
+  // Calculates the reference results without the memory planning.
+  vector<float> y_expected, gw_expected, gb_expected;
+  {
+    Graph g;
+    Graph::set_default(g);
+    const Node w = functions::parameter<Node>(pw);
+    const Node b = functions::parameter<Node>(pb);
+    const Node x = functions::input<Node>(Shape({2}, 2), x_data);
+    const Node h = functions::tanh(functions::matmul(w, x) + b);
+    const Node y = functions::batch::sum(functions::sum(h * h, 0));
+    pw.reset_gradient();
+    pb.reset_gradient();
+    y_expected = y.to_vector();
+    y.backward();
+    gw_expected = pw.gradient().to_vector();
+    gb_expected = pb.gradient().to_vector();
+  }
+
+  Graph g;
+  Graph::set_default(g);
+  EXPECT_FALSE(g.memory_planning());
+  g.set_memory_planning(true);
+  EXPECT_TRUE(g.memory_planning());
+  EXPECT_EQ(0u, g.get_planned_memory_size(dev));
+
+  std::uint32_t count = 0;
+  const Node w = functions::parameter<Node>(pw);
+  const Node b = functions::parameter<Node>(pb);
+  const Node x = functions::input<Node>(Shape({2}, 2), x_data);
+  const Node a = counted_double(x, count) / 2;
+  const Node h = functions::tanh(functions::matmul(w, a) + b);
+  const Node y = functions::batch::sum(functions::sum(h * h, 0));
+  pw.reset_gradient();
+  pb.reset_gradient();
+
+  EXPECT_TRUE(vector_near(y_expected, y.to_vector(), 1e-6));
+  EXPECT_EQ(1u, count);
+  const std::size_t planned = g.get_planned_memory_size(dev);
+  EXPECT_LT(0u, planned);
+  EXPECT_EQ(0u, planned % 64);
+  EXPECT_LE(planned, dev.memory_arena_size());
+  EXPECT_EQ(0u, g.get_planned_memory_size(dev2));
+
+  y.backward();
+  EXPECT_TRUE(vector_near(gw_expected, pw.gradient().to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(gb_expected, pb.gradient().to_vector(), 1e-6));
+  EXPECT_EQ(1u, count);
+
+  // The retained value is still available.
+  EXPECT_TRUE(vector_near(y_expected, y.to_vector(), 1e-6));
+  EXPECT_EQ(1u, count);
+
+  // Intermediate values were released by backward() and are recalculated.
+  y.backward();
+  EXPECT_EQ(2u, count);
+  for (float &v : gw_expected) v *= 2;
+  for (float &v : gb_expected) v *= 2;
+  EXPECT_TRUE(vector_near(gw_expected, pw.gradient().to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(gb_expected, pb.gradient().to_vector(), 1e-6));
+}
+
+TEST_F(GraphTest, CheckAssignGradients) {
+  Device::set_default(dev);
+
+  Parameter pw({2, 2}, {1, -1, 2, 3});
+  Parameter pb({2}, {-1, 1});
+  const vector<float> x_data {1, 2, 3, -4};
+
+  // Gradients without filling 0 should be equal to those with the memory
+  // planning, which always initializes gradients by 0.
+  vector<float> gw[2], gb[2];
+  for (std::uint32_t i = 0; i < 2; ++i) {
+    Graph g;
+    Graph::set_default(g);
+    g.set_memory_planning(i == 1);
+    const Node w = functions::parameter<Node>(pw);
+    const Node b = functions::parameter<Node>(pb);
+    const Node x = functions::input<Node>(Shape({2}, 2), x_data);
+    const Node h = functions::matmul(w, x) + b;
+    const Node u = functions::concat({h + h, -h, h - x}, 0);
+    const Node y = functions::batch::sum(functions::sum(u * u, 0));
+    pw.reset_gradient();
+    pb.reset_gradient();
+    y.backward();
+    gw[i] = pw.gradient().to_vector();
+    gb[i] = pb.gradient().to_vector();
+  }
+  EXPECT_TRUE(vector_near(gw[1], gw[0], 1e-6));
+  EXPECT_TRUE(vector_near(gb[1], gb[0], 1e-6));
+}
+
+TEST_F(GraphTest, CheckMemoryPlanningReusesArena) {
+  Device::set_default(dev);
+
+  Parameter pw({4, 4}, initializers::Constant(1));
+
+  std::size_t planned = 0;
+  std::size_t arena_size = 0;
+  for (std::uint32_t step = 0; step < 3; ++step) {
+    Graph g;
+    Graph::set_default(g);
+    g.set_memory_planning(true);
+    const Node w = functions::parameter<Node>(pw);
+    const Node x = functions::input<Node>({4}, {1, 2, 3, 4});
+    const Node y = functions::sum(functions::matmul(w, x) * 2, 0);
+    pw.reset_gradient();
+
+    EXPECT_TRUE(vector_match(vector<float> {80}, y.to_vector()));
+    y.backward();
+    EXPECT_TRUE(vector_match(
+          vector<float> {2, 2, 2, 2, 4, 4, 4, 4, 6, 6, 6, 6, 8, 8, 8, 8},
+          pw.gradient().to_vector()));
+
+    if (step == 0) {
+      planned = g.get_planned_memory_size(dev);
+      arena_size = dev.memory_arena_size();
+    } else {
+      // Same graphs have the same plan and reuse the same arena.
+      EXPECT_EQ(planned, g.get_planned_memory_size(dev));
+      EXPECT_EQ(arena_size, dev.memory_arena_size());
+    }
+  }
+}
+
+TEST_F(GraphTest, CheckReplay) {
+  Device::set_default(dev);
+
+  Parameter pw({2, 2}, {1, 2, 3, 4});
+  optimizers::SGD optimizer(.1);
+  optimizer.add(pw);
+
+  const vector<vector<float>> inputs {{1, 2}, {3, -1}, {0, 5}};
+
+  // Calculates the reference results by constructing graphs at every step.
+  vector<vector<float>> expected_y, expected_w;
+  for (const vector<float> &input : inputs) {
+    Graph g;
+    Graph::set_default(g);
+    const Node w = functions::parameter<Node>(pw);
+    const Node x = functions::input<Node>({2}, input);
+    const Node y = functions::sum(functions::matmul(w, x), 0);
+    expected_y.emplace_back(y.to_vector());
+    optimizer.reset_gradients();
+    y.backward();
+    optimizer.update();
+    expected_w.emplace_back(pw.value().to_vector());
+  }
+
+  // Replays the same graph.
+  pw.value().reset_by_vector({1, 2, 3, 4});
+  Graph g;
+  Graph::set_default(g);
+  std::uint32_t count = 0;
+  const Node w = functions::parameter<Node>(pw);
+  const Node x = functions::input<Node>({2}, {0, 0});
+  const Node a = counted_double(x, count) / 2;
+  const Node y = functions::sum(functions::matmul(w, a), 0);
+  const std::uint32_t num_ops = g.num_operators();
+  for (std::uint32_t i = 0; i < inputs.size(); ++i) {
+    g.discard_values();
+    g.set_input(x, inputs[i]);
+    EXPECT_TRUE(vector_match(expected_y[i], y.to_vector()));
+    optimizer.reset_gradients();
+    y.backward();
+    optimizer.update();
+    EXPECT_TRUE(vector_match(expected_w[i], pw.value().to_vector()));
+    EXPECT_EQ(i + 1, count);
+  }
+  EXPECT_EQ(num_ops, g.num_operators());
+
+  // Only values depending on the input are recalculated.
+  const Node z = counted_double(w, count);
+  EXPECT_NO_THROW(z.to_vector());
+  EXPECT_EQ(4u, count);
+  g.set_input(x, {1, 1});
+  EXPECT_NO_THROW(z.to_vector());
+  EXPECT_NO_THROW(y.to_vector());
+  EXPECT_EQ(5u, count);
+
+  EXPECT_THROW(g.set_input(x, {1, 2, 3}), Error);
+  EXPECT_THROW(g.set_input(y, {1}), Error);
+  EXPECT_THROW(g.set_input(w, {1, 2, 3, 4}), Error);
+}
+
+TEST_F(GraphTest, CheckInputTensor) {
+  Device::set_default(dev);
+  Graph g;
+  Graph::set_default(g);
+
+  // Values in the external memory are used without copying.
+  vector<float> data {1, 2};
+  const Tensor t = dev.new_tensor_by_external_memory({2}, &data[0]);
+  Parameter p({2}, {1, 1});
+  p.reset_gradient();
+  const Node x = functions::input<Node>(t);
+  const Node y = x * x * functions::parameter<Node>(p);
+  data[1] = 3;
+  EXPECT_TRUE(vector_match(vector<float> {1, 9}, y.to_vector()));
+  y.backward();
+  EXPECT_TRUE(vector_match(vector<float> {1, 9}, p.gradient().to_vector()));
+
+  // Replaces the value with other tensors or data.
+  vector<float> data2 {4, 5};
+  g.set_input(x, dev.new_tensor_by_external_memory({2}, &data2[0]));
+  EXPECT_TRUE(vector_match(vector<float> {16, 25}, y.to_vector()));
+  g.set_input(x, {6, 7});
+  EXPECT_TRUE(vector_match(vector<float> {36, 49}, y.to_vector()));
+  g.set_input(x, t);
+  EXPECT_TRUE(vector_match(vector<float> {1, 9}, y.to_vector()));
+
+  EXPECT_THROW(g.set_input(x, dev.new_tensor_by_constant({3}, 0)), Error);
+  EXPECT_THROW(g.set_input(x, dev2.new_tensor_by_constant({2}, 0)), Error);
+  EXPECT_THROW(g.set_input(y, t), Error);
+}
+
+TEST_F(GraphTest, CheckReplayInferenceMode) {
+  Device::set_default(dev);
+
+  Graph g;
+  Graph::set_default(g);
+  g.set_inference_mode(true);
+
+  std::uint32_t count = 0;
+  const Node x = functions::input<Node>({2}, {1, 2});
+  const Node a = counted_double(x, count);
+  const Node y = a * a;
+
+  EXPECT_TRUE(vector_match(vector<float> {4, 16}, y.to_vector()));
+  EXPECT_EQ(1u, count);
+
+  g.set_input(x, {3, 4});
+  EXPECT_TRUE(vector_match(vector<float> {36, 64}, y.to_vector()));
+  EXPECT_EQ(2u, count);
+
+  g.discard_values();
+  EXPECT_TRUE(vector_match(vector<float> {36, 64}, y.to_vector()));
+  EXPECT_EQ(3u, count);
+}
+
+TEST_F(GraphTest, CheckConcurrentExecution) {
+  // Runs the same graph with several numbers of threads.
+  vector<vector<float>> ys, gxs, gws;
+  for (const std::uint32_t num_threads : {1u, 2u, 4u}) {
+    devices::Naive dev(12345);
+    Device::set_default(dev);
+
+    Graph g;
+    Graph::set_default(g);
+    EXPECT_EQ(1u, g.num_threads());
+    g.set_num_threads(num_threads);
+    EXPECT_EQ(num_threads, g.num_threads());
+
+    Parameter pw({4, 4}, {
+        .1, .2, .3, .4, -.1, -.2, -.3, -.4,
+        .5, .6, .7, .8, -.5, -.6, -.7, -.8});
+    Parameter px({4}, {1, -2, 3, -4});
+    const Node w = functions::parameter<Node>(pw);
+    const Node x = functions::parameter<Node>(px);
+
+    // Independent branches sharing the same arguments.
+    vector<Node> branches;
+    for (std::uint32_t i = 0; i < 8; ++i) {
+      const Node r = functions::random::bernoulli<Node>({4}, .5);
+      const Node h = functions::tanh(functions::matmul(w, x * (i + 1))) * r;
+      branches.emplace_back(functions::matmul(w, h));
+    }
+    const Node y = functions::sum(functions::sum(branches), 0);
+
+    pw.reset_gradient();
+    px.reset_gradient();
+    ys.emplace_back(y.to_vector());
+    y.backward();
+    gxs.emplace_back(px.gradient().to_vector());
+    gws.emplace_back(pw.gradient().to_vector());
+  }
+
+  for (std::uint32_t i = 1; i < ys.size(); ++i) {
+    EXPECT_TRUE(vector_match(ys[0], ys[i]));
+    EXPECT_TRUE(vector_match(gxs[0], gxs[i]));
+    EXPECT_TRUE(vector_match(gws[0], gws[i]));
+  }
+
+  Graph g;
+  EXPECT_THROW(g.set_num_threads(0), Error);
+}
+
+TEST_F(GraphTest, CheckCheckpoint) {
+  Device::set_default(dev);
+
+  Parameter pw({2}, {.5, -.25});
+
+  // Calculates reference results without checkpoints.
+  vector<float> expected_y, expected_g;
+  {
+    Graph g;
+    Graph::set_default(g);
+    const Node w = functions::parameter<Node>(pw);
+    Node h = w;
+    for (std::uint32_t i = 0; i < 6; ++i) {
+      h = functions::tanh(h * w + 1);
+    }
+    const Node y = functions::sum(h, 0);
+    pw.reset_gradient();
+    expected_y = y.to_vector();
+    y.backward();
+    expected_g = pw.gradient().to_vector();
+  }
+
+  // Makes 3 segments with 2 steps.
+  Graph g;
+  Graph::set_default(g);
+  std::uint32_t count = 0;
+  const Node w = functions::parameter<Node>(pw);
+  Node h = w;
+  vector<Node> cps;
+  for (std::uint32_t i = 0; i < 6; ++i) {
+    h = functions::tanh(counted_double(h, count) / 2 * w + 1);
+    if (i % 2 == 1) {
+      h = functions::checkpoint(h);
+      cps.emplace_back(h);
+    }
+  }
+  const Node y = functions::sum(h, 0);
+
+  pw.reset_gradient();
+  EXPECT_TRUE(vector_match(expected_y, y.to_vector()));
+  EXPECT_EQ(6u, count);
+
+  // Checkpoints are retained.
+  for (const Node &cp : cps) {
+    EXPECT_NO_THROW(cp.to_vector());
+  }
+  EXPECT_EQ(6u, count);
+
+  // Each segment is recalculated once.
+  y.backward();
+  EXPECT_EQ(12u, count);
+  EXPECT_TRUE(vector_near(expected_g, pw.gradient().to_vector(), 1e-6));
+
+  // Released values are recalculated again.
+  pw.reset_gradient();
+  y.backward();
+  EXPECT_EQ(18u, count);
+  EXPECT_TRUE(vector_near(expected_g, pw.gradient().to_vector(), 1e-6));
+  EXPECT_TRUE(vector_match(expected_y, y.to_vector()));
+  EXPECT_EQ(18u, count);
+}
+
+TEST_F(GraphTest, CheckOperatorFusion) {
+  Device::set_default(dev);
+
+  // Runs the same graph with/without the operator fusion.
+  vector<vector<float>> ys, zs, hs, gxs, gws;
+  for (const bool fusion : {false, true}) {
+    for (const std::uint32_t num_threads : {1u, 2u}) {
+      Graph g;
+      Graph::set_default(g);
+      EXPECT_FALSE(g.operator_fusion());
+      g.set_operator_fusion(fusion);
+      EXPECT_EQ(fusion, g.operator_fusion());
+      g.set_num_threads(num_threads);
+
+      Parameter pw({2, 2}, {.1, -.2, .3, -.4});
+      Parameter px({2}, {.5, -1.5});
+      const Node w = functions::parameter<Node>(pw);
+      const Node x = functions::parameter<Node>(px);
+      const Node a = functions::input<Node>(Shape({2}, 3), {1, 2, 3, 4, 5, 6});
+
+      // `h` is used twice and is never absorbed.
+      const Node h = functions::tanh(x * a + 1);
+      const Node u = functions::sigmoid(h) * 2 - functions::relu(-h) / a;
+      const Node v = functions::elu(functions::softplus(u) - 1, .5)
+        + functions::exp(functions::abs(x) * -1) * functions::sqrt(a)
+        + functions::lrelu(functions::sin(h) + functions::cos(x * x));
+      const Node y = functions::matmul(w, v);
+      const Node z = functions::log(3 / (1 + functions::abs(y)));
+      const Node loss = functions::batch::sum(functions::sum(z, 0));
+
+      pw.reset_gradient();
+      px.reset_gradient();
+      ys.emplace_back(y.to_vector());
+      zs.emplace_back(z.to_vector());
+      loss.backward();
+      gxs.emplace_back(px.gradient().to_vector());
+      gws.emplace_back(pw.gradient().to_vector());
+
+      // Absorbed nodes are still available.
+      hs.emplace_back(u.to_vector());
+
+      // Replays the fused graph.
+      g.discard_values();
+      EXPECT_TRUE(vector_match(zs.back(), z.to_vector()));
+    }
+  }
+
+  for (std::uint32_t i = 1; i < ys.size(); ++i) {
+    EXPECT_TRUE(vector_near(ys[0], ys[i], 1e-6));
+    EXPECT_TRUE(vector_near(zs[0], zs[i], 1e-6));
+    EXPECT_TRUE(vector_near(hs[0], hs[i], 1e-6));
+    EXPECT_TRUE(vector_near(gxs[0], gxs[i], 1e-5));
+    EXPECT_TRUE(vector_near(gws[0], gws[i], 1e-5));
+  }
+}
+
+TEST_F(GraphTest, CheckProfiler) {
+  Device::set_default(dev);
+
+  Graph g;
+  Graph::set_default(g);
+  EXPECT_FALSE(g.profiling());
+
+  const auto count = [](const std::string &str, const std::string &pattern) {
+    std::uint32_t ret = 0;
+    for (auto pos = str.find(pattern);
+        pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+      ++ret;
+    }
+    return ret;
+  };
+
+  Parameter pw({2, 2}, {1, 2, 3, 4});
+  const Node w = functions::parameter<Node>(pw);
+  const Node x = functions::input<Node>({2}, {1, -1});
+  const Node y = functions::sum(functions::tanh(functions::matmul(w, x)), 0);
+
+  // Nothing is recorded while the profiler is disabled.
+  y.to_float();
+  EXPECT_EQ(0u, count(g.dump("trace"), "\"ph\": \"X\""));
+  g.discard_values();
+
+  g.set_profiling(true);
+  EXPECT_TRUE(g.profiling());
+  y.to_float();
+  y.backward();
+  g.set_profiling(false);
+  EXPECT_FALSE(g.profiling());
+  y.backward();
+
+  // 4 forward operations (except the parameter) and 5 backward operations.
+  const std::string trace = g.dump("trace");
+  EXPECT_EQ(
+      0u, trace.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["));
+  EXPECT_EQ(9u, count(trace, "\"ph\": \"X\""));
+  EXPECT_EQ(4u, count(trace, "\"cat\": \"forward\""));
+  EXPECT_EQ(5u, count(trace, "\"cat\": \"backward\""));
+  EXPECT_EQ(2u, count(trace, "\"name\": \"MatrixMultiply\""));
+  EXPECT_EQ(
+      2u,
+      count(
+        trace,
+        "\"inputs\": [\"[2,2]x1\",\"[2]x1\"], \"outputs\": [\"[2]x1\"]"));
+  // The input operator allocates 2 floats.
+  EXPECT_NE(std::string::npos, trace.find("\"bytes\": 8}"));
+
+  const std::string profile = g.dump("profile");
+  EXPECT_EQ(0u, profile.find("Operators: 9, "));
+  EXPECT_EQ(4u, count(profile, "forward   Naive@"));
+  EXPECT_EQ(5u, count(profile, "backward  Naive@"));
+  EXPECT_EQ(2u, count(profile, "MatrixMultiply([2,2]x1,[2]x1) -> [2]x1"));
+  EXPECT_EQ(2u, count(profile, "Tanh([2]x1) -> [2]x1"));
+
+  g.clear_profile();
+  EXPECT_EQ(0u, count(g.dump("trace"), "\"ph\": \"X\""));
+  EXPECT_EQ(0u, g.dump("profile").find("Operators: 0, "));
+  EXPECT_THROW(g.dump("unknown"), Error);
+}
+
 TEST_F(GraphTest, CheckXor) {
   Device::set_default(dev);
 
@@ -645,4 +1251,185 @@ TEST_F(GraphTest, CheckConcatLSTM) {
 #endif
 }
 
+TEST_F(GraphTest, CheckFusedLSTM) {
+  Device::set_default(dev);
+
+  // Same LSTM as "CheckConcatLSTM" using the fused cell.
+  Parameter pWx({8, 2}, {
+      .3, .1, .4, .1, .5, .9, .2, .6,
+      .5, .3, .5, .8, .9, .7, .9, .3});
+  Parameter pWh({8, 2}, {
+      .2, .3, .8, .4, .6, .2, .6, .4,
+      .3, .3, .8, .3, .2, .7, .9, .5});
+  Parameter pb({8}, {.1, -.1, .2, -.2, .3, -.3, .4, -.4});
+
+  Graph g;
+  Graph::set_default(g);
+
+  namespace batch = functions::batch;
+  using functions::matmul;
+  using functions::input;
+  using functions::parameter;
+  using functions::sigmoid;
+  using functions::slice;
+  using functions::sum;
+  using functions::tanh;
+  using functions::zeros;
+
+  const Node x = input<Node>(Shape({2}, 2), {2, -2, 0.5, -0.5});
+  const Node h = input<Node>(Shape({2}, 2), {-1, 1, -0.5, 0.5});
+  const Node c = input<Node>({2}, {.5, -.5});
+  const Node Wx = parameter<Node>(pWx);
+  const Node Wh = parameter<Node>(pWh);
+  const Node b = parameter<Node>(pb);
+
+  const Node u = matmul(Wx, x) + matmul(Wh, h);
+  const vector<Node> hc = functions::lstm_cell(u, b, c);
+  const Node sum_loss1 = batch::sum(sum(hc[0] * hc[0] + hc[1], 0));
+
+  const Node a = u + b;
+  const Node i = sigmoid(slice(a, 0, 0, 2));
+  const Node f = sigmoid(slice(a, 0, 2, 4));
+  const Node o = sigmoid(slice(a, 0, 4, 6));
+  const Node j = tanh(slice(a, 0, 6, 8));
+  const Node cc = f * c + i * j;
+  const Node hh = o * tanh(cc);
+  const Node sum_loss2 = batch::sum(sum(hh * hh + cc, 0));
+
+  EXPECT_TRUE(vector_near(hh.to_vector(), hc[0].to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(cc.to_vector(), hc[1].to_vector(), 1e-6));
+
+  const auto grads = [&](const Node &loss) {
+    pWx.reset_gradient();
+    pWh.reset_gradient();
+    pb.reset_gradient();
+    loss.backward();
+    return vector<vector<float>> {
+      pWx.gradient().to_vector(),
+      pWh.gradient().to_vector(),
+      pb.gradient().to_vector(),
+    };
+  };
+  const vector<vector<float>> expected = grads(sum_loss2);
+  const vector<vector<float>> actual = grads(sum_loss1);
+  for (std::uint32_t k = 0; k < expected.size(); ++k) {
+    EXPECT_TRUE(vector_near(expected[k], actual[k], 1e-5));
+  }
+}
+
+TEST_F(GraphTest, CheckFusedSRU) {
+  Device::set_default(dev);
+
+  Parameter pw({6, 2}, {
+      .3, .1, .4, .1, .5, .9, .2, .6, .5, .3, .5, .8});
+  Parameter pb({4}, {.1, -.1, .2, -.2});
+
+  Graph g;
+  Graph::set_default(g);
+
+  namespace batch = functions::batch;
+  using functions::broadcast;
+  using functions::input;
+  using functions::matmul;
+  using functions::parameter;
+  using functions::sigmoid;
+  using functions::slice;
+  using functions::sum;
+  using functions::tanh;
+
+  const Node x = input<Node>(
+      Shape({2, 3}, 2), {2, -2, .5, -.5, 1, 0, -1, 1, -.5, .5, 0, 1});
+  const Node w = parameter<Node>(pw);
+  const Node b = parameter<Node>(pb);
+  const Node u = matmul(w, x);
+
+  const vector<Node> hc = functions::sru(x, u, b);
+  const Node sum_loss1 = batch::sum(sum(sum(hc[0] * hc[0] + hc[1], 0), 1));
+
+  // Same SRU built from basic functions.
+  const Node f = sigmoid(
+      slice(u, 0, 2, 4) + broadcast(slice(b, 0, 0, 2), 1, 3));
+  const Node r = sigmoid(
+      slice(u, 0, 4, 6) + broadcast(slice(b, 0, 2, 4), 1, 3));
+  vector<Node> cs;
+  for (std::uint32_t t = 0; t < 3; ++t) {
+    const Node ft = slice(f, 1, t, t + 1);
+    const Node jt = slice(slice(u, 0, 0, 2), 1, t, t + 1);
+    cs.emplace_back(t > 0 ? ft * cs.back() + (1 - ft) * jt : (1 - ft) * jt);
+  }
+  const Node c = functions::concat(cs, 1);
+  const Node h = r * tanh(c) + (1 - r) * x;
+  const Node sum_loss2 = batch::sum(sum(sum(h * h + c, 0), 1));
+
+  EXPECT_TRUE(vector_near(h.to_vector(), hc[0].to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(c.to_vector(), hc[1].to_vector(), 1e-6));
+
+  const auto grads = [&](const Node &loss) {
+    pw.reset_gradient();
+    pb.reset_gradient();
+    loss.backward();
+    return vector<vector<float>> {
+      pw.gradient().to_vector(),
+      pb.gradient().to_vector(),
+    };
+  };
+  const vector<vector<float>> expected = grads(sum_loss2);
+  const vector<vector<float>> actual = grads(sum_loss1);
+  for (std::uint32_t k = 0; k < expected.size(); ++k) {
+    EXPECT_TRUE(vector_near(expected[k], actual[k], 1e-5));
+  }
+}
+
+TEST_F(GraphTest, CheckFusedAttention) {
+  Device::set_default(dev);
+
+  Parameter pq({2, 3}, {1, -1, .5, 2, 0, 1});
+  Parameter pk({2, 4}, {.5, 1, -1, .2, 2, -.5, 0, 1});
+  Parameter pv({3, 4}, {1, 2, 3, -1, 0, 1, .5, .5, 2, -2, 1, 0});
+
+  Graph g;
+  Graph::set_default(g);
+
+  using functions::input;
+  using functions::matmul;
+  using functions::parameter;
+  using functions::softmax;
+  using functions::sum;
+  using functions::transpose;
+
+  const Node x = input<Node>(
+      Shape({2, 3}, 2), {1, 0, -1, 1, .5, .5, 0, 1, 2, -1, 1, 1});
+  const Node q = parameter<Node>(pq) * x;
+  const Node k = parameter<Node>(pk);
+  const Node v = parameter<Node>(pv);
+  const Node mask = input<Node>(
+      {4, 3}, {0, -1, 0, 1, -2, 0, .5, 0, 0, 0, 0, -1});
+
+  const Node y1 = functions::attention(q, k, v, mask, .5);
+  const Node sum_loss1 = functions::batch::sum(sum(sum(y1 * y1, 0), 1));
+
+  // Same attention built from basic functions.
+  const Node y2 = matmul(v, softmax(matmul(transpose(k), q) * .5 + mask, 0));
+  const Node sum_loss2 = functions::batch::sum(sum(sum(y2 * y2, 0), 1));
+
+  EXPECT_TRUE(vector_near(y2.to_vector(), y1.to_vector(), 1e-6));
+
+  const auto grads = [&](const Node &loss) {
+    pq.reset_gradient();
+    pk.reset_gradient();
+    pv.reset_gradient();
+    loss.backward();
+    return vector<vector<float>> {
+      pq.gradient().to_vector(),
+      pk.gradient().to_vector(),
+      pv.gradient().to_vector(),
+    };
+  };
+  const vector<vector<float>> expected = grads(sum_loss2);
+  const vector<vector<float>> actual = grads(sum_loss1);
+  for (std::uint32_t i = 0; i < expected.size(); ++i) {
+    EXPECT_TRUE(vector_near(expected[i], actual[i], 1e-5));
+  }
+}
+
 }  // namespace primitiv
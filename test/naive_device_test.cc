@@ -1,6 +1,7 @@
 #include <primitiv/config.h>
 
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include <vector>
 
@@ -19,7 +20,15 @@ using test_utils::vector_near;
 
 namespace primitiv {
 
-class NaiveDeviceTest : public testing::Test {};
+class NaiveDeviceTest : public testing::Test {
+protected:
+  // Helper to observe internal memories of tensors.
+  class NaiveWithHandle : public devices::Naive {
+  public:
+    using devices::Naive::Naive;
+    static const void *handle(const Tensor &x) { return get_handle(x); }
+  };
+};
 
 TEST_F(NaiveDeviceTest, CheckDeviceType) {
   devices::Naive dev;
@@ -56,6 +65,189 @@ TEST_F(NaiveDeviceTest, CheckDanglingTensor) {
   SUCCEED();
 }
 
+TEST_F(NaiveDeviceTest, CheckMemoryPool) {
+  NaiveWithHandle dev;
+  EXPECT_TRUE(dev.uses_memory_pool());
+  const void *p1;
+  {
+    const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}), 0);
+    p1 = NaiveWithHandle::handle(x);
+  }
+  {
+    // The released block is supplied again for the same size class.
+    const Tensor x = dev.new_tensor_by_constant(Shape({3, 5}), 0);
+    EXPECT_EQ(p1, NaiveWithHandle::handle(x));
+  }
+  dev.trim();
+  {
+    const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}), 1);
+    EXPECT_TRUE(vector_match(vector<float>(16, 1), x.to_vector()));
+  }
+}
+
+TEST_F(NaiveDeviceTest, CheckWithoutMemoryPool) {
+  NaiveWithHandle dev(12345, false);
+  EXPECT_FALSE(dev.uses_memory_pool());
+  dev.trim();  // Does nothing.
+  const Tensor x = dev.new_tensor_by_constant(Shape({4, 4}, 3), 2);
+  EXPECT_TRUE(vector_match(vector<float>(48, 2), x.to_vector()));
+}
+
+TEST_F(NaiveDeviceTest, CheckAlignment) {
+  for (const bool use_pool : {true, false}) {
+    NaiveWithHandle dev(12345, use_pool);
+    for (const Shape &s : {Shape(), Shape({3}), Shape({5, 7}, 3)}) {
+      const Tensor x = dev.new_tensor_by_constant(s, 0);
+      EXPECT_EQ(0u,
+          reinterpret_cast<std::uintptr_t>(NaiveWithHandle::handle(x)) % 64);
+    }
+  }
+}
+
+TEST_F(NaiveDeviceTest, CheckMemoryArena) {
+  NaiveWithHandle dev;
+  EXPECT_TRUE(dev.supports_memory_arena());
+  EXPECT_EQ(0u, dev.memory_arena_size());
+  EXPECT_THROW(dev.place_next_tensor(0, 4), Error);
+
+  dev.reserve_memory_arena(256);
+  EXPECT_LE(256u, dev.memory_arena_size());
+  EXPECT_THROW(dev.place_next_tensor(192, 32), Error);
+
+  // Placed tensors share the arena.
+  ASSERT_TRUE(dev.place_next_tensor(0, 4));
+  ASSERT_TRUE(dev.place_next_tensor(64, 8));
+  const Tensor x = dev.new_tensor_by_constant({8}, 1);
+  const Tensor y = dev.new_tensor_by_constant({4}, 2);
+  const char *base = static_cast<const char *>(NaiveWithHandle::handle(y));
+  EXPECT_EQ(base + 64, NaiveWithHandle::handle(x));
+  EXPECT_TRUE(vector_match(vector<float>(8, 1), x.to_vector()));
+  EXPECT_TRUE(vector_match(vector<float>(4, 2), y.to_vector()));
+
+  // Overlapping regions are refused while they are in use.
+  EXPECT_FALSE(dev.place_next_tensor(32, 16));
+  EXPECT_TRUE(dev.place_next_tensor(128, 16));
+  dev.discard_placements();
+
+  // Tensors without placements are allocated as usual.
+  const Tensor z = dev.new_tensor_by_constant({4}, 3);
+  EXPECT_NE(base, NaiveWithHandle::handle(z));
+
+  // The arena is not reused while some tensors are placed on it.
+  const std::size_t size = dev.memory_arena_size();
+  dev.reserve_memory_arena(size);
+  ASSERT_TRUE(dev.place_next_tensor(0, 4));
+  const Tensor w = dev.new_tensor_by_constant({4}, 4);
+  EXPECT_NE(base, NaiveWithHandle::handle(w));
+  EXPECT_TRUE(vector_match(vector<float>(4, 2), y.to_vector()));
+
+  dev.release_memory_arena();
+  EXPECT_EQ(0u, dev.memory_arena_size());
+  EXPECT_TRUE(vector_match(vector<float>(4, 4), w.to_vector()));
+}
+
+TEST_F(NaiveDeviceTest, CheckCopyTensorInto) {
+  NaiveWithHandle dev;
+  const Tensor x = dev.new_tensor_by_vector(Shape({2, 2}), {1, 2, 3, 4});
+  Tensor y = dev.new_tensor_by_constant(Shape({2, 2}), 0);
+  const void *py = NaiveWithHandle::handle(y);
+
+  // The memory is reused.
+  dev.copy_tensor(x, y);
+  EXPECT_EQ(py, NaiveWithHandle::handle(y));
+  EXPECT_NE(NaiveWithHandle::handle(x), NaiveWithHandle::handle(y));
+  EXPECT_TRUE(vector_match(vector<float> {1, 2, 3, 4}, y.to_vector()));
+
+  // The shared memory is not overwritten.
+  const Tensor y2 = y;
+  dev.copy_tensor(dev.multiply_const_fw(x, 2), y);
+  EXPECT_NE(py, NaiveWithHandle::handle(y));
+  EXPECT_TRUE(vector_match(vector<float> {2, 4, 6, 8}, y.to_vector()));
+  EXPECT_TRUE(vector_match(vector<float> {1, 2, 3, 4}, y2.to_vector()));
+
+  // Other shapes and invalid tensors are newly allocated.
+  Tensor y3 = dev.new_tensor_by_constant(Shape({4}), 0);
+  dev.copy_tensor(x, y3);
+  EXPECT_EQ(Shape({2, 2}), y3.shape());
+  EXPECT_TRUE(vector_match(vector<float> {1, 2, 3, 4}, y3.to_vector()));
+  Tensor y4;
+  dev.copy_tensor(x, y4);
+  EXPECT_TRUE(vector_match(vector<float> {1, 2, 3, 4}, y4.to_vector()));
+}
+
+TEST_F(NaiveDeviceTest, CheckTensorViews) {
+  NaiveWithHandle dev;
+  EXPECT_TRUE(dev.supports_tensor_views());
+  const Tensor x = dev.new_tensor_by_vector(
+      Shape({2, 3}, 2), {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  const float *base = static_cast<const float *>(NaiveWithHandle::handle(x));
+
+  // Contiguous regions share the memory.
+  const Tensor y1 = dev.batch_slice_fw(x, 1, 2);
+  EXPECT_EQ(base + 6, NaiveWithHandle::handle(y1));
+  EXPECT_TRUE(vector_match(
+        vector<float> {7, 8, 9, 10, 11, 12}, y1.to_vector()));
+
+  const Tensor y2 = dev.slice_fw(y1, 1, 1, 3);
+  EXPECT_EQ(base + 8, NaiveWithHandle::handle(y2));
+  EXPECT_TRUE(vector_match(vector<float> {9, 10, 11, 12}, y2.to_vector()));
+
+  // Other regions are copied.
+  const Tensor y3 = dev.slice_fw(x, 1, 1, 3);
+  EXPECT_NE(base + 2, NaiveWithHandle::handle(y3));
+  EXPECT_TRUE(vector_match(
+        vector<float> {3, 4, 5, 6, 9, 10, 11, 12}, y3.to_vector()));
+  const Tensor y4 = dev.slice_fw(x, 0, 0, 1);
+  EXPECT_NE(base, NaiveWithHandle::handle(y4));
+  EXPECT_TRUE(vector_match(vector<float> {1, 3, 5, 7, 9, 11}, y4.to_vector()));
+
+  // Updating views does not affect the original memory, and vice versa.
+  Tensor y5 = y2;
+  y5.inplace_multiply_const(-1);
+  EXPECT_TRUE(vector_match(vector<float> {-9, -10, -11, -12}, y5.to_vector()));
+  EXPECT_TRUE(vector_match(vector<float> {9, 10, 11, 12}, y2.to_vector()));
+  Tensor x2 = x;
+  x2.reset(0);
+  EXPECT_TRUE(vector_match(
+        vector<float> {7, 8, 9, 10, 11, 12}, y1.to_vector()));
+  EXPECT_EQ(base, NaiveWithHandle::handle(x));
+}
+
+TEST_F(NaiveDeviceTest, CheckTensorViewFallbacks) {
+  NaiveWithHandle dev;
+  const Tensor x = dev.new_tensor_by_vector(
+      Shape({4, 2}, 2),
+      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+  const float *base = static_cast<const float *>(NaiveWithHandle::handle(x));
+
+  // Reshaping always shares the memory.
+  const Tensor y1 = x.reshape(Shape({8}, 2));
+  EXPECT_EQ(base, NaiveWithHandle::handle(y1));
+
+  // Transposition is always copied.
+  const Tensor y2 = dev.transpose_fw(x);
+  EXPECT_NE(base, NaiveWithHandle::handle(y2));
+  EXPECT_TRUE(vector_match(
+        vector<float> {1, 5, 2, 6, 3, 7, 4, 8, 9, 13, 10, 14, 11, 15, 12, 16},
+        y2.to_vector()));
+
+  // Splitting the gates of a minibatch is copied, but splitting each
+  // minibatch is a view.
+  const Tensor u = dev.new_tensor_by_vector(
+      Shape({4}, 2), {1, 2, 3, 4, 5, 6, 7, 8});
+  const float *pu = static_cast<const float *>(NaiveWithHandle::handle(u));
+  for (std::uint32_t i = 0; i < 4; ++i) {
+    const Tensor g = dev.slice_fw(u, 0, i, i + 1);
+    EXPECT_NE(pu + i, NaiveWithHandle::handle(g));
+    EXPECT_TRUE(vector_match(
+          vector<float> {i + 1.f, i + 5.f}, g.to_vector()));
+    const Tensor u1 = dev.batch_slice_fw(u, 1, 2);
+    const Tensor g1 = dev.slice_fw(u1, 0, i, i + 1);
+    EXPECT_EQ(pu + 4 + i, NaiveWithHandle::handle(g1));
+    EXPECT_TRUE(vector_match(vector<float> {i + 5.f}, g1.to_vector()));
+  }
+}
+
 #ifdef PRIMITIV_BUILD_TESTS_PROBABILISTIC
 TEST_F(NaiveDeviceTest, CheckRandomBernoulli) {
   vector<vector<float>> history;
@@ -226,4 +418,121 @@ TEST_F(NaiveDeviceTest, CheckRandomLogNormalWithSeed) {
 #endif
 }
 
+TEST_F(NaiveDeviceTest, CheckNumThreads) {
+  {
+    devices::Naive dev;
+    EXPECT_EQ(1u, dev.num_threads());
+  }
+  for (const std::uint32_t n : {1u, 2u, 4u}) {
+    devices::Naive dev(0, true, n);
+    EXPECT_EQ(n, dev.num_threads());
+  }
+  EXPECT_THROW(devices::Naive(0, true, 0), Error);
+}
+
+TEST_F(NaiveDeviceTest, CheckMultiThreadedOperations) {
+  // Tensors are large enough to be split into several chunks, and results
+  // should be equal to those of the single-threaded device.
+  devices::Naive dev1(0, true, 1);
+  devices::Naive dev4(0, true, 4);
+  const Shape shape({256, 255}, 3);
+  const Shape shape_nobatch({256, 255});
+  const vector<float> x_data = dev1.random_uniform(shape, -1, 1).to_vector();
+  const vector<float> a_data =
+    dev1.random_uniform(shape_nobatch, -1, 1).to_vector();
+  const vector<float> c_data =
+    dev1.random_uniform(Shape({3, 3, 16, 8}), -1, 1).to_vector();
+
+  const auto run = [&](Device &dev) {
+    const Tensor x = dev.new_tensor_by_vector(shape, x_data);
+    const Tensor a = dev.new_tensor_by_vector(shape_nobatch, a_data);
+    const Tensor k = dev.new_tensor_by_vector(Shape({}, 3), {1, 2, 3});
+    const Tensor xc = dev.new_tensor_by_vector(
+        Shape({64, 48, 16}, 3), vector<float>(x_data.begin(),
+          x_data.begin() + 64 * 48 * 16 * 3));
+    const Tensor wc = dev.new_tensor_by_vector({3, 3, 16, 8}, c_data);
+    const Tensor wc5 = dev.new_tensor_by_vector(
+        {5, 1, 16, 8}, vector<float>(c_data.begin(), c_data.begin() + 640));
+    vector<Tensor> ys;
+    ys.emplace_back(dev.exp_fw(x));
+    ys.emplace_back(dev.multiply_const_fw(x, 3));
+    ys.emplace_back(dev.add_scalar_fw(x, k));
+    ys.emplace_back(dev.add_fw(x, a));
+    ys.emplace_back(dev.sum_fw(x, 0));
+    ys.emplace_back(dev.sum_fw(x, 1));
+    ys.emplace_back(dev.logsumexp_fw(x, 0));
+    ys.emplace_back(dev.logsumexp_fw(x, 1));
+    ys.emplace_back(dev.max_fw(x, 0));
+    ys.emplace_back(dev.max_fw(x, 1));
+    ys.emplace_back(dev.matmul_fw(dev.transpose_fw(a), x));
+    ys.emplace_back(dev.matmul_fw(x, dev.transpose_fw(a)));
+    ys.emplace_back(dev.conv2d_fw(xc, wc, 1, 1, 1, 1, 1, 1));
+    ys.emplace_back(dev.conv2d_fw(xc, wc5, 2, 0, 1, 1, 1, 1));
+
+    const Tensor y = ys[0];
+    Tensor gx = dev.new_tensor_by_constant(shape, 1);
+    dev.exp_bw(x, y, x, gx);
+    ys.emplace_back(gx);
+
+    const Tensor at = dev.transpose_fw(a);
+    const Tensor xx = dev.matmul_fw(x, at);
+    Tensor gx2 = dev.new_tensor_by_constant(shape, 0);
+    Tensor ga = dev.new_tensor_by_constant(at.shape(), 0);
+    dev.matmul_bw(x, at, xx, xx, gx2, ga);
+    ys.emplace_back(gx2);
+    ys.emplace_back(ga);
+    Tensor ga2 = dev.new_tensor_by_constant(shape_nobatch, 0);
+    Tensor gx3 = dev.new_tensor_by_constant(Shape({255, 256}, 3), 0);
+    const Tensor ax = dev.matmul_fw(a, dev.transpose_fw(x));
+    dev.matmul_bw(a, dev.transpose_fw(x), ax, ax, ga2, gx3);
+    ys.emplace_back(ga2);
+
+    // Many small products with a shared right-hand side.
+    const Tensor xs = dev.new_tensor_by_vector(
+        Shape({16, 32}, 64),
+        vector<float>(x_data.begin(), x_data.begin() + 16 * 32 * 64));
+    const Tensor as = dev.new_tensor_by_vector(
+        {32, 16}, vector<float>(a_data.begin(), a_data.begin() + 32 * 16));
+    const Tensor xas = dev.matmul_fw(xs, as);
+    ys.emplace_back(xas);
+    Tensor gxs = dev.new_tensor_by_constant(xs.shape(), 0);
+    Tensor gas = dev.new_tensor_by_constant(as.shape(), 0);
+    dev.matmul_bw(xs, as, xas, xas, gxs, gas);
+    ys.emplace_back(gxs);
+    ys.emplace_back(gas);
+
+    // Binary backward operations with and without broadcasting.
+    const Tensor x2 = dev.exp_fw(x);
+    const Tensor xx2 = dev.multiply_fw(x, x2);
+    Tensor gm1 = dev.new_tensor_by_constant(shape, 1);
+    Tensor gm2 = dev.new_tensor_by_constant(shape, 1);
+    dev.multiply_bw(x, x2, xx2, x, gm1, gm2);
+    ys.emplace_back(gm1);
+    ys.emplace_back(gm2);
+    const Tensor xa = dev.pow_fw(x2, a);
+    Tensor gp1 = dev.new_tensor_by_constant(shape, 0);
+    Tensor gp2 = dev.new_tensor_by_constant(shape_nobatch, 0);
+    dev.pow_bw(x2, a, xa, x, gp1, gp2);
+    ys.emplace_back(gp1);
+    ys.emplace_back(gp2);
+    const Tensor x2x = dev.pow_fw(x2, x);
+    Tensor gp3 = dev.new_tensor_by_constant(shape, 0);
+    Tensor gp4 = dev.new_tensor_by_constant(shape, 0);
+    dev.pow_bw(x2, x, x2x, x, gp3, gp4);
+    ys.emplace_back(gp3);
+    ys.emplace_back(gp4);
+
+    vector<vector<float>> results;
+    for (const Tensor &t : ys) results.emplace_back(t.to_vector());
+    return results;
+  };
+
+  const vector<vector<float>> expected = run(dev1);
+  const vector<vector<float>> observed = run(dev4);
+  ASSERT_EQ(expected.size(), observed.size());
+  for (std::uint32_t i = 0; i < expected.size(); ++i) {
+    EXPECT_TRUE(vector_near(expected[i], observed[i], 1e-3)) << "i=" << i;
+  }
+}
+
 }  // namespace primitiv
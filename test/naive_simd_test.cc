@@ -0,0 +1,283 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <primitiv/devices/naive/ops/simd.h>
+
+#include <test_utils.h>
+
+using std::vector;
+
+namespace primitiv {
+namespace devices {
+namespace simd {
+
+class NaiveSimdTest : public testing::Test {
+protected:
+  // Vectorized kernels supported by the running CPU, and their reference.
+  vector<const Kernels *> targets;
+  const Kernels *ref;
+  std::mt19937 rng;
+
+  void SetUp() override {
+    for (const InstructionSet isa : {
+        InstructionSet::NEON,
+        InstructionSet::AVX2,
+        InstructionSet::AVX512,
+    }) {
+      const Kernels *ks = get_kernels(isa);
+      if (ks) targets.emplace_back(ks);
+    }
+    ref = get_kernels(InstructionSet::SCALAR);
+    ASSERT_NE(nullptr, ref);
+    rng.seed(12345);
+  }
+
+  // Number of elements in each test. Intentionally not a multiple of any
+  // vector width to check the remainders.
+  static constexpr std::size_t N = 4099;
+
+  vector<float> make_uniform(float lower, float upper) {
+    std::uniform_real_distribution<float> dist(lower, upper);
+    vector<float> ret(N);
+    for (float &x : ret) x = dist(rng);
+    return ret;
+  }
+
+  // Positive values distributed uniformly in the logarithmic scale,
+  // including subnormals.
+  vector<float> make_positive() {
+    std::uniform_real_distribution<float> dist(-140, 127);
+    vector<float> ret(N);
+    for (float &x : ret) x = std::exp2(dist(rng));
+    return ret;
+  }
+
+  // Values whose absolute values are in [lower, upper].
+  vector<float> make_nonzero(float lower, float upper) {
+    std::uniform_real_distribution<float> dist(lower, upper);
+    std::bernoulli_distribution sign(.5);
+    vector<float> ret(N);
+    for (float &x : ret) x = sign(rng) ? dist(rng) : -dist(rng);
+    return ret;
+  }
+};
+
+constexpr std::size_t NaiveSimdTest::N;
+
+namespace {
+
+// Checks the ULP-based accuracy of vectorized kernels. Values with small
+// absolute errors are also accepted because some formulas of the scalar
+// kernels lose relative accuracy around zero.
+testing::AssertionResult accurate(
+    const vector<float> &expected, const vector<float> &actual,
+    int max_ulps, float max_abs_err) {
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (!test_utils::float_eq(expected[i], actual[i], max_ulps) &&
+        !test_utils::float_near(expected[i], actual[i], max_abs_err)) {
+      return testing::AssertionFailure()
+        << "expected[" << i << "]: " << expected[i]
+        << " != actual[" << i << "]: " << actual[i]
+        << " diff: " << test_utils::float_ulp_diff(expected[i], actual[i]);
+    }
+  }
+  return testing::AssertionSuccess();
+}
+
+}  // namespace
+
+TEST_F(NaiveSimdTest, CheckSelectedKernels) {
+  const Kernels &ks = kernels();
+  EXPECT_EQ(&ks, get_kernels(ks.isa));
+  for (const Kernels *target : targets) {
+    // The widest instruction set should be selected.
+    EXPECT_GE(static_cast<int>(ks.isa), static_cast<int>(target->isa));
+  }
+}
+
+TEST_F(NaiveSimdTest, CheckUnary) {
+  struct TestCase {
+    decltype(&Kernels::exp_fw) fw;
+    decltype(&Kernels::exp_bw) bw;
+    vector<float> x;
+    int max_ulps;
+    float max_abs_err;
+  };
+  const vector<TestCase> test_cases {
+    {&Kernels::negate_fw, nullptr, make_uniform(-100, 100), 0, 0},
+    {&Kernels::abs_fw, &Kernels::abs_bw, make_uniform(-100, 100), 0, 0},
+    {&Kernels::sqrt_fw, &Kernels::sqrt_bw, make_positive(), 1, 0},
+    {&Kernels::exp_fw, &Kernels::exp_bw, make_uniform(-110, 90), 2, 0},
+    {&Kernels::log_fw, &Kernels::log_bw, make_positive(), 2, 0},
+    {&Kernels::tanh_fw, &Kernels::tanh_bw, make_uniform(-10, 10), 4, 1e-7},
+    {&Kernels::sigmoid_fw, &Kernels::sigmoid_bw,
+      make_uniform(-30, 30), 4, 2e-7},
+    {&Kernels::softplus_fw, &Kernels::softplus_bw,
+      make_uniform(-30, 30), 4, 2e-7},
+  };
+  const vector<float> gy = make_uniform(-1, 1);
+  const vector<float> gx = make_uniform(-1, 1);
+
+  for (const TestCase &tc : test_cases) {
+    vector<float> y_ref(N), gx_ref = gx;
+    (ref->*tc.fw)(&tc.x[0], &y_ref[0], N);
+    if (tc.bw) (ref->*tc.bw)(&tc.x[0], &y_ref[0], &gy[0], &gx_ref[0], N);
+
+    for (const Kernels *target : targets) {
+      vector<float> y(N), gx_target = gx;
+      (target->*tc.fw)(&tc.x[0], &y[0], N);
+      EXPECT_TRUE(accurate(y_ref, y, tc.max_ulps, tc.max_abs_err))
+        << target->name;
+      if (tc.bw) {
+        // Uses the reference of y to check bw independently.
+        (target->*tc.bw)(&tc.x[0], &y_ref[0], &gy[0], &gx_target[0], N);
+        EXPECT_TRUE(accurate(gx_ref, gx_target, 4, 1e-6)) << target->name;
+      }
+    }
+  }
+}
+
+TEST_F(NaiveSimdTest, CheckUnaryWithSpecialValues) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float denorm = std::numeric_limits<float>::denorm_min();
+  const vector<float> x {
+    0, -0.f, 1, -1, inf, -inf, nan, denorm, -denorm,
+    88.7f, 89, 100, -87.3f, -100, -104, -200,
+  };
+  const std::size_t n = x.size();
+  for (const auto fw : {
+      &Kernels::negate_fw, &Kernels::abs_fw, &Kernels::sqrt_fw,
+      &Kernels::exp_fw, &Kernels::log_fw, &Kernels::tanh_fw,
+      &Kernels::sigmoid_fw, &Kernels::softplus_fw,
+  }) {
+    vector<float> y_ref(n);
+    (ref->*fw)(&x[0], &y_ref[0], n);
+    for (const Kernels *target : targets) {
+      vector<float> y(n);
+      (target->*fw)(&x[0], &y[0], n);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (std::isnan(y_ref[i])) {
+          EXPECT_TRUE(std::isnan(y[i]))
+            << target->name << ", x: " << x[i] << ", y: " << y[i];
+        } else {
+          EXPECT_TRUE(
+              test_utils::float_eq(y_ref[i], y[i], 2) ||
+              test_utils::float_near(y_ref[i], y[i], 1e-7))
+            << target->name << ", x: " << x[i]
+            << ", expected: " << y_ref[i] << ", actual: " << y[i];
+        }
+      }
+    }
+  }
+}
+
+TEST_F(NaiveSimdTest, CheckConst) {
+  struct TestCase {
+    decltype(&Kernels::add_const_fw) fw;
+    decltype(&Kernels::add_const_bw) bw;
+    vector<float> x;
+  };
+  const vector<TestCase> test_cases {
+    {&Kernels::add_const_fw, &Kernels::add_const_bw, make_uniform(-10, 10)},
+    {&Kernels::subtract_const_r_fw, &Kernels::subtract_const_r_bw,
+      make_uniform(-10, 10)},
+    {&Kernels::subtract_const_l_fw, &Kernels::subtract_const_l_bw,
+      make_uniform(-10, 10)},
+    {&Kernels::multiply_const_fw, &Kernels::multiply_const_bw,
+      make_uniform(-10, 10)},
+    {&Kernels::divide_const_r_fw, &Kernels::divide_const_r_bw,
+      make_uniform(-10, 10)},
+    {&Kernels::divide_const_l_fw, &Kernels::divide_const_l_bw,
+      make_nonzero(.1, 10)},
+    {&Kernels::prelu_fw, &Kernels::prelu_bw, make_uniform(-10, 10)},
+    {&Kernels::elu_fw, &Kernels::elu_bw, make_uniform(-10, 10)},
+  };
+  const vector<float> gy = make_uniform(-1, 1);
+  const vector<float> gx = make_uniform(-1, 1);
+
+  for (const TestCase &tc : test_cases) {
+    for (const float k : {-2.5f, .5f, 3.f}) {
+      vector<float> y_ref(N), gx_ref = gx;
+      (ref->*tc.fw)(&tc.x[0], k, &y_ref[0], N);
+      (ref->*tc.bw)(&tc.x[0], &y_ref[0], &gy[0], k, &gx_ref[0], N);
+
+      for (const Kernels *target : targets) {
+        vector<float> y(N), gx_target = gx;
+        (target->*tc.fw)(&tc.x[0], k, &y[0], N);
+        (target->*tc.bw)(&tc.x[0], &y_ref[0], &gy[0], k, &gx_target[0], N);
+        EXPECT_TRUE(accurate(y_ref, y, 2, 1e-6))
+          << target->name << ", k: " << k;
+        EXPECT_TRUE(accurate(gx_ref, gx_target, 2, 1e-6))
+          << target->name << ", k: " << k;
+      }
+    }
+  }
+}
+
+TEST_F(NaiveSimdTest, CheckBinary) {
+  const vector<float> a = make_uniform(-10, 10);
+  const vector<float> b = make_nonzero(.1, 10);
+  const vector<float> gy = make_uniform(-1, 1);
+  const vector<float> ga = make_uniform(-1, 1);
+  const vector<float> gb = make_uniform(-1, 1);
+
+  for (const auto &fw_bw : {
+      std::make_pair(&Kernels::add_fw, &Kernels::add_bw),
+      std::make_pair(&Kernels::subtract_fw, &Kernels::subtract_bw),
+      std::make_pair(&Kernels::multiply_fw, &Kernels::multiply_bw),
+      std::make_pair(&Kernels::divide_fw, &Kernels::divide_bw),
+  }) {
+    vector<float> y_ref(N), ga_ref = ga, gb_ref = gb;
+    (ref->*fw_bw.first)(&a[0], &b[0], &y_ref[0], N);
+    (ref->*fw_bw.second)(
+        &a[0], &b[0], &y_ref[0], &gy[0], &ga_ref[0], &gb_ref[0], N);
+    // Both gradients are accumulated into the same array. Values may have
+    // larger errors by cancellations.
+    vector<float> gab_ref = ga;
+    (ref->*fw_bw.second)(
+        &a[0], &b[0], &y_ref[0], &gy[0], &gab_ref[0], &gab_ref[0], N);
+
+    for (const Kernels *target : targets) {
+      vector<float> y(N), ga_target = ga, gb_target = gb, gab_target = ga;
+      (target->*fw_bw.first)(&a[0], &b[0], &y[0], N);
+      (target->*fw_bw.second)(
+          &a[0], &b[0], &y_ref[0], &gy[0], &ga_target[0], &gb_target[0], N);
+      (target->*fw_bw.second)(
+          &a[0], &b[0], &y_ref[0], &gy[0], &gab_target[0], &gab_target[0], N);
+      EXPECT_TRUE(accurate(y_ref, y, 0, 0)) << target->name;
+      EXPECT_TRUE(accurate(ga_ref, ga_target, 4, 1e-5)) << target->name;
+      EXPECT_TRUE(accurate(gb_ref, gb_target, 4, 1e-5)) << target->name;
+      EXPECT_TRUE(accurate(gab_ref, gab_target, 4, 1e-5)) << target->name;
+    }
+  }
+}
+
+TEST_F(NaiveSimdTest, CheckRemainders) {
+  // Elements out of the range should not be touched.
+  const vector<float> x = make_uniform(-1, 1);
+  for (const Kernels *target : targets) {
+    for (std::size_t n = 0; n <= 40; ++n) {
+      vector<float> y(n + 1, 42);
+      target->exp_fw(&x[0], &y[0], n);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_TRUE(test_utils::float_eq(std::exp(x[i]), y[i], 2))
+          << target->name << ", n: " << n << ", i: " << i;
+      }
+      EXPECT_EQ(42, y[n]) << target->name << ", n: " << n;
+    }
+  }
+}
+
+}  // namespace simd
+}  // namespace devices
+}  // namespace primitiv
@@ -231,6 +231,27 @@ TEST_F(OperatorImplTest, CheckInput) {
   EXPECT_TRUE(vector_match(ret_data, cur_value.to_vector()));
 }
 
+TEST_F(OperatorImplTest, CheckInputTensor) {
+  vector<float> data {1, 2, 3, 4};
+  const Tensor x = dev->new_tensor_by_external_memory({2, 2}, &data[0]);
+  Input node(x);
+  Shape cur_shape;
+  Tensor cur_value;
+  node.forward_shape(arg_shapes, { &cur_shape });
+  node.forward(arg_values, { &cur_value });
+  EXPECT_EQ("Input", node.name());
+  EXPECT_EQ(Shape({2, 2}), cur_shape);
+  EXPECT_EQ(dev, node.get_device());
+  // The value shares the memory of `x`.
+  data[0] = 5;
+  EXPECT_TRUE(vector_match(vector<float> {5, 2, 3, 4}, cur_value.to_vector()));
+
+  node.set_data({6, 7, 8, 9});
+  node.forward(arg_values, { &cur_value });
+  EXPECT_TRUE(vector_match(vector<float> {6, 7, 8, 9}, cur_value.to_vector()));
+  EXPECT_THROW(node.set_value(dev->new_tensor_by_constant({4}, 0)), Error);
+}
+
 TEST_F(OperatorImplTest, CheckParameter) {
   const Shape ret_shape {2, 2};
   const initializers::Constant init(42);
@@ -1983,6 +2004,193 @@ TEST_F(OperatorImplTest, CheckMaxPooling2D_221122) {
   EXPECT_TRUE(vector_match(bw_grads[0], arg_grads[0]->to_vector()));
 }
 
+TEST_F(OperatorImplTest, CheckLSTMCell) {
+  const Tensor u = dev->new_tensor_by_vector(
+      Shape({8}, 2), {
+        1, -1, 2, -2, .5, -.5, 0, 3,
+        -3, 2, .1, -.1, 1, 1, -1, .5,
+      });
+  const Tensor b = dev->new_tensor_by_vector(
+      {8}, {.1, .2, .3, .4, -.1, -.2, -.3, -.4});
+  const Tensor c = dev->new_tensor_by_vector({2}, {.5, -.5});
+  const vector<const Tensor *> x { &u, &b, &c };
+  const Shape u_shape = u.shape(), b_shape = b.shape(), c_shape = c.shape();
+
+  LSTMCell node;
+  Shape h_shape, c_new_shape;
+  Tensor h, c_new;
+  node.forward_shape({ &u_shape, &b_shape, &c_shape },
+      { &h_shape, &c_new_shape });
+  node.forward(x, { &h, &c_new });
+  EXPECT_EQ("LSTMCell", node.name());
+  EXPECT_EQ(Shape({2}, 2), h_shape);
+  EXPECT_EQ(Shape({2}, 2), c_new_shape);
+
+  // Results should be same as those of the composed functions.
+  using functions::slice;
+  const Tensor a = u + b;
+  const Tensor i = functions::sigmoid(slice(a, 0, 0, 2));
+  const Tensor f = functions::sigmoid(slice(a, 0, 2, 4));
+  const Tensor o = functions::sigmoid(slice(a, 0, 4, 6));
+  const Tensor j = functions::tanh(slice(a, 0, 6, 8));
+  const Tensor expected_c = i * j + f * c;
+  const Tensor expected_h = o * functions::tanh(expected_c);
+  EXPECT_TRUE(vector_near(expected_h.to_vector(), h.to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(
+        expected_c.to_vector(), c_new.to_vector(), 1e-6));
+
+  // Gradients are accumulated by the device.
+  const Tensor gh = dev->new_tensor_by_vector(Shape({2}, 2), {1, -2, .5, 3});
+  const Tensor gc_new = dev->new_tensor_by_vector(
+      Shape({2}, 2), {-1, .5, 2, 1});
+  Tensor expected_gu = functions::ones<Tensor>(u_shape, *dev);
+  Tensor expected_gb = functions::ones<Tensor>(b_shape, *dev);
+  Tensor expected_gc = functions::ones<Tensor>(c_shape, *dev);
+  dev->lstm_cell_bw(
+      u, b, c, c_new, gh, gc_new, expected_gu, expected_gb, expected_gc);
+  Tensor gu = functions::ones<Tensor>(u_shape, *dev);
+  Tensor gb = functions::ones<Tensor>(b_shape, *dev);
+  Tensor gc = functions::ones<Tensor>(c_shape, *dev);
+  node.backward(x, { &h, &c_new }, { &gh, &gc_new }, { &gu, &gb, &gc });
+  EXPECT_TRUE(vector_match(expected_gu.to_vector(), gu.to_vector()));
+  EXPECT_TRUE(vector_match(expected_gb.to_vector(), gb.to_vector()));
+  EXPECT_TRUE(vector_match(expected_gc.to_vector(), gc.to_vector()));
+}
+
+TEST_F(OperatorImplTest, CheckGRUCell) {
+  const Tensor ux = dev->new_tensor_by_vector(
+      Shape({6}, 2), {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1});
+  const Tensor uh = dev->new_tensor_by_vector({6}, {.1, .2, .3, .4, -.1, -.2});
+  const Tensor h = dev->new_tensor_by_vector({2}, {.5, -.5});
+  const vector<const Tensor *> x { &ux, &uh, &h };
+  const Shape ux_shape = ux.shape(), uh_shape = uh.shape();
+  const Shape h_shape = h.shape();
+
+  GRUCell node;
+  Shape y_shape;
+  Tensor y;
+  node.forward_shape({ &ux_shape, &uh_shape, &h_shape }, { &y_shape });
+  node.forward(x, { &y });
+  EXPECT_EQ("GRUCell", node.name());
+  EXPECT_EQ(Shape({2}, 2), y_shape);
+  EXPECT_TRUE(vector_match(
+        functions::gru_cell(ux, uh, h).to_vector(), y.to_vector()));
+
+  const Tensor gy = dev->new_tensor_by_vector(Shape({2}, 2), {1, -2, .5, 3});
+  Tensor expected_gux = functions::ones<Tensor>(ux_shape, *dev);
+  Tensor expected_guh = functions::ones<Tensor>(uh_shape, *dev);
+  Tensor expected_gh = functions::ones<Tensor>(h_shape, *dev);
+  dev->gru_cell_bw(ux, uh, h, gy, expected_gux, expected_guh, expected_gh);
+  Tensor gux = functions::ones<Tensor>(ux_shape, *dev);
+  Tensor guh = functions::ones<Tensor>(uh_shape, *dev);
+  Tensor gh = functions::ones<Tensor>(h_shape, *dev);
+  node.backward(x, { &y }, { &gy }, { &gux, &guh, &gh });
+  EXPECT_TRUE(vector_match(expected_gux.to_vector(), gux.to_vector()));
+  EXPECT_TRUE(vector_match(expected_guh.to_vector(), guh.to_vector()));
+  EXPECT_TRUE(vector_match(expected_gh.to_vector(), gh.to_vector()));
+}
+
+TEST_F(OperatorImplTest, CheckSRU) {
+  const Tensor x = dev->new_tensor_by_vector(
+      Shape({2, 2}, 2), {1, -1, 2, -2, .5, -.5, -3, 2});
+  const Tensor u = dev->new_tensor_by_vector(
+      {6, 2}, {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1});
+  const Tensor b = dev->new_tensor_by_vector({4}, {.1, .2, -.3, .4});
+  const vector<const Tensor *> xs { &x, &u, &b };
+  const Shape x_shape = x.shape(), u_shape = u.shape(), b_shape = b.shape();
+
+  SRU node;
+  Shape h_shape, c_shape;
+  Tensor h, c;
+  node.forward_shape(
+      { &x_shape, &u_shape, &b_shape }, { &h_shape, &c_shape });
+  node.forward(xs, { &h, &c });
+  EXPECT_EQ("SRU", node.name());
+  EXPECT_EQ(Shape({2, 2}, 2), h_shape);
+  EXPECT_EQ(Shape({2, 2}, 2), c_shape);
+  const vector<Tensor> expected = functions::sru(x, u, b);
+  EXPECT_TRUE(vector_match(expected[0].to_vector(), h.to_vector()));
+  EXPECT_TRUE(vector_match(expected[1].to_vector(), c.to_vector()));
+
+  const Tensor gh = dev->new_tensor_by_vector(
+      h_shape, {1, -2, .5, 3, -1, 1, 2, .5});
+  const Tensor gc = dev->new_tensor_by_vector(
+      c_shape, {.5, 0, -1, 1, .5, .5, 0, 1});
+  Tensor expected_gx = functions::ones<Tensor>(x_shape, *dev);
+  Tensor expected_gu = functions::ones<Tensor>(u_shape, *dev);
+  Tensor expected_gb = functions::ones<Tensor>(b_shape, *dev);
+  dev->sru_bw(
+      x, u, b, c, gh, gc, expected_gx, expected_gu, expected_gb);
+  Tensor gx = functions::ones<Tensor>(x_shape, *dev);
+  Tensor gu = functions::ones<Tensor>(u_shape, *dev);
+  Tensor gb = functions::ones<Tensor>(b_shape, *dev);
+  node.backward(xs, { &h, &c }, { &gh, &gc }, { &gx, &gu, &gb });
+  EXPECT_TRUE(vector_match(expected_gx.to_vector(), gx.to_vector()));
+  EXPECT_TRUE(vector_match(expected_gu.to_vector(), gu.to_vector()));
+  EXPECT_TRUE(vector_match(expected_gb.to_vector(), gb.to_vector()));
+}
+
+TEST_F(OperatorImplTest, CheckAttention) {
+  const Tensor q = dev->new_tensor_by_vector(
+      Shape({2, 3}, 2), {1, -1, .5, 2, 0, 1, -2, .5, 1, 1, -1, 0});
+  const Tensor k = dev->new_tensor_by_vector(
+      {2, 4}, {.5, 1, -1, .2, 2, -.5, 0, 1});
+  const Tensor v = dev->new_tensor_by_vector(
+      {3, 4}, {1, 2, 3, -1, 0, 1, .5, .5, 2, -2, 1, 0});
+  const Tensor mask = dev->new_tensor_by_vector(
+      {4, 3}, {0, -1, 0, 1, -2, 0, .5, 0, 0, 0, 0, -1});
+  const Shape q_shape = q.shape(), k_shape = k.shape(), v_shape = v.shape();
+  const Shape mask_shape = mask.shape();
+  const Tensor gy = dev->new_tensor_by_vector(
+      Shape({3, 3}, 2), {
+        1, -2, .5, 3, -1, 1, 2, .5, -.5,
+        1, 0, -2, .5, .5, 1, -1, 2, 0,
+      });
+  const Tensor glse = functions::zeros<Tensor>(Shape({1, 3}, 2), *dev);
+
+  for (const bool masked : {false, true}) {
+    vector<const Tensor *> x { &q, &k, &v };
+    vector<const Shape *> x_shapes { &q_shape, &k_shape, &v_shape };
+    if (masked) {
+      x.emplace_back(&mask);
+      x_shapes.emplace_back(&mask_shape);
+    }
+
+    Attention node(.5);
+    Shape y_shape, lse_shape;
+    Tensor y, lse;
+    node.forward_shape(x_shapes, { &y_shape, &lse_shape });
+    node.forward(x, { &y, &lse });
+    EXPECT_EQ("Attention(" + std::to_string(.5f) + ')', node.name());
+    EXPECT_EQ(Shape({3, 3}, 2), y_shape);
+    EXPECT_EQ(Shape({1, 3}, 2), lse_shape);
+    const Tensor expected_y = masked
+      ? functions::attention(q, k, v, mask, .5)
+      : functions::attention(q, k, v, .5);
+    EXPECT_TRUE(vector_match(expected_y.to_vector(), y.to_vector()));
+
+    Tensor expected_gq = functions::ones<Tensor>(q_shape, *dev);
+    Tensor expected_gk = functions::ones<Tensor>(k_shape, *dev);
+    Tensor expected_gv = functions::ones<Tensor>(v_shape, *dev);
+    Tensor expected_gmask = functions::ones<Tensor>(mask_shape, *dev);
+    dev->attention_bw(
+        q, k, v, masked ? &mask : nullptr, y, lse, gy, glse, .5,
+        expected_gq, expected_gk, expected_gv,
+        masked ? &expected_gmask : nullptr);
+    Tensor gq = functions::ones<Tensor>(q_shape, *dev);
+    Tensor gk = functions::ones<Tensor>(k_shape, *dev);
+    Tensor gv = functions::ones<Tensor>(v_shape, *dev);
+    Tensor gmask = functions::ones<Tensor>(mask_shape, *dev);
+    vector<Tensor *> gx { &gq, &gk, &gv };
+    if (masked) gx.emplace_back(&gmask);
+    node.backward(x, { &y, &lse }, { &gy, &glse }, gx);
+    EXPECT_TRUE(vector_match(expected_gq.to_vector(), gq.to_vector()));
+    EXPECT_TRUE(vector_match(expected_gk.to_vector(), gk.to_vector()));
+    EXPECT_TRUE(vector_match(expected_gv.to_vector(), gv.to_vector()));
+    EXPECT_TRUE(vector_match(expected_gmask.to_vector(), gmask.to_vector()));
+  }
+}
+
 TEST_F(OperatorImplTest, CheckSoftmaxCrossEntropy) {
   // y = softmax_cross_entropy(x, t, dim)
   // dy/dx = softmax(x) - t
@@ -2082,5 +2290,137 @@ TEST_F(OperatorImplTest, CheckStopGradient) {
   TEST_1ARG(StopGradient);
 }
 
+TEST_F(OperatorImplTest, CheckCheckpoint) {
+  // y = x
+  // dy/dx = 1
+  setup_1arg();
+  const Shape ret_shape({2, 2}, 3);
+  const vector<float> ret_data {1, 2, 3, 4, 0, 0, 0, 0, -1, -2, -3, -4};
+  const vector<float> bw_grad(arg_shapes[0]->size(), 1);
+  TEST_1ARG(Checkpoint);
+}
+
+TEST_F(OperatorImplTest, CheckAssignGradients) {
+  const Tensor a = dev->new_tensor_by_vector(
+      Shape({2, 2}, 3), {1, 2, 3, 4, .5, .5, .5, .5, 2, 4, 6, 8});
+  const Tensor b = dev->new_tensor_by_vector({2, 2}, {1, 2, 1, 2});
+  const Tensor k = dev->new_tensor_by_vector(Shape({}, 3), {1, 2, 3});
+
+  // Gradients assigned to invalid tensors should be equal to those added to
+  // zeros.
+  const auto check = [&](const Operator &node, const vector<const Tensor *> &x) {
+    EXPECT_TRUE(node.assigns_gradients());
+    vector<Shape> shapes;
+    vector<const Shape *> shape_ptrs;
+    for (const Tensor *xi : x) shapes.emplace_back(xi->shape());
+    for (const Shape &s : shapes) shape_ptrs.emplace_back(&s);
+    Shape ret_shape;
+    Tensor y;
+    node.forward_shape(shape_ptrs, { &ret_shape });
+    node.forward(x, { &y });
+    vector<float> gy_data(ret_shape.size());
+    for (std::uint32_t i = 0; i < gy_data.size(); ++i) gy_data[i] = i + 1;
+    const Tensor gy = dev->new_tensor_by_vector(ret_shape, gy_data);
+
+    vector<Tensor> expected, actual(x.size());
+    vector<Tensor *> expected_ptrs, actual_ptrs;
+    for (std::uint32_t i = 0; i < x.size(); ++i) {
+      expected.emplace_back(functions::zeros<Tensor>(x[i]->shape(), *dev));
+    }
+    for (std::uint32_t i = 0; i < x.size(); ++i) {
+      expected_ptrs.emplace_back(&expected[i]);
+      actual_ptrs.emplace_back(&actual[i]);
+    }
+    node.backward(x, { &y }, { &gy }, expected_ptrs);
+    node.backward(x, { &y }, { &gy }, actual_ptrs);
+    for (std::uint32_t i = 0; i < x.size(); ++i) {
+      ASSERT_TRUE(actual[i].valid());
+      EXPECT_EQ(x[i]->shape(), actual[i].shape());
+      EXPECT_TRUE(vector_near(
+            expected[i].to_vector(), actual[i].to_vector(), 1e-6));
+    }
+  };
+
+  check(Copy(*dev), { &a });
+  check(Concat(0), { &a, &b });
+  check(Reshape(Shape({4}, 3)), { &a });
+  check(Flatten(), { &a });
+  check(Positive(), { &a });
+  check(Negative(), { &a });
+  check(AddScalar(), { &a, &k });
+  check(SubtractScalarR(), { &a, &k });
+  check(SubtractScalarL(), { &a, &k });
+  check(MultiplyScalar(), { &a, &k });
+  check(DivideScalarR(), { &a, &k });
+  check(DivideScalarL(), { &a, &k });
+  check(PowScalarR(), { &a, &k });
+  check(PowScalarL(), { &a, &k });
+  check(Add(), { &a, &b });
+  check(Subtract(), { &a, &b });
+  check(Sum(1), { &a });
+  check(LogSumExp(1), { &a });
+  check(Broadcast(0, 3), { &k });
+  check(BatchConcat(), { &a, &b });
+  check(BatchSum(), { &a });
+  check(SoftmaxCrossEntropy(0), { &a, &a });
+  check(Checkpoint(), { &a });
+  check(MatrixMultiply(), { &a, &b });
+  check(MatrixMultiply(), { &b, &a });
+  check(Pick({0, 1, 0}, 1), { &a });
+  check(Pick({1}, 0), { &a });
+
+  // The same gradient given twice is assigned and then accumulated.
+  {
+    Add node;
+    Tensor y;
+    node.forward({ &a, &a }, { &y });
+    const Tensor gy = functions::ones<Tensor>(y.shape(), *dev);
+    Tensor ga;
+    node.backward({ &a, &a }, { &y }, { &gy }, { &ga, &ga });
+    EXPECT_TRUE(vector_match(vector<float>(12, 2), ga.to_vector()));
+    EXPECT_TRUE(vector_match(vector<float>(12, 1), gy.to_vector()));
+  }
+
+  // The same argument given twice to MatrixMultiply.
+  {
+    MatrixMultiply node;
+    Tensor y;
+    node.forward({ &b, &b }, { &y });
+    const Tensor gy = functions::ones<Tensor>(y.shape(), *dev);
+    Tensor gb;
+    Tensor expected = functions::zeros<Tensor>(b.shape(), *dev);
+    node.backward({ &b, &b }, { &y }, { &gy }, { &gb, &gb });
+    node.backward({ &b, &b }, { &y }, { &gy }, { &expected, &expected });
+    EXPECT_TRUE(vector_near(expected.to_vector(), gb.to_vector(), 1e-6));
+  }
+
+  // Other operators require initialized gradients.
+  EXPECT_FALSE(Multiply().assigns_gradients());
+  EXPECT_FALSE(Slice(0, 0, 1).assigns_gradients());
+}
+
+TEST_F(OperatorImplTest, CheckLookup) {
+  primitiv::Parameter param({2, 3}, {1, 2, 3, 4, 5, 6}, *dev);
+  param.reset_gradient();
+
+  Lookup node(param, {2, 0}, 1);
+  Shape cur_shape;
+  Tensor cur_value;
+  node.forward_shape(arg_shapes, { &cur_shape });
+  node.forward(arg_values, { &cur_value });
+  const Tensor cur_grad = dev->new_tensor_by_vector(
+      Shape({2}, 2), {1, 2, 3, 4});
+  // backward() adds a sparse gradient to `param`.
+  EXPECT_NO_THROW(node.backward(
+        arg_values, { &cur_value }, { &cur_grad }, arg_grads));
+  EXPECT_EQ("Lookup(1)", node.name());
+  EXPECT_EQ(Shape({2}, 2), cur_shape);
+  EXPECT_EQ(dev, node.get_device());
+  EXPECT_TRUE(vector_match({5, 6, 1, 2}, cur_value.to_vector()));
+  EXPECT_TRUE(param.has_sparse_gradient());
+  EXPECT_TRUE(vector_match(
+        {3, 4, 0, 0, 1, 2}, param.gradient().to_vector()));
+}
+
 }  // namespace operators
 }  // namespace primitiv
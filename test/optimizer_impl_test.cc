@@ -1,10 +1,12 @@
 #include <primitiv/config.h>
 
+#include <cmath>
 #include <cstdio>
 
 #include <gtest/gtest.h>
 
 #include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
 #include <primitiv/core/error.h>
 #include <primitiv/devices/naive/device.h>
 #include <primitiv/core/parameter.h>
@@ -789,5 +791,92 @@ TEST_F(OptimizerImplTest, CheckAdamUpdate) {
   }
 }
 
+TEST_F(OptimizerImplTest, CheckUpdateOnMultipleDevices) {
+  devices::Naive dev2;
+  Parameter param1({2}, {1, 2}, dev);
+  Parameter param2({2}, {3, 4}, dev2);
+  Parameter param3({3}, {5, 6, 7}, dev);
+
+  Adam optimizer;
+  optimizer.add(param1, param2, param3);
+  optimizer.reset_gradients();
+  for (Parameter *param : {&param1, &param2, &param3}) {
+    param->gradient() += param->value();
+  }
+  optimizer.update();
+
+  // The first update of Adam moves each value by `alpha`.
+  EXPECT_TRUE(vector_near(
+        vector<float> {.999, 1.999}, param1.value().to_vector(), 1e-5));
+  EXPECT_TRUE(vector_near(
+        vector<float> {2.999, 3.999}, param2.value().to_vector(), 1e-5));
+  EXPECT_TRUE(vector_near(
+        vector<float> {4.999, 5.999, 6.999},
+        param3.value().to_vector(), 1e-5));
+}
+
+TEST_F(OptimizerImplTest, CheckSparseUpdateMatchesDense) {
+  // Updates of SGD and AdaGrad do not change rows without gradients, hence
+  // sparse updates should match dense updates.
+  const vector<vector<std::uint32_t>> ids_list {{2, 0, 2}, {1}, {0, 1}};
+  SGD sgd(.5);
+  AdaGrad adagrad(.5);
+  for (Optimizer *optimizer : vector<Optimizer *> {&sgd, &adagrad}) {
+    Parameter dense({2, 3}, {1, 2, 3, 4, 5, 6}, dev);
+    Parameter sparse({2, 3}, {1, 2, 3, 4, 5, 6}, dev);
+    optimizer->add(dense, sparse);
+    for (const vector<std::uint32_t> &ids : ids_list) {
+      optimizer->reset_gradients();
+      const Tensor gy = functions::pick(sparse.value(), ids, 1) + 1;
+      dev.pick_bw(gy, ids, 1, dense.gradient());
+      sparse.add_sparse_gradient(ids, 1, gy);
+      ASSERT_TRUE(sparse.has_sparse_gradient());
+      optimizer->update();
+      EXPECT_TRUE(vector_near(
+            dense.value().to_vector(), sparse.value().to_vector(), 1e-6));
+    }
+  }
+}
+
+TEST_F(OptimizerImplTest, CheckSparseUpdateIsLazy) {
+  Parameter param({2, 2}, {1, 2, 3, 4}, dev);
+  MomentumSGD optimizer(1, .5);
+  optimizer.add(param);
+
+  optimizer.reset_gradients();
+  param.add_sparse_gradient(
+      {0, 1}, 1, dev.new_tensor_by_vector(Shape({2}, 2), {1, 1, 2, 2}));
+  optimizer.update();
+  EXPECT_TRUE(vector_match({0, 1, 1, 2}, param.value().to_vector()));
+  EXPECT_TRUE(vector_match(
+        {-1, -1, -2, -2}, param.stats("MomentumSGD.m").to_vector()));
+
+  // Only the row 1 is updated, and the momentum of the row 0 is kept.
+  optimizer.reset_gradients();
+  param.add_sparse_gradient({1}, 1, dev.new_tensor_by_vector({2}, {1, 1}));
+  optimizer.update();
+  EXPECT_TRUE(vector_match({0, 1, -1, 0}, param.value().to_vector()));
+  EXPECT_TRUE(vector_match(
+        {-1, -1, -2, -2}, param.stats("MomentumSGD.m").to_vector()));
+}
+
+TEST_F(OptimizerImplTest, CheckSparseGradientClipping) {
+  Parameter dense({2, 2}, {1, 2, 3, 4}, dev);
+  Parameter sparse({2, 2}, {1, 2, 3, 4}, dev);
+  SGD optimizer(1);
+  optimizer.set_gradient_clipping(1);
+  optimizer.add(dense, sparse);
+  optimizer.reset_gradients();
+  const Tensor gy = dev.new_tensor_by_vector({2}, {3, 4});
+  dev.pick_bw(gy, {1}, 1, dense.gradient());
+  sparse.add_sparse_gradient({1}, 1, gy);
+  optimizer.update();
+  // Global norm is sqrt(2) * 5.
+  const float r = 1 / (std::sqrt(2.f) * 5);
+  const vector<float> expected {1, 2, 3 - 3 * r, 4 - 4 * r};
+  EXPECT_TRUE(vector_near(expected, dense.value().to_vector(), 1e-6));
+  EXPECT_TRUE(vector_near(expected, sparse.value().to_vector(), 1e-6));
+}
+
 }  // namespace optimizers
 }  // namespace primitiv
@@ -0,0 +1,257 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
+#include <primitiv/core/device.h>
+#include <primitiv/core/error.h>
+#include <primitiv/core/tensor.h>
+#include <primitiv/devices/naive/device.h>
+
+#include <test_utils.h>
+
+using std::vector;
+using test_utils::vector_near;
+
+namespace primitiv {
+
+class OptimizerUpdateTest : public testing::Test {
+protected:
+  static vector<Device *> devices;
+
+  static void SetUpTestCase() {
+    test_utils::add_available_devices(devices);
+  }
+
+  static void TearDownTestCase() {
+    for (Device *dev : devices) {
+      delete dev;
+    }
+  }
+
+  // Generates a deterministic sequence of values.
+  static vector<float> make_values(std::uint32_t size, float offset) {
+    vector<float> values(size);
+    for (std::uint32_t i = 0; i < size; ++i) {
+      values[i] = offset + std::sin(.1 * i);
+    }
+    return values;
+  }
+
+  // Creates parameter-like tensors with various shapes.
+  // The second shape is larger than one block of the CPU kernels.
+  static vector<Tensor> make_tensors(Device &dev, float offset) {
+    vector<Tensor> ts;
+    for (const Shape &s : {Shape({2, 3}, 2), Shape({1500})}) {
+      ts.emplace_back(dev.new_tensor_by_vector(
+            s, make_values(s.size(), offset)));
+    }
+    return ts;
+  }
+
+  static vector<const Tensor *> cptrs(const vector<Tensor> &ts) {
+    vector<const Tensor *> ptrs;
+    for (const Tensor &t : ts) ptrs.emplace_back(&t);
+    return ptrs;
+  }
+
+  static vector<Tensor *> mptrs(vector<Tensor> &ts) {
+    vector<Tensor *> ptrs;
+    for (Tensor &t : ts) ptrs.emplace_back(&t);
+    return ptrs;
+  }
+
+  static void expect_near(
+      const vector<Tensor> &expected, const vector<Tensor> &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::uint32_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].shape(), actual[i].shape());
+      EXPECT_TRUE(vector_near(
+            expected[i].to_vector(), actual[i].to_vector(), 1e-5));
+    }
+  }
+};
+
+vector<Device *> OptimizerUpdateTest::devices;
+
+TEST_F(OptimizerUpdateTest, CheckInvalidArguments) {
+  devices::Naive dev;
+  devices::Naive dev2;
+  vector<Tensor> gs = make_tensors(dev, 0);
+  vector<Tensor> xs = make_tensors(dev, 1);
+  vector<Tensor> ms = make_tensors(dev, .5);
+
+  // Number of tensors mismatched.
+  vector<Tensor *> xs1 {&xs[0]};
+  EXPECT_THROW(dev.sgd_update(cptrs(gs), .1, xs1), Error);
+  EXPECT_THROW(dev.momentum_sgd_update(
+        cptrs(gs), .1, .9, mptrs(xs), xs1), Error);
+
+  // Shape mismatched.
+  vector<Tensor *> swapped {&xs[1], &xs[0]};
+  EXPECT_THROW(dev.sgd_update(cptrs(gs), .1, swapped), Error);
+  EXPECT_THROW(dev.adagrad_update(
+        cptrs(gs), .1, 1e-8, mptrs(xs), swapped), Error);
+
+  // Device mismatched.
+  vector<Tensor> xs2 = make_tensors(dev2, 1);
+  EXPECT_THROW(dev.sgd_update(cptrs(gs), .1, mptrs(xs2)), Error);
+  EXPECT_THROW(dev2.sgd_update(cptrs(gs), .1, mptrs(xs2)), Error);
+}
+
+TEST_F(OptimizerUpdateTest, CheckSquaredNorm) {
+  for (Device *dev : devices) {
+    EXPECT_FLOAT_EQ(0, dev->squared_norm({}));
+
+    const vector<Tensor> xs = make_tensors(*dev, .5);
+    float expected = 0;
+    for (const Tensor &x : xs) {
+      for (float v : x.to_vector()) expected += v * v;
+    }
+    EXPECT_NEAR(expected, dev->squared_norm(cptrs(xs)), expected * 1e-5);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckSquaredNormPrecision) {
+  // Accumulating 2^22 values in float loses about 3 digits.
+  const std::uint32_t n = 1 << 22;
+  const float v = .1;
+  const double expected = n * static_cast<double>(v) * v;
+  for (Device *dev : devices) {
+    const Tensor x = dev->new_tensor_by_constant({n}, v);
+    EXPECT_NEAR(expected, dev->squared_norm({&x}), expected * 1e-6);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckSquaredNormInvalidDevice) {
+  devices::Naive dev;
+  devices::Naive dev2;
+  const Tensor x = dev.new_tensor_by_constant({2}, 1);
+  const Tensor x2 = dev2.new_tensor_by_constant({2}, 1);
+  EXPECT_FLOAT_EQ(2, dev.squared_norm({&x}));
+  EXPECT_THROW(dev.squared_norm({&x, &x2}), Error);
+}
+
+TEST_F(OptimizerUpdateTest, CheckSGD) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> ex;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      ex.emplace_back(xs[i] - .1 * gs[i]);
+    }
+    dev->sgd_update(cptrs(gs), .1, mptrs(xs));
+    expect_near(ex, xs);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckMomentumSGD) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> ms = make_tensors(*dev, -.5);
+    vector<Tensor> ex, em;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      em.emplace_back(.9 * ms[i] - .1 * gs[i]);
+      ex.emplace_back(xs[i] + em[i]);
+    }
+    dev->momentum_sgd_update(cptrs(gs), .1, .9, mptrs(xs), mptrs(ms));
+    expect_near(ex, xs);
+    expect_near(em, ms);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckAdaGrad) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> ms = make_tensors(*dev, 2);
+    vector<Tensor> ex, em;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      em.emplace_back(ms[i] + gs[i] * gs[i]);
+      ex.emplace_back(xs[i] - .1 * gs[i] / (functions::sqrt(em[i]) + 1e-8));
+    }
+    dev->adagrad_update(cptrs(gs), .1, 1e-8, mptrs(xs), mptrs(ms));
+    expect_near(ex, xs);
+    expect_near(em, ms);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckRMSProp) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> ms = make_tensors(*dev, 2);
+    vector<Tensor> ex, em;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      em.emplace_back(.9 * ms[i] + .1 * gs[i] * gs[i]);
+      ex.emplace_back(xs[i] - .1 * gs[i] / (functions::sqrt(em[i]) + 1e-8));
+    }
+    dev->rmsprop_update(cptrs(gs), .1, .9, 1e-8, mptrs(xs), mptrs(ms));
+    expect_near(ex, xs);
+    expect_near(em, ms);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckAdaDelta) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> m1s = make_tensors(*dev, 2);
+    vector<Tensor> m2s = make_tensors(*dev, 3);
+    vector<Tensor> ex, em1, em2;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      em2.emplace_back(.95 * m2s[i] + .05 * gs[i] * gs[i]);
+      const Tensor dx =
+        functions::sqrt((m1s[i] + 1e-6) / (em2[i] + 1e-6)) * gs[i];
+      em1.emplace_back(.95 * m1s[i] + .05 * dx * dx);
+      ex.emplace_back(xs[i] - .5 * dx);
+    }
+    dev->adadelta_update(
+        cptrs(gs), .5, .95, 1e-6, mptrs(xs), mptrs(m1s), mptrs(m2s));
+    expect_near(ex, xs);
+    expect_near(em1, m1s);
+    expect_near(em2, m2s);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckAdam) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    vector<Tensor> m1s = make_tensors(*dev, -.5);
+    vector<Tensor> m2s = make_tensors(*dev, 2);
+    const float bias1 = 1 - std::pow(.9f, 3);
+    const float bias2 = 1 - std::pow(.999f, 3);
+    vector<Tensor> ex, em1, em2;
+    for (std::uint32_t i = 0; i < gs.size(); ++i) {
+      em1.emplace_back(.9 * m1s[i] + .1 * gs[i]);
+      em2.emplace_back(.999 * m2s[i] + .001 * gs[i] * gs[i]);
+      ex.emplace_back(
+          xs[i] - .01 * (em1[i] / bias1)
+          / (functions::sqrt(em2[i] / bias2) + 1e-8));
+    }
+    dev->adam_update(
+        cptrs(gs), .01, .9, .999, 1e-8, 3, mptrs(xs), mptrs(m1s), mptrs(m2s));
+    expect_near(ex, xs);
+    expect_near(em1, m1s);
+    expect_near(em2, m2s);
+  }
+}
+
+TEST_F(OptimizerUpdateTest, CheckCopyOnWrite) {
+  for (Device *dev : devices) {
+    const vector<Tensor> gs = make_tensors(*dev, 0);
+    vector<Tensor> xs = make_tensors(*dev, 1);
+    const vector<Tensor> copied = xs;
+    dev->sgd_update(cptrs(gs), .1, mptrs(xs));
+    expect_near(make_tensors(*dev, 1), copied);
+  }
+}
+
+}  // namespace primitiv
@@ -368,4 +368,108 @@ TEST_F(ParameterTest, CheckInvalidSave) {
   EXPECT_THROW(invalid.save("/tmp/not_generated"), Error);
 }
 
+TEST_F(ParameterTest, CheckAddGradientAfterReset) {
+  Parameter p({2, 2}, {1, 2, 3, 4}, dev);
+  p.reset_gradient();
+
+  // The first gradient is copied.
+  Tensor gy = dev.new_tensor_by_vector({2, 2}, {1, 2, 3, 4});
+  p.add_gradient(gy);
+  gy.reset(0);
+  EXPECT_TRUE(vector_match({1, 2, 3, 4}, p.gradient().to_vector()));
+
+  // Further gradients are accumulated.
+  p.add_gradient(dev.new_tensor_by_vector({2, 2}, {1, 1, 1, 1}));
+  EXPECT_TRUE(vector_match({2, 3, 4, 5}, p.gradient().to_vector()));
+
+  // Sparse gradients given before the dense gradient are also kept.
+  p.reset_gradient();
+  p.add_sparse_gradient({1}, 1, dev.new_tensor_by_vector({2}, {1, 2}));
+  p.add_gradient(dev.new_tensor_by_vector({2, 2}, {1, 1, 1, 1}));
+  EXPECT_FALSE(p.has_sparse_gradient());
+  EXPECT_TRUE(vector_match({1, 1, 2, 3}, p.gradient().to_vector()));
+}
+
+TEST_F(ParameterTest, CheckInvalidAddGradient) {
+  devices::Naive dev2;
+  Parameter invalid;
+  EXPECT_THROW(
+      invalid.add_gradient(dev.new_tensor_by_constant({}, 0)), Error);
+
+  Parameter p({2, 2}, {1, 2, 3, 4}, dev);
+  p.reset_gradient();
+  EXPECT_THROW(p.add_gradient(dev.new_tensor_by_constant({4}, 0)), Error);
+  EXPECT_THROW(
+      p.add_gradient(dev.new_tensor_by_constant(Shape({2, 2}, 2), 0)), Error);
+  EXPECT_THROW(p.add_gradient(dev2.new_tensor_by_constant({2, 2}, 0)), Error);
+  EXPECT_TRUE(vector_match(vector<float>(4, 0), p.gradient().to_vector()));
+}
+
+TEST_F(ParameterTest, CheckSparseGradient) {
+  Parameter p({2, 3}, {1, 2, 3, 4, 5, 6}, dev);
+  EXPECT_FALSE(p.has_sparse_gradient());
+  p.reset_gradient();
+  EXPECT_FALSE(p.has_sparse_gradient());
+
+  p.add_sparse_gradient(
+      {2, 0}, 1, dev.new_tensor_by_vector(Shape({2}, 2), {1, 2, 3, 4}));
+  p.add_sparse_gradient({2}, 1, dev.new_tensor_by_vector({2}, {5, 6}));
+  EXPECT_TRUE(p.has_sparse_gradient());
+
+  vector<std::uint32_t> ids;
+  std::uint32_t dim;
+  const Tensor &merged = p.sparse_gradient(ids, dim);
+  EXPECT_EQ(vector<std::uint32_t>({2, 0}), ids);
+  EXPECT_EQ(1u, dim);
+  EXPECT_EQ(Shape({2}, 2), merged.shape());
+  EXPECT_TRUE(vector_match({6, 8, 3, 4}, merged.to_vector()));
+  EXPECT_TRUE(p.has_sparse_gradient());
+
+  // Dense gradient is made at the first access.
+  EXPECT_TRUE(vector_match({3, 4, 0, 0, 6, 8}, p.gradient().to_vector()));
+  EXPECT_FALSE(p.has_sparse_gradient());
+  EXPECT_THROW(p.sparse_gradient(ids, dim), Error);
+
+  // Further sparse gradients are directly added to the dense gradient.
+  p.add_sparse_gradient({1}, 1, dev.new_tensor_by_vector({2}, {1, 1}));
+  EXPECT_FALSE(p.has_sparse_gradient());
+  EXPECT_TRUE(vector_match({3, 4, 1, 1, 6, 8}, p.gradient().to_vector()));
+
+  // Resetting clears both gradients.
+  p.reset_gradient();
+  EXPECT_FALSE(p.has_sparse_gradient());
+  EXPECT_TRUE(vector_match(vector<float>(6, 0), p.gradient().to_vector()));
+}
+
+TEST_F(ParameterTest, CheckSparseGradientAlongDifferentDims) {
+  Parameter p({2, 2}, {1, 2, 3, 4}, dev);
+  p.reset_gradient();
+  p.add_sparse_gradient({1}, 1, dev.new_tensor_by_vector({2}, {1, 2}));
+  p.add_sparse_gradient({0}, 0, dev.new_tensor_by_vector({1, 2}, {3, 4}));
+  EXPECT_FALSE(p.has_sparse_gradient());
+  EXPECT_TRUE(vector_match({3, 0, 5, 2}, p.gradient().to_vector()));
+}
+
+TEST_F(ParameterTest, CheckInvalidSparseGradient) {
+  devices::Naive dev2;
+  Parameter invalid;
+  EXPECT_THROW(invalid.has_sparse_gradient(), Error);
+  EXPECT_THROW(
+      invalid.add_sparse_gradient(
+        {0}, 0, dev.new_tensor_by_constant({}, 0)), Error);
+
+  Parameter p({2, 3}, {1, 2, 3, 4, 5, 6}, dev);
+  p.reset_gradient();
+  EXPECT_THROW(
+      p.add_sparse_gradient({0}, 1, dev.new_tensor_by_constant({3}, 0)),
+      Error);
+  EXPECT_THROW(
+      p.add_sparse_gradient({3}, 1, dev.new_tensor_by_constant({2}, 0)),
+      Error);
+  EXPECT_THROW(
+      p.add_sparse_gradient({0}, 1, dev2.new_tensor_by_constant({2}, 0)),
+      Error);
+  EXPECT_FALSE(p.has_sparse_gradient());
+}
+
 }  // namespace primitiv
@@ -587,6 +587,141 @@ TEST_F(ShapeOpsTest, CheckInvalidPool2D) {
   }
 }
 
+TEST_F(ShapeOpsTest, CheckLSTMCell) {
+  EXPECT_EQ(Shape({1}), lstm_cell({4}, {4}, {1}));
+  EXPECT_EQ(Shape({3}), lstm_cell({12}, {12}, {3}));
+  EXPECT_EQ(Shape({3}, 2), lstm_cell(Shape({12}, 2), {12}, {3}));
+  EXPECT_EQ(Shape({3}, 2), lstm_cell({12}, Shape({12}, 2), {3}));
+  EXPECT_EQ(Shape({3}, 2), lstm_cell({12}, {12}, Shape({3}, 2)));
+  EXPECT_EQ(
+      Shape({3}, 2),
+      lstm_cell(Shape({12}, 2), Shape({12}, 2), Shape({3}, 2)));
+}
+
+TEST_F(ShapeOpsTest, CheckInvalidLSTMCell) {
+  struct TestCase {
+    Shape u, b, c;
+  };
+  const vector<TestCase> test_cases {
+    // sizes mismatching
+    {{12}, {12}, {4}},
+    {{12}, {8}, {3}},
+    {{3}, {3}, {3}},
+    // not column vectors
+    {{12, 2}, {12}, {3}},
+    {{12}, {12, 2}, {3}},
+    {{12}, {12}, {3, 2}},
+    // batches mismatching
+    {Shape({12}, 2), Shape({12}, 3), {3}},
+    {Shape({12}, 2), {12}, Shape({3}, 3)},
+    {{12}, Shape({12}, 2), Shape({3}, 3)},
+  };
+  for (const auto &tc : test_cases) {
+    EXPECT_THROW(lstm_cell(tc.u, tc.b, tc.c), Error);
+  }
+}
+
+TEST_F(ShapeOpsTest, CheckGRUCell) {
+  EXPECT_EQ(Shape({1}), gru_cell({3}, {3}, {1}));
+  EXPECT_EQ(Shape({4}), gru_cell({12}, {12}, {4}));
+  EXPECT_EQ(Shape({4}, 2), gru_cell(Shape({12}, 2), {12}, {4}));
+  EXPECT_EQ(Shape({4}, 2), gru_cell({12}, Shape({12}, 2), {4}));
+  EXPECT_EQ(Shape({4}, 2), gru_cell({12}, {12}, Shape({4}, 2)));
+}
+
+TEST_F(ShapeOpsTest, CheckInvalidGRUCell) {
+  struct TestCase {
+    Shape ux, uh, h;
+  };
+  const vector<TestCase> test_cases {
+    // sizes mismatching
+    {{12}, {12}, {3}},
+    {{12}, {9}, {4}},
+    // not column vectors
+    {{12, 2}, {12}, {4}},
+    {{12}, {12}, {4, 2}},
+    // batches mismatching
+    {Shape({12}, 2), Shape({12}, 3), {4}},
+    {{12}, Shape({12}, 2), Shape({4}, 3)},
+  };
+  for (const auto &tc : test_cases) {
+    EXPECT_THROW(gru_cell(tc.ux, tc.uh, tc.h), Error);
+  }
+}
+
+TEST_F(ShapeOpsTest, CheckSRU) {
+  EXPECT_EQ(Shape({1}), sru({1}, {3}, {2}));
+  EXPECT_EQ(Shape({4, 5}), sru({4, 5}, {12, 5}, {8}));
+  EXPECT_EQ(Shape({4, 5}, 2), sru(Shape({4, 5}, 2), {12, 5}, {8}));
+  EXPECT_EQ(Shape({4, 5}, 2), sru({4, 5}, Shape({12, 5}, 2), {8}));
+  EXPECT_EQ(Shape({4, 5}, 2), sru({4, 5}, {12, 5}, Shape({8}, 2)));
+}
+
+TEST_F(ShapeOpsTest, CheckInvalidSRU) {
+  struct TestCase {
+    Shape x, u, b;
+  };
+  const vector<TestCase> test_cases {
+    // sizes mismatching
+    {{4, 5}, {8, 5}, {8}},
+    {{4, 5}, {12, 4}, {8}},
+    {{4, 5}, {12, 5}, {4}},
+    // wrong ranks
+    {{4, 5, 2}, {12, 5, 2}, {8}},
+    {{4, 5}, {12, 5}, {8, 2}},
+    // batches mismatching
+    {Shape({4, 5}, 2), Shape({12, 5}, 3), {8}},
+    {{4, 5}, Shape({12, 5}, 2), Shape({8}, 3)},
+  };
+  for (const auto &tc : test_cases) {
+    EXPECT_THROW(sru(tc.x, tc.u, tc.b), Error);
+  }
+}
+
+TEST_F(ShapeOpsTest, CheckAttention) {
+  EXPECT_EQ(Shape({1}), attention({1}, {1}, {1}));
+  EXPECT_EQ(Shape({5, 3}), attention({4, 3}, {4, 7}, {5, 7}));
+  EXPECT_EQ(Shape({5, 3}, 2), attention(Shape({4, 3}, 2), {4, 7}, {5, 7}));
+  EXPECT_EQ(Shape({5, 3}, 2), attention({4, 3}, Shape({4, 7}, 2), {5, 7}));
+  EXPECT_EQ(Shape({5, 3}, 2), attention({4, 3}, {4, 7}, Shape({5, 7}, 2)));
+  EXPECT_EQ(Shape({5, 3}), attention({4, 3}, {4, 7}, {5, 7}, {7, 3}));
+  EXPECT_EQ(
+      Shape({5, 3}, 2),
+      attention({4, 3}, {4, 7}, {5, 7}, Shape({7, 3}, 2)));
+  EXPECT_EQ(
+      Shape({5, 3}, 2),
+      attention(Shape({4, 3}, 2), {4, 7}, {5, 7}, Shape({7, 3}, 2)));
+}
+
+TEST_F(ShapeOpsTest, CheckInvalidAttention) {
+  struct TestCase {
+    Shape q, k, v;
+  };
+  const vector<TestCase> test_cases {
+    // sizes mismatching
+    {{4, 3}, {5, 7}, {5, 7}},
+    {{4, 3}, {4, 7}, {5, 6}},
+    // not matrices
+    {{4, 3, 2}, {4, 7}, {5, 7}},
+    {{4, 3}, {4, 7, 2}, {5, 7}},
+    {{4, 3}, {4, 7}, {5, 7, 2}},
+    // batches mismatching
+    {Shape({4, 3}, 2), Shape({4, 7}, 3), {5, 7}},
+    {{4, 3}, Shape({4, 7}, 2), Shape({5, 7}, 3)},
+  };
+  for (const auto &tc : test_cases) {
+    EXPECT_THROW(attention(tc.q, tc.k, tc.v), Error);
+  }
+
+  const vector<Shape> masks {
+    {3, 7}, {7, 4}, {7, 3, 2}, Shape({7, 3}, 3),
+  };
+  for (const Shape &mask : masks) {
+    EXPECT_THROW(
+        attention(Shape({4, 3}, 2), {4, 7}, {5, 7}, mask), Error);
+  }
+}
+
 TEST_F(ShapeOpsTest, CheckBatchPick) {
   struct TestCase {
     Shape input;
@@ -366,6 +366,48 @@ TEST_F(TensorBackwardTest, CheckCopyAndPick) {
   }
 }
 
+TEST_F(TensorBackwardTest, CheckPickAssign) {
+  const vector<float> a_data {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  struct TestCase {
+    Shape b_shape;
+    vector<float> b_data;
+    std::uint32_t dim;
+    vector<std::uint32_t> ids;
+    vector<float> y_data;
+  };
+  const vector<TestCase> test_cases {
+    {Shape({1, 2}, 3), {1, 1, 2, 2, 3, 3}, 0, {0, 1, 0},
+      {1, 1, 1, 3, 0, 2, 2, 2, 3, 1, 3, 3}},
+    {Shape({2}, 3), {1, 1, 2, 2, 3, 3}, 1, {1, 0, 1},
+      {0, 1, 1, 1, 2, 2, 2, 3, 0, 1, 3, 3}},
+    {Shape({2, 2}, 3), {1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3}, 2, {0, 0, 0},
+      {1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3}},
+  };
+  for (Device *dev : devices) {
+    for (const TestCase &tc : test_cases) {
+      Tensor a = dev->new_tensor_by_vector(Shape({2, 2}, 3), a_data);
+      const Tensor b = dev->new_tensor_by_vector(tc.b_shape, tc.b_data);
+      const Tensor copied = a;
+      dev->pick_assign(b, tc.ids, tc.dim, a);
+      EXPECT_TRUE(vector_match(tc.y_data, a.to_vector()));
+      EXPECT_TRUE(vector_match(a_data, copied.to_vector()));
+    }
+  }
+}
+
+TEST_F(TensorBackwardTest, CheckPickAssignRows) {
+  // Rows of a non-batched tensor are overwritten by each minibatch.
+  for (Device *dev : devices) {
+    Tensor a = dev->new_tensor_by_vector({2, 3}, {0, 1, 2, 3, 4, 5});
+    const Tensor b = dev->new_tensor_by_vector(Shape({2}, 2), {7, 8, 9, 10});
+    dev->pick_assign(b, {2, 0}, 1, a);
+    EXPECT_TRUE(vector_match(vector<float> {9, 10, 2, 3, 7, 8}, a.to_vector()));
+
+    EXPECT_THROW(dev->pick_assign(b, {0, 1, 2}, 1, a), Error);
+    EXPECT_THROW(dev->pick_assign(b, {0, 3}, 1, a), Error);
+  }
+}
+
 TEST_F(TensorBackwardTest, CheckAbs) {
   for (Device *dev : devices) {
     const Tensor x = dev->new_tensor_by_vector(
@@ -469,6 +511,7 @@ TEST_F(TensorBackwardTest, CheckSigmoid) {
     const std::uint32_t ulps
       = dev_type == DeviceType::CUDA16 ? 32768
       : dev_type == DeviceType::EIGEN ? 6
+      : dev_type == DeviceType::NAIVE ? 6
       : dev_type == DeviceType::OPENCL ? 6
       : get_default_ulps(*dev);
     EXPECT_TRUE(vector_match_ulps(gx_val, gx.to_vector(), ulps));
@@ -2947,4 +2990,273 @@ TEST_F(TensorBackwardTest, CheckMaxPool2D_VGG16ThirdLayer) {
   } IGNORE_NOT_IMPLEMENTED
 }
 
+TEST_F(TensorBackwardTest, CheckLSTMCell) {
+  const std::uint32_t n = 2;
+  const vector<float> u_data {
+    1, -1, 2, -2, .5, -.5, 0, 3,
+    -3, 2, .1, -.1, 1, 1, -1, .5,
+  };
+  const vector<float> b_data {.1, .2, .3, .4, -.1, -.2, -.3, -.4};
+  const vector<float> c_data {.5, -.5};
+  const vector<float> gh_data {1, -2, .5, 3};
+  const vector<float> gc_new_data {-1, .5, 2, 1};
+
+  // Reference gradients added to 1.
+  vector<float> c_new_data(2 * n);
+  vector<float> gu_data(4 * n * 2, 1), gb_data(4 * n, 1), gc_data(n, 1);
+  const auto sigmoid = [](float x) { return 1 / (1 + std::exp(-x)); };
+  for (std::uint32_t bt = 0; bt < 2; ++bt) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const auto a = [&](std::uint32_t g) {
+        return u_data[bt * 4 * n + g * n + k] + b_data[g * n + k];
+      };
+      const float i = sigmoid(a(0)), f = sigmoid(a(1)), o = sigmoid(a(2));
+      const float j = std::tanh(a(3));
+      const float cy = i * j + f * c_data[k];
+      const float t = std::tanh(cy);
+      const float gh = gh_data[bt * n + k];
+      const float gcy = gc_new_data[bt * n + k] + gh * o * (1 - t * t);
+      const float ga[] {
+        gcy * j * i * (1 - i),
+        gcy * c_data[k] * f * (1 - f),
+        gh * t * o * (1 - o),
+        gcy * i * (1 - j * j),
+      };
+      for (std::uint32_t g = 0; g < 4; ++g) {
+        gu_data[bt * 4 * n + g * n + k] += ga[g];
+        gb_data[g * n + k] += ga[g];
+      }
+      gc_data[k] += gcy * f;
+      c_new_data[bt * n + k] = cy;
+    }
+  }
+
+  for (Device *dev : devices) {
+    const Tensor u = dev->new_tensor_by_vector(Shape({4 * n}, 2), u_data);
+    const Tensor b = dev->new_tensor_by_vector({4 * n}, b_data);
+    const Tensor c = dev->new_tensor_by_vector({n}, c_data);
+    const Tensor c_new = dev->new_tensor_by_vector(Shape({n}, 2), c_new_data);
+    const Tensor gh = dev->new_tensor_by_vector(Shape({n}, 2), gh_data);
+    const Tensor gc_new = dev->new_tensor_by_vector(
+        Shape({n}, 2), gc_new_data);
+    Tensor gu = dev->new_tensor_by_constant(Shape({4 * n}, 2), 1);
+    Tensor gb = dev->new_tensor_by_constant({4 * n}, 1);
+    Tensor gc = dev->new_tensor_by_constant({n}, 1);
+    dev->lstm_cell_bw(u, b, c, c_new, gh, gc_new, gu, gb, gc);
+    EXPECT_TRUE(vector_near(gu_data, gu.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gb_data, gb.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gc_data, gc.to_vector(), 1e-5));
+
+    // Shapes of gradients should be equal to those of arguments.
+    EXPECT_THROW(
+        dev->lstm_cell_bw(u, b, c, c_new, gh, gc_new, gb, gu, gc), Error);
+    EXPECT_THROW(
+        dev->lstm_cell_bw(u, b, c, gh.reshape({2 * n}), gh, gc_new,
+          gu, gb, gc), Error);
+  }
+}
+
+TEST_F(TensorBackwardTest, CheckGRUCell) {
+  const std::uint32_t n = 2;
+  const vector<float> ux_data {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1};
+  const vector<float> uh_data {.1, .2, .3, .4, -.1, -.2};
+  const vector<float> h_data {.5, -.5};
+  const vector<float> gy_data {1, -2, .5, 3};
+
+  // Reference gradients added to 1.
+  vector<float> gux_data(3 * n * 2, 1), guh_data(3 * n, 1), gh_data(n, 1);
+  const auto sigmoid = [](float x) { return 1 / (1 + std::exp(-x)); };
+  for (std::uint32_t bt = 0; bt < 2; ++bt) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const float *ux = &ux_data[bt * 3 * n];
+      const float r = sigmoid(ux[k] + uh_data[k]);
+      const float z = sigmoid(ux[n + k] + uh_data[n + k]);
+      const float j = std::tanh(ux[2 * n + k] + r * uh_data[2 * n + k]);
+      const float gy = gy_data[bt * n + k];
+      const float gj = gy * (1 - z) * (1 - j * j);
+      const float gz = gy * (h_data[k] - j) * z * (1 - z);
+      const float gr = gj * uh_data[2 * n + k] * r * (1 - r);
+      gux_data[bt * 3 * n + k] += gr;
+      gux_data[bt * 3 * n + n + k] += gz;
+      gux_data[bt * 3 * n + 2 * n + k] += gj;
+      guh_data[k] += gr;
+      guh_data[n + k] += gz;
+      guh_data[2 * n + k] += gj * r;
+      gh_data[k] += gy * z;
+    }
+  }
+
+  for (Device *dev : devices) {
+    const Tensor ux = dev->new_tensor_by_vector(Shape({3 * n}, 2), ux_data);
+    const Tensor uh = dev->new_tensor_by_vector({3 * n}, uh_data);
+    const Tensor h = dev->new_tensor_by_vector({n}, h_data);
+    const Tensor gy = dev->new_tensor_by_vector(Shape({n}, 2), gy_data);
+    Tensor gux = dev->new_tensor_by_constant(Shape({3 * n}, 2), 1);
+    Tensor guh = dev->new_tensor_by_constant({3 * n}, 1);
+    Tensor gh = dev->new_tensor_by_constant({n}, 1);
+    dev->gru_cell_bw(ux, uh, h, gy, gux, guh, gh);
+    EXPECT_TRUE(vector_near(gux_data, gux.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(guh_data, guh.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gh_data, gh.to_vector(), 1e-5));
+
+    // Shapes of gradients should be equal to those of arguments.
+    EXPECT_THROW(dev->gru_cell_bw(ux, uh, h, gy, guh, gux, gh), Error);
+    EXPECT_THROW(dev->gru_cell_bw(ux, uh, h, gh, gux, guh, gh), Error);
+  }
+}
+
+TEST_F(TensorBackwardTest, CheckSRU) {
+  const std::uint32_t n = 2;
+  const std::uint32_t len = 3;
+  const vector<float> x_data {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1};
+  const vector<float> u_data {
+    1, -1, 2, -2, .5, -.5,
+    -3, 2, .1, -.1, 1, 1,
+    .3, .2, -.1, .4, -2, 3,
+  };
+  const vector<float> b_data {.1, .2, -.3, .4};
+  const vector<float> gh_data {1, -2, .5, 3, -1, 1, 2, .5, -.5, 1, 0, -2};
+  const vector<float> gc_data {.5, 0, -1, 1, .5, .5, 0, 1, 1, -1, .5, 0};
+
+  // Reference values and gradients added to 1.
+  vector<float> c_data(n * len * 2);
+  vector<float> gx_data(n * len * 2, 1);
+  vector<float> gu_data(3 * n * len, 1), gb_data(2 * n, 1);
+  const auto sigmoid = [](float x) { return 1 / (1 + std::exp(-x)); };
+  for (std::uint32_t bt = 0; bt < 2; ++bt) {
+    for (std::uint32_t k = 0; k < n; ++k) {
+      vector<float> f(len), r(len), c(len + 1, 0);
+      for (std::uint32_t t = 0; t < len; ++t) {
+        f[t] = sigmoid(u_data[3 * n * t + n + k] + b_data[k]);
+        r[t] = sigmoid(u_data[3 * n * t + 2 * n + k] + b_data[n + k]);
+        c[t + 1] = f[t] * c[t] + (1 - f[t]) * u_data[3 * n * t + k];
+        c_data[bt * n * len + n * t + k] = c[t + 1];
+      }
+      float gcy = 0;
+      for (std::uint32_t t = len; t > 0; ) {
+        --t;
+        const std::uint32_t i = bt * n * len + n * t + k;
+        const float tc = std::tanh(c[t + 1]);
+        gcy = gcy * (t + 1 < len ? f[t + 1] : 0)
+          + gc_data[i] + gh_data[i] * r[t] * (1 - tc * tc);
+        const float gf =
+          gcy * (c[t] - u_data[3 * n * t + k]) * f[t] * (1 - f[t]);
+        const float gr = gh_data[i] * (tc - x_data[i]) * r[t] * (1 - r[t]);
+        gx_data[i] += gh_data[i] * (1 - r[t]);
+        gu_data[3 * n * t + k] += gcy * (1 - f[t]);
+        gu_data[3 * n * t + n + k] += gf;
+        gu_data[3 * n * t + 2 * n + k] += gr;
+        gb_data[k] += gf;
+        gb_data[n + k] += gr;
+      }
+    }
+  }
+
+  for (Device *dev : devices) {
+    const Shape sy({n, len}, 2);
+    const Tensor x = dev->new_tensor_by_vector(sy, x_data);
+    const Tensor u = dev->new_tensor_by_vector({3 * n, len}, u_data);
+    const Tensor b = dev->new_tensor_by_vector({2 * n}, b_data);
+    const Tensor c = dev->new_tensor_by_vector(sy, c_data);
+    const Tensor gh = dev->new_tensor_by_vector(sy, gh_data);
+    const Tensor gc = dev->new_tensor_by_vector(sy, gc_data);
+    Tensor gx = dev->new_tensor_by_constant(sy, 1);
+    Tensor gu = dev->new_tensor_by_constant({3 * n, len}, 1);
+    Tensor gb = dev->new_tensor_by_constant({2 * n}, 1);
+    dev->sru_bw(x, u, b, c, gh, gc, gx, gu, gb);
+    EXPECT_TRUE(vector_near(gx_data, gx.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gu_data, gu.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gb_data, gb.to_vector(), 1e-5));
+
+    // Shapes of gradients should be equal to those of arguments.
+    EXPECT_THROW(dev->sru_bw(x, u, b, c, gh, gc, gu, gx, gb), Error);
+    EXPECT_THROW(dev->sru_bw(x, u, b, gb, gh, gc, gx, gu, gb), Error);
+  }
+}
+
+TEST_F(TensorBackwardTest, CheckAttention) {
+  const std::uint32_t d = 2, m = 3, n = 4, e = 3;
+  const float scale = .7;
+  const vector<float> q_data {1, -1, .5, 2, 0, 1, -2, .5, 1, 1, -1, 0};
+  const vector<float> k_data {.5, 1, -1, .2, 2, -.5, 0, 1};
+  const vector<float> v_data {1, 2, 3, -1, 0, 1, .5, .5, 2, -2, 1, 0};
+  const vector<float> mask_data {0, -1e30, 0, 1, -2, 0, .5, 0, 0, 0, 0, -1};
+  const vector<float> gy_data {
+    1, -2, .5, 3, -1, 1, 2, .5, -.5,
+    1, 0, -2, .5, .5, 1, -1, 2, 0,
+  };
+  const vector<float> glse_data {.5, -1, 0, 1, .5, -.5};
+
+  // Reference gradients added to 1.
+  vector<float> gq_data(d * m * 2, 1), gk_data(d * n, 1), gv_data(e * n, 1);
+  vector<float> gmask_data(n * m, 1);
+  for (std::uint32_t bt = 0; bt < 2; ++bt) {
+    for (std::uint32_t j = 0; j < m; ++j) {
+      const float *q = &q_data[bt * d * m + d * j];
+      const float *gy = &gy_data[bt * e * m + e * j];
+      vector<float> p(n);
+      float z = 0;
+      for (std::uint32_t i = 0; i < n; ++i) {
+        const float s =
+          scale * (k_data[d * i] * q[0] + k_data[d * i + 1] * q[1])
+          + mask_data[n * j + i];
+        p[i] = std::exp(s);
+        z += p[i];
+      }
+      vector<float> y(e, 0), gp(n, 0);
+      for (std::uint32_t i = 0; i < n; ++i) {
+        p[i] /= z;
+        for (std::uint32_t l = 0; l < e; ++l) {
+          y[l] += p[i] * v_data[e * i + l];
+          gp[i] += v_data[e * i + l] * gy[l];
+        }
+      }
+      float dot_y = 0;
+      for (std::uint32_t l = 0; l < e; ++l) dot_y += y[l] * gy[l];
+      for (std::uint32_t i = 0; i < n; ++i) {
+        const float gs = p[i] * (gp[i] - dot_y + glse_data[bt * m + j]);
+        for (std::uint32_t l = 0; l < d; ++l) {
+          gq_data[bt * d * m + d * j + l] += scale * gs * k_data[d * i + l];
+          gk_data[d * i + l] += scale * gs * q[l];
+        }
+        for (std::uint32_t l = 0; l < e; ++l) {
+          gv_data[e * i + l] += p[i] * gy[l];
+        }
+        gmask_data[n * j + i] += gs;
+      }
+    }
+  }
+
+  for (Device *dev : devices) {
+    const Tensor q = dev->new_tensor_by_vector(Shape({d, m}, 2), q_data);
+    const Tensor k = dev->new_tensor_by_vector({d, n}, k_data);
+    const Tensor v = dev->new_tensor_by_vector({e, n}, v_data);
+    const Tensor mask = dev->new_tensor_by_vector({n, m}, mask_data);
+    const Tensor gy = dev->new_tensor_by_vector(Shape({e, m}, 2), gy_data);
+    const Tensor glse = dev->new_tensor_by_vector(Shape({1, m}, 2), glse_data);
+    Tensor y, lse;
+    dev->attention_fw(q, k, v, &mask, scale, y, lse);
+    Tensor gq = dev->new_tensor_by_constant(Shape({d, m}, 2), 1);
+    Tensor gk = dev->new_tensor_by_constant({d, n}, 1);
+    Tensor gv = dev->new_tensor_by_constant({e, n}, 1);
+    Tensor gmask = dev->new_tensor_by_constant({n, m}, 1);
+    dev->attention_bw(
+        q, k, v, &mask, y, lse, gy, glse, scale, gq, gk, gv, &gmask);
+    EXPECT_TRUE(vector_near(gq_data, gq.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gk_data, gk.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gv_data, gv.to_vector(), 1e-5));
+    EXPECT_TRUE(vector_near(gmask_data, gmask.to_vector(), 1e-5));
+
+    // Shapes of gradients should be equal to those of arguments.
+    EXPECT_THROW(
+        dev->attention_bw(
+          q, k, v, &mask, y, lse, gy, glse, scale, gk, gq, gv, &gmask),
+        Error);
+    EXPECT_THROW(
+        dev->attention_bw(
+          q, k, v, &mask, y, lse, gy, glse, scale, gq, gk, gv, nullptr),
+        Error);
+  }
+}
+
 }  // namespace primitiv
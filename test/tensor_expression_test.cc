@@ -0,0 +1,130 @@
+#include <primitiv/config.h>
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <primitiv/core/arithmetic.h>
+#include <primitiv/core/basic_functions.h>
+#include <primitiv/core/device.h>
+#include <primitiv/core/error.h>
+#include <primitiv/core/tensor.h>
+#include <primitiv/core/tensor_expression.h>
+#include <primitiv/devices/naive/device.h>
+
+#include <test_utils.h>
+
+using std::vector;
+using test_utils::vector_match;
+using test_utils::vector_near;
+
+namespace E = primitiv::expressions;
+
+namespace primitiv {
+
+class TensorExpressionTest : public testing::Test {
+protected:
+  static vector<Device *> devices;
+
+  static void SetUpTestCase() {
+    test_utils::add_available_devices(devices);
+  }
+
+  static void TearDownTestCase() {
+    for (Device *dev : devices) {
+      delete dev;
+    }
+  }
+};
+
+vector<Device *> TensorExpressionTest::devices;
+
+TEST_F(TensorExpressionTest, CheckInvalid) {
+  EXPECT_THROW(E::lazy(Tensor()), Error);
+  devices::Naive dev;
+  const Tensor x = dev.new_tensor_by_constant({2}, 1);
+  EXPECT_THROW(E::Expression::unary(E::Expression::Opcode::ADD, x), Error);
+  EXPECT_THROW(
+      E::Expression::binary(E::Expression::Opcode::EXP, x, x), Error);
+}
+
+TEST_F(TensorExpressionTest, CheckLeaf) {
+  for (Device *dev : devices) {
+    const Tensor x = dev->new_tensor_by_vector({3}, {1, 2, 3});
+    const Tensor y = E::lazy(x);
+    EXPECT_TRUE(vector_match(vector<float> {1, 2, 3}, y.to_vector()));
+  }
+}
+
+TEST_F(TensorExpressionTest, CheckEvaluate) {
+  for (Device *dev : devices) {
+    const Tensor a = dev->new_tensor_by_vector(
+        Shape({2, 2}, 2), {1, 2, 3, 4, -1, -2, -3, -4});
+    const Tensor b = dev->new_tensor_by_vector({2, 2}, {.5, 1, 2, 4});
+
+    const Tensor y1 = 2 * E::lazy(a) - E::lazy(b) / 3;
+    const Tensor y2 = E::sqrt(E::exp(E::lazy(a) * E::lazy(b)) + 1);
+    const Tensor y3 = E::prelu(-E::lazy(a), .5) + E::abs(1 - E::lazy(b));
+    const Tensor y4 =
+      E::tanh(E::sigmoid(E::lazy(a))) * E::softplus(E::lazy(b));
+
+    const Tensor e1 = 2 * a - b / 3;
+    const Tensor e2 = functions::sqrt(functions::exp(a * b) + 1);
+    const Tensor e3 = functions::prelu(-a, .5) + functions::abs(1 - b);
+    const Tensor e4 =
+      functions::tanh(functions::sigmoid(a)) * functions::softplus(b);
+
+    for (const auto &p : {
+        std::make_pair(&y1, &e1), std::make_pair(&y2, &e2),
+        std::make_pair(&y3, &e3), std::make_pair(&y4, &e4)}) {
+      EXPECT_EQ(Shape({2, 2}, 2), p.first->shape());
+      // Devices may use different implementations of math functions.
+      EXPECT_TRUE(test_utils::vector_match_ulps(
+            p.second->to_vector(), p.first->to_vector(), 16));
+    }
+  }
+}
+
+TEST_F(TensorExpressionTest, CheckOnePass) {
+  devices::Naive dev;
+  ASSERT_TRUE(dev.supports_elementwise_fusion());
+  const Tensor a = dev.new_tensor_by_vector({4}, {1, 2, 3, 4});
+  const Tensor b = dev.new_tensor_by_vector({4}, {4, 3, 2, 1});
+
+  // Common sub-expressions are shared.
+  const E::Expression ab = E::lazy(a) + E::lazy(b);
+  const E::Expression expr = ab * ab / (ab - 1) + E::lazy(a);
+
+  const std::uint64_t before = Device::get_thread_allocated_bytes();
+  const Tensor y = expr;
+  EXPECT_EQ(sizeof(float) * 4, Device::get_thread_allocated_bytes() - before);
+  EXPECT_TRUE(vector_near(
+        vector<float> {25 / 4. + 1, 25 / 4. + 2, 25 / 4. + 3, 25 / 4. + 4},
+        y.to_vector(), 1e-6));
+}
+
+TEST_F(TensorExpressionTest, CheckFallback) {
+  for (Device *dev : devices) {
+    // Scalar operands are applied by Tensor functions.
+    const Tensor a = dev->new_tensor_by_vector({3}, {1, 2, 3});
+    const Tensor k = dev->new_tensor_by_constant({}, 2);
+    const Tensor y1 = E::lazy(a) * E::lazy(k) + 1;
+    EXPECT_TRUE(vector_match(vector<float> {3, 5, 7}, y1.to_vector()));
+
+    // Expressions which exceed the limit of registers.
+    E::Expression expr = E::lazy(a);
+    for (std::uint32_t i = 0; i < ElementwiseProgram::MAX_REGISTERS; ++i) {
+      expr = expr + 1;
+    }
+    const Tensor y2 = expr;
+    EXPECT_TRUE(vector_match(vector<float> {65, 66, 67}, y2.to_vector()));
+
+    // Single operations are applied by Tensor functions.
+    const Tensor y3 = E::exp(E::lazy(a));
+    EXPECT_TRUE(vector_match(
+          functions::exp(a).to_vector(), y3.to_vector()));
+  }
+}
+
+}  // namespace primitiv
@@ -3096,6 +3096,20 @@ TEST_F(TensorForwardTest, CheckStopGradient) {
   }
 }
 
+TEST_F(TensorForwardTest, CheckCheckpoint) {
+  const vector<float> x_data {
+    0, .5, 1, 2, 3, 4,
+    0, -.5, -1, -2, -3, -4,
+  };
+  const vector<float> y_data = x_data;
+  for (Device *dev : devices) {
+    const Tensor x = dev->new_tensor_by_vector(Shape({2, 3}, 2), x_data);
+    const Tensor y = checkpoint(x);
+    EXPECT_EQ(Shape({2, 3}, 2), y.shape());
+    EXPECT_TRUE(vector_match(y_data, y.to_vector()));
+  }
+}
+
 #define TEST_CONV2D(pad0, pad1, str0, str1, dil0, dil1) { \
   for (Device *dev : devices) try { \
     const Tensor x = dev->new_tensor_by_vector(x_shape, x_data); \
@@ -3631,6 +3645,48 @@ TEST_F(TensorForwardTest, CheckConv2D_VGG16FirstLayer) {
 
 #undef TEST_CONV2D
 
+TEST_F(TensorForwardTest, CheckConv2D3x3) {
+  // 3x3 filters with stride 1 and no dilation may be calculated by specialized
+  // kernels. Results are compared with the same filters embedded in 5x5
+  // filters with additional padding.
+  struct TestCase {
+    Shape x_shape, w_shape;
+    std::uint32_t pad0, pad1;
+  };
+  const vector<TestCase> test_cases {
+    {{3, 3}, {3, 3}, 0, 0},
+    {{1, 1}, {3, 3}, 1, 1},
+    {{2, 3}, {3, 3}, 1, 0},
+    {{7, 6, 3}, {3, 3, 3, 2}, 0, 0},
+    {{5, 8, 2}, {3, 3, 2, 3}, 1, 2},
+    {{9, 4, 2}, {3, 3, 2, 2}, 3, 1},
+    {Shape({6, 5, 2}, 2), {3, 3, 2, 3}, 1, 1},
+    {{6, 5, 2}, Shape({3, 3, 2, 3}, 2), 1, 1},
+    {Shape({6, 5, 2}, 2), Shape({3, 3, 2, 3}, 2), 2, 0},
+  };
+  for (Device *dev : devices) try {
+    for (const TestCase &tc : test_cases) {
+      const vector<float> x_data = make_iota_vector(tc.x_shape.size(), 1);
+      vector<float> w_data(tc.w_shape.size());
+      for (std::uint32_t i = 0; i < w_data.size(); ++i) {
+        w_data[i] = static_cast<float>(i % 7) - 3;
+      }
+      const Shape w5_shape = tc.w_shape.resize_dim(0, 5).resize_dim(1, 5);
+      vector<float> w5_data(w5_shape.size(), 0);
+      for (std::uint32_t i = 0; i < w_data.size(); ++i) {
+        w5_data[(i / 9) * 25 + ((i / 3) % 3 + 1) * 5 + i % 3 + 1] = w_data[i];
+      }
+      const Tensor x = dev->new_tensor_by_vector(tc.x_shape, x_data);
+      const Tensor w = dev->new_tensor_by_vector(tc.w_shape, w_data);
+      const Tensor w5 = dev->new_tensor_by_vector(w5_shape, w5_data);
+      const Tensor y = conv2d(x, w, tc.pad0, tc.pad1, 1, 1, 1, 1);
+      const Tensor y5 = conv2d(x, w5, tc.pad0 + 1, tc.pad1 + 1, 1, 1, 1, 1);
+      EXPECT_EQ(y5.shape(), y.shape());
+      EXPECT_TRUE(vector_near(y5.to_vector(), y.to_vector(), 1e-3));
+    }
+  } IGNORE_NOT_IMPLEMENTED
+}
+
 TEST_F(TensorForwardTest, CheckInvalidConv2D) {
   struct TestCase {
     Shape x_shape, w_shape;
@@ -4024,6 +4080,136 @@ TEST_F(TensorForwardTest, CheckMaxPool2D_VGG16ThirdLayer) {
 
 #undef TEST_MAX_POOL2D
 
+TEST_F(TensorForwardTest, CheckLSTMCell) {
+  const vector<float> u_data {
+    1, -1, 2, -2, .5, -.5, 0, 3,
+    -3, 2, .1, -.1, 1, 1, -1, .5,
+  };
+  const vector<float> b_data {.1, .2, .3, .4, -.1, -.2, -.3, -.4};
+  for (Device *dev : devices) {
+    const Tensor u = dev->new_tensor_by_vector(Shape({8}, 2), u_data);
+    const Tensor b = dev->new_tensor_by_vector({8}, b_data);
+    for (const Tensor &c : {
+        dev->new_tensor_by_vector(Shape({2}, 2), {.5, -.5, 1, 2}),
+        dev->new_tensor_by_vector({2}, {.5, -.5})}) {
+      const Tensor a = u + b;
+      const Tensor i = sigmoid(slice(a, 0, 0, 2));
+      const Tensor f = sigmoid(slice(a, 0, 2, 4));
+      const Tensor o = sigmoid(slice(a, 0, 4, 6));
+      const Tensor j = tanh(slice(a, 0, 6, 8));
+      const Tensor c_expected = i * j + f * c;
+      const Tensor h_expected = o * tanh(c_expected);
+
+      const vector<Tensor> hc = lstm_cell(u, b, c);
+      ASSERT_EQ(2u, hc.size());
+      EXPECT_EQ(Shape({2}, 2), hc[0].shape());
+      EXPECT_EQ(Shape({2}, 2), hc[1].shape());
+      EXPECT_TRUE(vector_near(
+            h_expected.to_vector(), hc[0].to_vector(), 1e-6));
+      EXPECT_TRUE(vector_near(
+            c_expected.to_vector(), hc[1].to_vector(), 1e-6));
+    }
+  }
+}
+
+TEST_F(TensorForwardTest, CheckGRUCell) {
+  const vector<float> ux_data {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1};
+  const vector<float> uh_data {.1, .2, .3, .4, -.1, -.2};
+  for (Device *dev : devices) {
+    const Tensor ux = dev->new_tensor_by_vector(Shape({6}, 2), ux_data);
+    const Tensor uh = dev->new_tensor_by_vector({6}, uh_data);
+    for (const Tensor &h : {
+        dev->new_tensor_by_vector(Shape({2}, 2), {.5, -.5, 1, 2}),
+        dev->new_tensor_by_vector({2}, {.5, -.5})}) {
+      const Tensor r = sigmoid(slice(ux, 0, 0, 2) + slice(uh, 0, 0, 2));
+      const Tensor z = sigmoid(slice(ux, 0, 2, 4) + slice(uh, 0, 2, 4));
+      const Tensor j = tanh(slice(ux, 0, 4, 6) + r * slice(uh, 0, 4, 6));
+      const Tensor y_expected = (1 - z) * j + z * h;
+
+      const Tensor y = gru_cell(ux, uh, h);
+      EXPECT_EQ(Shape({2}, 2), y.shape());
+      EXPECT_TRUE(vector_near(y_expected.to_vector(), y.to_vector(), 1e-6));
+    }
+  }
+}
+
+TEST_F(TensorForwardTest, CheckSRU) {
+  const vector<float> x_data {1, -1, 2, -2, .5, -.5, -3, 2, .1, -.1, 1, 1};
+  const vector<float> u_data {
+    1, -1, 2, -2, .5, -.5,
+    -3, 2, .1, -.1, 1, 1,
+    .3, .2, -.1, .4, -2, 3,
+  };
+  const vector<float> b_data {.1, .2, -.3, .4};
+  for (Device *dev : devices) {
+    const Tensor x = dev->new_tensor_by_vector(Shape({2, 3}, 2), x_data);
+    const Tensor u = dev->new_tensor_by_vector({6, 3}, u_data);
+    const Tensor b = dev->new_tensor_by_vector({4}, b_data);
+    const Tensor f = sigmoid(
+        slice(u, 0, 2, 4) + broadcast(slice(b, 0, 0, 2), 1, 3));
+    const Tensor r = sigmoid(
+        slice(u, 0, 4, 6) + broadcast(slice(b, 0, 2, 4), 1, 3));
+    vector<Tensor> cs;
+    Tensor c = dev->new_tensor_by_constant(Shape({2}, 2), 0);
+    for (std::uint32_t t = 0; t < 3; ++t) {
+      const Tensor ft = slice(f, 1, t, t + 1);
+      c = ft * c + (1 - ft) * slice(slice(u, 0, 0, 2), 1, t, t + 1);
+      cs.emplace_back(c);
+    }
+    const Tensor c_expected = concat(cs, 1);
+    const Tensor h_expected = r * tanh(c_expected) + (1 - r) * x;
+
+    const vector<Tensor> hc = sru(x, u, b);
+    ASSERT_EQ(2u, hc.size());
+    EXPECT_EQ(Shape({2, 3}, 2), hc[0].shape());
+    EXPECT_EQ(Shape({2, 3}, 2), hc[1].shape());
+    EXPECT_TRUE(vector_near(
+          h_expected.to_vector(), hc[0].to_vector(), 1e-6));
+    EXPECT_TRUE(vector_near(
+          c_expected.to_vector(), hc[1].to_vector(), 1e-6));
+  }
+}
+
+TEST_F(TensorForwardTest, CheckAttention) {
+  const vector<float> q_data {1, -1, .5, 2, 0, 1, -2, .5, 1, 1, -1, 0};
+  const vector<float> k_data {.5, 1, -1, .2, 2, -.5, 0, 1};
+  const vector<float> v_data {1, 2, 3, -1, 0, 1, .5, .5, 2, -2, 1, 0};
+  for (Device *dev : devices) {
+    // 2 queries, 4 keys with 2 dimensions, and values with 3 dimensions.
+    const Tensor q = dev->new_tensor_by_vector(Shape({2, 3}, 2), q_data);
+    const Tensor k = dev->new_tensor_by_vector({2, 4}, k_data);
+    const Tensor v = dev->new_tensor_by_vector({3, 4}, v_data);
+    const float scale = .7;
+    const Tensor s = matmul(transpose(k), q) * scale;
+    {
+      const Tensor y_expected = matmul(v, softmax(s, 0));
+      const Tensor y = attention(q, k, v, scale);
+      EXPECT_EQ(Shape({3, 3}, 2), y.shape());
+      EXPECT_TRUE(vector_near(y_expected.to_vector(), y.to_vector(), 1e-6));
+    }
+    {
+      // Large negative values exclude corresponding keys.
+      const Tensor mask = dev->new_tensor_by_vector(
+          {4, 3}, {0, -1e30, 0, 1, -1e30, -1e30, .5, 0, 0, 0, 0, -1e30});
+      const Tensor y_expected = matmul(v, softmax(s + mask, 0));
+      const Tensor y = attention(q, k, v, mask, scale);
+      EXPECT_EQ(Shape({3, 3}, 2), y.shape());
+      EXPECT_TRUE(vector_near(y_expected.to_vector(), y.to_vector(), 1e-6));
+    }
+  }
+}
+
+TEST_F(TensorForwardTest, CheckInvalidAttention) {
+  for (Device *dev : devices) {
+    const Tensor q = dev->new_tensor_by_constant({2, 3}, 0);
+    const Tensor k = dev->new_tensor_by_constant({2, 4}, 0);
+    const Tensor v = dev->new_tensor_by_constant({3, 4}, 0);
+    EXPECT_THROW(attention(q, q, v, 1), Error);
+    EXPECT_THROW(attention(q, k, q, 1), Error);
+    EXPECT_THROW(attention(q, k, v, q, 1), Error);
+  }
+}
+
 TEST_F(TensorForwardTest, CheckInvalidPool2D) {
   struct TestCase {
     Shape x_shape;
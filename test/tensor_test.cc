@@ -94,6 +94,62 @@ TEST_F(TensorTest, CheckNewMatrixMinibatchWithData) {
   }
 }
 
+TEST_F(TensorTest, CheckToArray) {
+  for (Device *dev : devices) {
+    const vector<float> data {1, 2, 3, 4, 5, 6};
+    const Tensor x = dev->new_tensor_by_vector(Shape({3}, 2), data);
+    vector<float> values(7, -1);
+    x.to_array(values.data());
+    EXPECT_TRUE(vector_match({1, 2, 3, 4, 5, 6, -1}, values));
+    EXPECT_THROW(x.to_array(nullptr), Error);
+    EXPECT_THROW(Tensor().to_array(values.data()), Error);
+  }
+}
+
+TEST_F(TensorTest, CheckNewWithExternalMemory) {
+  for (Device *dev : devices) {
+    if (!dev->supports_external_memory()) {
+      float data[] {1, 2, 3};
+      EXPECT_THROW(dev->new_tensor_by_external_memory({3}, data), Error);
+      continue;
+    }
+    EXPECT_THROW(dev->new_tensor_by_external_memory({3}, nullptr), Error);
+
+    // Borrowed memory.
+    vector<float> data {1, 2, 3, 4, 5, 6};
+    {
+      Tensor x = dev->new_tensor_by_external_memory(Shape({3}, 2), data.data());
+      EXPECT_EQ(Shape({3}, 2), x.shape());
+      EXPECT_TRUE(vector_match(data, x.to_vector()));
+      data[0] = 7;
+      EXPECT_TRUE(vector_match({7, 2, 3, 4, 5, 6}, x.to_vector()));
+
+      // Copies are not written back to the memory.
+      Tensor y = x;
+      y.inplace_multiply_const(2);
+      EXPECT_TRUE(vector_match({14, 4, 6, 8, 10, 12}, y.to_vector()));
+      EXPECT_TRUE(vector_match({7, 2, 3, 4, 5, 6}, data));
+
+      // In-place operations on the only owner update the memory.
+      x.inplace_add(y);
+      EXPECT_TRUE(vector_match({21, 6, 9, 12, 15, 18}, data));
+    }
+    EXPECT_TRUE(vector_match({21, 6, 9, 12, 15, 18}, data));
+
+    // Adopted memory.
+    std::uint32_t num_deleted = 0;
+    {
+      float *buf = new float[4] {1, 2, 3, 4};
+      const Tensor x = dev->new_tensor_by_external_memory(
+          {2, 2}, buf, [&](float *p) { delete[] p; ++num_deleted; });
+      const Tensor y = x;
+      EXPECT_TRUE(vector_match({1, 2, 3, 4}, y.to_vector()));
+      EXPECT_EQ(0u, num_deleted);
+    }
+    EXPECT_EQ(1u, num_deleted);
+  }
+}
+
 TEST_F(TensorTest, CheckMoveValidToNew) {
   for (Device *dev : devices) {
     Tensor tmp = dev->new_tensor_by_vector(Shape({2}, 3), {1, 2, 3, 4, 5, 6});
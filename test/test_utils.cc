@@ -1,6 +1,7 @@
 #include <primitiv/config.h>
 
 #include <iostream>
+#include <random>
 #include <vector>
 
 #include <primitiv/core/error.h>
@@ -64,15 +65,16 @@ void add_available_devices(std::vector<primitiv::Device *> &devs) {
 
 void add_available_naive_devices(std::vector<primitiv::Device *> &devs) {
   // We can always add Naive devices.
+  // The second one uses multiple threads to execute large operations.
   ::add_device(devs, new Naive());
-  ::add_device(devs, new Naive());
+  ::add_device(devs, new Naive(std::random_device()(), true, 4));
 }
 
 void add_available_eigen_devices(std::vector<primitiv::Device *> &devs) {
   MAYBE_USED(devs);
 #ifdef PRIMITIV_USE_EIGEN
   ::add_device(devs, new Eigen());
-  ::add_device(devs, new Eigen());
+  ::add_device(devs, new Eigen(std::random_device()(), true, 4));
 #endif  // PRIMITIV_USE_EIGEN
 }
 
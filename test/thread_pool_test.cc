@@ -0,0 +1,173 @@
+#include <primitiv/config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <primitiv/core/error.h>
+#include <primitiv/core/thread_pool.h>
+
+using std::vector;
+
+namespace primitiv {
+
+class ThreadPoolTest : public testing::Test {};
+
+TEST_F(ThreadPoolTest, CheckNew) {
+  for (const std::uint32_t n : {1u, 2u, 4u}) {
+    ThreadPool pool(n);
+    EXPECT_EQ(n, pool.num_threads());
+  }
+  EXPECT_THROW(ThreadPool(0), Error);
+}
+
+TEST_F(ThreadPoolTest, CheckRunWithoutTasks) {
+  ThreadPool pool(4);
+  std::uint32_t count = 0;
+  EXPECT_NO_THROW(pool.run({}, [&](std::uint32_t) { ++count; }));
+  EXPECT_EQ(0u, count);
+}
+
+TEST_F(ThreadPoolTest, CheckRun) {
+  // Diamond-shaped dependencies repeated several times:
+  //   4k -> {4k+1, 4k+2} -> 4k+3 -> 4k+4
+  const std::uint32_t num_diamonds = 50;
+  const std::uint32_t num_tasks = 4 * num_diamonds + 1;
+  vector<vector<std::uint32_t>> successors(num_tasks);
+  for (std::uint32_t k = 0; k < num_diamonds; ++k) {
+    const std::uint32_t b = 4 * k;
+    successors[b] = {b + 1, b + 2};
+    successors[b + 1] = {b + 3};
+    successors[b + 2] = {b + 3};
+    successors[b + 3] = {b + 4};
+  }
+
+  for (const std::uint32_t n : {1u, 2u, 4u}) {
+    ThreadPool pool(n);
+    for (std::uint32_t trial = 0; trial < 10; ++trial) {
+      std::mutex mutex;
+      vector<std::uint32_t> order;
+      pool.run(successors, [&](std::uint32_t id) {
+          const std::lock_guard<std::mutex> lock(mutex);
+          order.emplace_back(id);
+      });
+      ASSERT_EQ(num_tasks, order.size());
+
+      vector<std::uint32_t> position(num_tasks, num_tasks);
+      for (std::uint32_t i = 0; i < num_tasks; ++i) {
+        ASSERT_EQ(num_tasks, position[order[i]]);
+        position[order[i]] = i;
+      }
+      for (std::uint32_t i = 0; i < num_tasks; ++i) {
+        for (const std::uint32_t s : successors[i]) {
+          EXPECT_LT(position[i], position[s]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(ThreadPoolTest, CheckRunIndependentTasks) {
+  const std::uint32_t num_tasks = 1000;
+  const vector<vector<std::uint32_t>> successors(num_tasks);
+  ThreadPool pool(4);
+  vector<std::atomic<std::uint32_t>> counts(num_tasks);
+  for (auto &c : counts) c = 0;
+  pool.run(successors, [&](std::uint32_t id) { ++counts[id]; });
+  for (const auto &c : counts) {
+    EXPECT_EQ(1u, c);
+  }
+}
+
+TEST_F(ThreadPoolTest, CheckException) {
+  // 0 -> 1 -> 2
+  const vector<vector<std::uint32_t>> successors {{1}, {2}, {}};
+  for (const std::uint32_t n : {1u, 4u}) {
+    ThreadPool pool(n);
+    std::atomic<std::uint32_t> count(0);
+    EXPECT_THROW(
+        pool.run(successors, [&](std::uint32_t id) {
+            ++count;
+            if (id == 1) throw std::runtime_error("error");
+        }),
+        std::runtime_error);
+    EXPECT_EQ(2u, count);
+
+    // The pool is still available.
+    count = 0;
+    EXPECT_NO_THROW(
+        pool.run(successors, [&](std::uint32_t) { ++count; }));
+    EXPECT_EQ(3u, count);
+  }
+}
+
+TEST_F(ThreadPoolTest, CheckParallelFor) {
+  struct TestCase {
+    std::size_t size, grain_size, num_chunks;
+  };
+  const vector<TestCase> test_cases {
+    {0, 1, 1}, {1, 1, 1}, {3, 1, 3}, {4, 1, 4}, {1000, 1, 4},
+    {1000, 400, 2}, {1000, 500, 2}, {1000, 501, 1}, {1000, 0, 4},
+  };
+  ThreadPool pool(4);
+  for (const TestCase &tc : test_cases) {
+    std::mutex mutex;
+    vector<std::pair<std::size_t, std::size_t>> chunks;
+    pool.parallel_for(
+        tc.size, tc.grain_size, [&](std::size_t begin, std::size_t end) {
+          const std::lock_guard<std::mutex> lock(mutex);
+          chunks.emplace_back(begin, end);
+    });
+    ASSERT_EQ(tc.num_chunks, chunks.size());
+
+    // Chunks cover the whole range without overlaps.
+    std::sort(chunks.begin(), chunks.end());
+    std::size_t next = 0;
+    for (const auto &chunk : chunks) {
+      EXPECT_EQ(next, chunk.first);
+      EXPECT_LE(chunk.first, chunk.second);
+      next = chunk.second;
+    }
+    EXPECT_EQ(tc.size, next);
+  }
+}
+
+TEST_F(ThreadPoolTest, CheckParallelForWhileRunning) {
+  // parallel_for() called by a running job is executed by the calling thread.
+  const vector<vector<std::uint32_t>> successors(8);
+  ThreadPool pool(4);
+  std::atomic<std::uint32_t> num_calls(0);
+  std::atomic<std::uint32_t> sum(0);
+  pool.run(successors, [&](std::uint32_t) {
+      pool.parallel_for(100, 1, [&](std::size_t begin, std::size_t end) {
+          ++num_calls;
+          sum += end - begin;
+      });
+  });
+  EXPECT_EQ(8u, num_calls);
+  EXPECT_EQ(800u, sum);
+}
+
+TEST_F(ThreadPoolTest, CheckParallelForException) {
+  ThreadPool pool(4);
+  EXPECT_THROW(
+      pool.parallel_for(100, 1, [&](std::size_t begin, std::size_t) {
+          if (begin == 0) throw std::runtime_error("error");
+      }),
+      std::runtime_error);
+
+  // The pool is still available.
+  std::atomic<std::uint32_t> sum(0);
+  EXPECT_NO_THROW(
+      pool.parallel_for(100, 1, [&](std::size_t begin, std::size_t end) {
+          sum += end - begin;
+      }));
+  EXPECT_EQ(100u, sum);
+}
+
+}  // namespace primitiv